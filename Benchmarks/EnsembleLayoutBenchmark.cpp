@@ -0,0 +1,82 @@
+/**
+ * Compares the two ensemble layouts on a radial dam break with a different height of the dam for every member:
+ * independent blocks (Blocks::Ensemble, one member per thread team) against the members interleaved in the innermost
+ * dimension (Blocks::InterleavedEnsemble, the sweeps vectorise across the members).
+ *
+ * Run with pinned threads, e.g. OMP_PROC_BIND=close OMP_PLACES=cores ./EnsembleLayoutBenchmark -x 512 -m 8
+ */
+
+#include <cmath>
+#include <iostream>
+
+#include <omp.h>
+
+#include "Blocks/InterleavedEnsemble.h"
+#include "Scenarios/RadialDamBreakScenario.hpp"
+#include "Tools/Args.hpp"
+#include "Tools/RealType.hpp"
+
+namespace {
+  //! The dam of member m is 5 + m / 2 meters higher than the water around it.
+  auto dam(int member) {
+    return [member](RealType x, RealType y) {
+      return std::sqrt((x - 500) * (x - 500) + (y - 500) * (y - 500)) < 100 ? RealType(5.0) + RealType(0.5) * member : RealType(0.0);
+    };
+  }
+
+  /**
+   * Returns the seconds to simulate time seconds and prints the cell updates per second.
+   */
+  template <class EnsembleType>
+  double measure(const char* name, EnsembleType& ensemble, RealType time) {
+    for (int member = 0; member < ensemble.getMemberCount(); member++) {
+      ensemble.initialiseMember(member, dam(member));
+    }
+
+    const double start   = omp_get_wtime();
+    ensemble.simulateUntil(time);
+    const double seconds = omp_get_wtime() - start;
+    std::cout << "  " << name << ": " << seconds << " s, " << ensemble.getCellUpdates() / seconds * 1e-6 << " million cell updates per second"
+              << std::endl;
+    return seconds;
+  }
+} // namespace
+
+int main(int argc, char** argv) {
+  Tools::Args args;
+  args.addOption("grid-size", 'x', "Number of cells in x and y direction (default 256)");
+  args.addOption("members", 'm', "Number of members (default 8)");
+  args.addOption("simulation-time", 't', "Simulated seconds (default 5)");
+
+  Tools::Args::Result ret = args.parse(argc, argv);
+  if (ret == Tools::Args::Result::Help) {
+    return 0;
+  }
+  if (ret == Tools::Args::Result::Error) {
+    return 1;
+  }
+
+  const int      size     = args.getArgument<int>("grid-size", 256);
+  const int      members  = args.getArgument<int>("members", 8);
+  const RealType time     = args.getArgument<RealType>("simulation-time", 5);
+  const RealType cellSize = 1000.0 / size;
+
+  std::cout << "Grid: " << size << " x " << size << ", members: " << members << ", threads: " << omp_get_max_threads() << std::endl;
+  if (omp_get_proc_bind() == omp_proc_bind_false) {
+    std::cout << "Threads are not pinned, set OMP_PROC_BIND and OMP_PLACES for meaningful numbers" << std::endl;
+  }
+
+  Scenarios::RadialDamBreakScenario scenario;
+  double                            independentTime = 0;
+  {
+    Blocks::Ensemble<> ensemble(size, size, cellSize, cellSize, 0, 0, scenario, members);
+    independentTime = measure("Independent", ensemble, time);
+  }
+  double interleavedTime = 0;
+  {
+    Blocks::InterleavedEnsemble<> ensemble(size, size, cellSize, cellSize, 0, 0, scenario, members);
+    interleavedTime = measure("Interleaved", ensemble, time);
+  }
+  std::cout << "  Speedup of the interleaved layout: " << independentTime / interleavedTime << std::endl;
+  return 0;
+}
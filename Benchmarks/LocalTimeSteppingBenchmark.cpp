@@ -0,0 +1,100 @@
+/**
+ * Cell updates and run time of local time stepping (ExecutionMode::LocalTimeStepping) against global time stepping on
+ * a cross section of an ocean basin: 4000 m deep ocean, a continental slope, a 100 m shelf and dry land, with a hump
+ * of water in the ocean. The shelf is what lets the tiles there run with larger time steps.
+ *
+ * Run e.g. ./LocalTimeSteppingBenchmark -x 800 -t 10800 -l 4
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+#include <omp.h>
+
+#include "Blocks/DimensionalSplitting.h"
+#include "Tools/Args.hpp"
+#include "Tools/RealType.hpp"
+
+namespace {
+  /**
+   * 4000 km x 2000 km, the profile only changes in x.
+   */
+  class BasinScenario: public Scenarios::Scenario {
+  public:
+    RealType getWaterHeight(RealType x, RealType y) const override {
+      const RealType distance = std::sqrt((x - 1.0e6) * (x - 1.0e6) + (y - 1.0e6) * (y - 1.0e6));
+      return std::max(-getBathymetry(x, y), RealType(0.0)) + (distance < 1.0e5 ? RealType(2.0) : RealType(0.0));
+    }
+
+    RealType getBathymetry(RealType x, [[maybe_unused]] RealType y) const override {
+      if (x < 2.4e6) {
+        return -4000;
+      }
+      if (x < 3.0e6) {
+        // Continental slope
+        return RealType(-4000 + (x - 2.4e6) / 0.6e6 * 3900);
+      }
+      return x < 3.8e6 ? -100 : 10;
+    }
+
+    BoundaryType getBoundaryType([[maybe_unused]] BoundaryEdge edge) const override { return BoundaryType::Outflow; }
+    RealType     getBoundaryPos(BoundaryEdge edge) const override {
+      if (edge == BoundaryEdge::Right) {
+        return RealType(4.0e6);
+      }
+      return edge == BoundaryEdge::Top ? RealType(2.0e6) : RealType(0.0);
+    }
+  };
+
+  //! Runs until endTime and returns the seconds it took.
+  double run(Blocks::DimensionalSplitting<>& block, double endTime) {
+    const double start = omp_get_wtime();
+    for (double time = 0; time < endTime;) {
+      block.setGhostLayer();
+      time += block.simulateTimeStep();
+    }
+    return omp_get_wtime() - start;
+  }
+} // namespace
+
+int main(int argc, char** argv) {
+  Tools::Args args;
+  args.addOption("grid-size", 'x', "Number of cells in x direction, half as many in y direction (default 800)");
+  args.addOption("simulation-time", 't', "Simulated seconds (default 10800)");
+  args.addOption("levels", 'l', "Time step levels of the local time stepping (default 4)");
+  args.addOption("tile-size", 's', "Cells per side of a tile (default 32)");
+
+  Tools::Args::Result ret = args.parse(argc, argv);
+  if (ret == Tools::Args::Result::Help) {
+    return 0;
+  }
+  if (ret == Tools::Args::Result::Error) {
+    return 1;
+  }
+
+  const int    nx       = args.getArgument<int>("grid-size", 800);
+  const int    ny       = nx / 2;
+  const double endTime  = args.getArgument<double>("simulation-time", 10800);
+  const int    levels   = args.getArgument<int>("levels", 4);
+  const int    tileSize = args.getArgument<int>("tile-size", 32);
+
+  BasinScenario  scenario;
+  const RealType cellSize = 4.0e6 / nx;
+
+  Blocks::DimensionalSplitting<> global(nx, ny, cellSize, cellSize, Blocks::ExecutionMode::Buffered);
+  global.initialiseScenario(0, 0, scenario);
+  const double globalSeconds = run(global, endTime);
+
+  Blocks::DimensionalSplitting<> local(nx, ny, cellSize, cellSize, Blocks::ExecutionMode::LocalTimeStepping);
+  local.initialiseScenario(0, 0, scenario);
+  local.setTileSize(tileSize, tileSize);
+  local.setTimeStepLevels(levels);
+  const double localSeconds = run(local, endTime);
+
+  const double ratio = static_cast<double>(local.getGlobalCellUpdates()) / local.getLocalCellUpdates();
+  std::cout << "Grid: " << nx << " x " << ny << ", " << endTime << " s, " << levels << " levels, tiles of " << tileSize << " cells" << std::endl;
+  std::cout << "  Cell updates: " << local.getLocalCellUpdates() << " instead of " << local.getGlobalCellUpdates() << " (" << ratio << " times fewer)" << std::endl;
+  std::cout << "  Run time: " << localSeconds << " s instead of " << globalSeconds << " s" << std::endl;
+  return 0;
+}
@@ -0,0 +1,186 @@
+/**
+ * Strong scaling of the MPI runner's time step over the number of ranks, with the ghost layers exchanged before the
+ * fluxes (blocking) and overlapped with the fluxes of the interior edges (Blocks::HaloExchange::start/wait). The
+ * ranks of a run are split into groups of 1, 2, 4, ... ranks that solve the same radial dam break one after another.
+ * With -k, a halo of that width is exchanged every Blocks::Block::getHaloTimeSteps time steps in a third run.
+ *
+ * Run on one box with e.g. mpirun --oversubscribe -np 8 ./MPIScalingBenchmark -x 2048 -n 50 -k 4
+ * With more ranks than cores, the idle ranks of the smaller groups compete for the cores and the overlap has no spare
+ * core to progress the messages, so only the runs up to the number of cores are meaningful.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <mpi.h>
+
+#include "Blocks/Block.hpp"
+#include "Blocks/HaloExchange.h"
+#include "Scenarios/RadialDamBreakScenario.hpp"
+#include "Tools/Args.hpp"
+#include "Tools/RealType.hpp"
+
+namespace {
+  //! Seconds per time step, the slowest rank counts, and the total water volume after the run.
+  struct Result {
+    double   seconds;
+    RealType volume;
+  };
+
+  //! Block rows of the decomposition, like the MPI runner.
+  int computeNumberOfBlockRows(int ranks) {
+    int rows = static_cast<int>(std::sqrt(ranks));
+    while (ranks % rows != 0) {
+      rows--;
+    }
+    return rows;
+  }
+
+  /**
+   * Runs steps time steps on a size x size grid split over the ranks of communicator.
+   * With a haloWidth > 1, the exchange is blocking and only every few time steps.
+   */
+  Result measure(MPI_Comm communicator, int size, int steps, bool overlap, int haloWidth) {
+    int rank  = 0;
+    int ranks = 0;
+    MPI_Comm_rank(communicator, &rank);
+    MPI_Comm_size(communicator, &ranks);
+
+    const int blocksY   = computeNumberOfBlockRows(ranks);
+    const int blocksX   = ranks / blocksY;
+    const int positionX = rank / blocksY;
+    const int positionY = rank % blocksY;
+    const int nxNormal  = size / blocksX;
+    const int nyNormal  = size / blocksY;
+    const int nx        = positionX < blocksX - 1 ? nxNormal : size - (blocksX - 1) * nxNormal;
+    const int ny        = positionY < blocksY - 1 ? nyNormal : size - (blocksY - 1) * nyNormal;
+
+    const int neighbours[4] = {
+      positionX > 0 ? rank - blocksY : MPI_PROC_NULL,
+      positionX < blocksX - 1 ? rank + blocksY : MPI_PROC_NULL,
+      positionY > 0 ? rank - 1 : MPI_PROC_NULL,
+      positionY < blocksY - 1 ? rank + 1 : MPI_PROC_NULL};
+
+    // Cells that overlap with a neighbour at every edge
+    int overlapCells[4];
+    for (int edge = 0; edge < 4; edge++) {
+      overlapCells[edge] = neighbours[edge] != MPI_PROC_NULL ? haloWidth - 1 : 0;
+    }
+
+    Scenarios::RadialDamBreakScenario scenario;
+    const RealType                    cellSize = 1000.0 / size;
+    std::unique_ptr<Blocks::Block>    block(Blocks::Block::getBlockInstance(
+      nx + overlapCells[BoundaryEdge::Left] + overlapCells[BoundaryEdge::Right], ny + overlapCells[BoundaryEdge::Bottom] + overlapCells[BoundaryEdge::Top], cellSize, cellSize
+    ));
+    block->initialiseScenario(
+      (positionX * nxNormal - overlapCells[BoundaryEdge::Left]) * cellSize, (positionY * nyNormal - overlapCells[BoundaryEdge::Bottom]) * cellSize, scenario, true
+    );
+
+    for (const BoundaryEdge edge : {BoundaryEdge::Left, BoundaryEdge::Right, BoundaryEdge::Bottom, BoundaryEdge::Top}) {
+      if (neighbours[edge] == MPI_PROC_NULL) {
+        block->setBoundaryType(edge, BoundaryType::Outflow);
+      }
+    }
+    Blocks::HaloExchange haloExchange(*block, neighbours, haloWidth, communicator);
+    const int            exchangeInterval = block->getHaloTimeSteps(haloWidth);
+
+    MPI_Barrier(communicator);
+    const double start = MPI_Wtime();
+    for (int step = 0; step < steps; step++) {
+      if (overlap) {
+        haloExchange.start();
+        block->computeNumericalFluxesInterior();
+        haloExchange.wait();
+        block->setGhostLayer();
+        block->computeNumericalFluxesBoundary();
+      } else {
+        if (step % exchangeInterval == 0) {
+          haloExchange.exchange();
+        }
+        block->setGhostLayer();
+        block->computeNumericalFluxes();
+      }
+
+      const RealType maxTimeStep = block->getMaxTimeStep();
+      RealType       timeStep    = 0;
+      MPI_Allreduce(&maxTimeStep, &timeStep, 1, MY_MPI_FLOAT, MPI_MIN, communicator);
+      block->updateUnknowns(timeStep);
+    }
+    const double seconds = (MPI_Wtime() - start) / steps;
+
+    RealType volume = 0;
+    for (int i = 1; i <= nx; i++) {
+      for (int j = 1; j <= ny; j++) {
+        volume += block->getWaterHeight()[i + overlapCells[BoundaryEdge::Left]][j + overlapCells[BoundaryEdge::Bottom]];
+      }
+    }
+
+    Result result{0, 0};
+    MPI_Allreduce(&seconds, &result.seconds, 1, MPI_DOUBLE, MPI_MAX, communicator);
+    MPI_Allreduce(&volume, &result.volume, 1, MY_MPI_FLOAT, MPI_SUM, communicator);
+    return result;
+  }
+} // namespace
+
+int main(int argc, char** argv) {
+  MPI_Init(&argc, &argv);
+  int rank  = 0;
+  int ranks = 0;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &ranks);
+
+  Tools::Args args;
+  args.addOption("grid-size", 'x', "Number of cells in x and y direction (default 1024)");
+  args.addOption("time-steps", 'n', "Number of measured time steps per run (default 20)");
+  args.addOption("halo-width", 'k', "Width of the halo of an additional run that exchanges only every few time steps (default 1, no run)");
+
+  Tools::Args::Result ret = args.parse(argc, argv, rank == 0);
+  if (ret != Tools::Args::Result::Success) {
+    MPI_Finalize();
+    return ret == Tools::Args::Result::Help ? 0 : 1;
+  }
+
+  const int size  = args.getArgument<int>("grid-size", 1024);
+  const int steps = args.getArgument<int>("time-steps", 20);
+  const int width = args.getArgument<int>("halo-width", 1);
+  if (rank == 0) {
+    std::cout << "Grid: " << size << " x " << size << ", time steps: " << steps << ", ranks: " << ranks << std::endl;
+  }
+
+  double serialTime = 0;
+  for (int groupSize = 1;; groupSize = std::min(2 * groupSize, ranks)) {
+    MPI_Comm communicator;
+    MPI_Comm_split(MPI_COMM_WORLD, rank < groupSize ? 0 : MPI_UNDEFINED, rank, &communicator);
+    if (communicator != MPI_COMM_NULL) {
+      const Result blocking   = measure(communicator, size, steps, false, 1);
+      const Result overlapped = measure(communicator, size, steps, true, 1);
+      const Result wide       = width > 1 ? measure(communicator, size, steps, false, width) : blocking;
+      MPI_Comm_free(&communicator);
+
+      if (rank == 0) {
+        if (groupSize == 1) {
+          serialTime = overlapped.seconds;
+        }
+        const double speedup = serialTime / overlapped.seconds;
+        std::cout << "  " << groupSize << " ranks: blocking " << blocking.seconds * 1e3 << " ms, overlapped " << overlapped.seconds * 1e3
+                  << " ms per time step, speedup " << speedup << ", efficiency " << speedup / groupSize << std::endl;
+        if (width > 1) {
+          std::cout << "    halo width " << width << ": " << wide.seconds * 1e3 << " ms per time step, volume " << wide.volume << " instead of "
+                    << blocking.volume << std::endl;
+        }
+        if (blocking.volume != overlapped.volume) {
+          std::cout << "  The overlapped exchange changed the result: volume " << overlapped.volume << " instead of " << blocking.volume << std::endl;
+        }
+      }
+    }
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    if (groupSize == ranks) {
+      break;
+    }
+  }
+
+  MPI_Finalize();
+  return 0;
+}
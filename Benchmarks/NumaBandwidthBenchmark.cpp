@@ -0,0 +1,126 @@
+/**
+ * Memory bandwidth per socket of a column sweep over Float2D arrays, once with the pages first touched by a single
+ * thread and once first touched in parallel with the static column partitioning the DimensionalSplitting sweeps use.
+ *
+ * Run with pinned threads, e.g. OMP_PROC_BIND=spread OMP_PLACES=cores ./NumaBandwidthBenchmark -x 8192
+ */
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <omp.h>
+#include <sched.h>
+
+#include "Tools/Args.hpp"
+#include "Tools/Float2D.hpp"
+#include "Tools/RealType.hpp"
+
+namespace {
+  int getSocket(int cpu) {
+    std::ifstream file("/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/physical_package_id");
+    int           socket = 0;
+    file >> socket;
+    return socket;
+  }
+
+  void touch(Tools::Float2D<RealType>& array, bool parallel) {
+#pragma omp parallel for schedule(static) if (parallel)
+    for (int i = 0; i < array.getCols(); ++i) {
+      std::fill_n(array[i], array.getRows(), RealType(1.0));
+    }
+  }
+
+  struct SocketResult {
+    int    threads{0};
+    double bytes{0.0};
+    double seconds{0.0};
+  };
+
+  /**
+   * Runs a triad a = b + s * c over the columns and returns the bandwidth of the threads of every socket.
+   */
+  std::map<int, SocketResult> measure(int size, int repetitions, bool parallelTouch) {
+    Tools::Float2D<RealType> a(size + 2, size + 2);
+    Tools::Float2D<RealType> b(size + 2, size + 2);
+    Tools::Float2D<RealType> c(size + 2, size + 2);
+    touch(a, parallelTouch);
+    touch(b, parallelTouch);
+    touch(c, parallelTouch);
+
+    const int           threadCount = omp_get_max_threads();
+    std::vector<int>    sockets(threadCount, 0);
+    std::vector<double> bytes(threadCount, 0.0);
+    std::vector<double> seconds(threadCount, 0.0);
+
+    for (int repetition = 0; repetition < repetitions; repetition++) {
+#pragma omp parallel
+      {
+        const int thread = omp_get_thread_num();
+        sockets[thread]  = getSocket(sched_getcpu());
+        double columns   = 0;
+
+#pragma omp barrier
+        const double start = omp_get_wtime();
+#pragma omp for schedule(static) nowait
+        for (int i = 1; i <= size; ++i) {
+          for (int j = 1; j <= size; ++j) {
+            a[i][j] = b[i][j] + RealType(0.5) * c[i][j];
+          }
+          columns++;
+        }
+        seconds[thread] += omp_get_wtime() - start;
+        bytes[thread] += columns * size * 3 * sizeof(RealType);
+      }
+    }
+
+    std::map<int, SocketResult> results;
+    for (int thread = 0; thread < threadCount; thread++) {
+      SocketResult& result = results[sockets[thread]];
+      result.threads++;
+      result.bytes += bytes[thread];
+      result.seconds = std::max(result.seconds, seconds[thread]);
+    }
+    return results;
+  }
+
+  void print(const std::string& name, const std::map<int, SocketResult>& results) {
+    std::cout << name << std::endl;
+    double total = 0;
+    for (const auto& [socket, result] : results) {
+      const double bandwidth = result.bytes / result.seconds * 1e-9;
+      total += bandwidth;
+      std::cout << "  Socket " << socket << ": " << result.threads << " threads, " << bandwidth << " GB/s" << std::endl;
+    }
+    std::cout << "  Total: " << total << " GB/s" << std::endl;
+  }
+} // namespace
+
+int main(int argc, char** argv) {
+  Tools::Args args;
+  args.addOption("grid-size", 'x', "Number of cells in x and y direction (default 4096)");
+  args.addOption("repetitions", 'r', "Number of sweeps per measurement (default 20)");
+
+  Tools::Args::Result ret = args.parse(argc, argv);
+  if (ret == Tools::Args::Result::Help) {
+    return 0;
+  }
+  if (ret == Tools::Args::Result::Error) {
+    return 1;
+  }
+
+  const int size        = args.getArgument<int>("grid-size", 4096);
+  const int repetitions = args.getArgument<int>("repetitions", 20);
+
+  std::cout << "Threads: " << omp_get_max_threads() << ", grid: " << size << " x " << size << std::endl;
+  if (omp_get_proc_bind() == omp_proc_bind_false) {
+    std::cout << "Threads are not pinned, set OMP_PROC_BIND and OMP_PLACES for meaningful numbers" << std::endl;
+  }
+
+  print("Serial first touch", measure(size, repetitions, false));
+  print("Parallel first touch", measure(size, repetitions, true));
+  return 0;
+}
@@ -0,0 +1,90 @@
+/**
+ * Strong scaling of a DimensionalSplitting block over the number of OpenMP threads for every execution mode. Each time
+ * step runs in one parallel region (DimensionalSplitting::simulateTimeStep).
+ *
+ * Run with pinned threads, e.g. OMP_PROC_BIND=close OMP_PLACES=cores ./ThreadScalingBenchmark -x 2048 -n 50
+ */
+
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <omp.h>
+
+#include "Blocks/DimensionalSplitting.h"
+#include "Scenarios/RadialDamBreakScenario.hpp"
+#include "Tools/Args.hpp"
+#include "Tools/RealType.hpp"
+
+namespace {
+  /**
+   * Returns the seconds per time step of steps time steps with threads threads.
+   */
+  double measure(Blocks::ExecutionMode executionMode, int size, int steps, int threads) {
+    omp_set_num_threads(threads);
+
+    Scenarios::RadialDamBreakScenario scenario;
+    const RealType                    cellSize = 1000.0 / size;
+    Blocks::DimensionalSplitting<>    block(size, size, cellSize, cellSize, executionMode);
+    block.initialiseScenario(0, 0, scenario);
+
+    // warm up the caches and the thread pool
+    block.setGhostLayer();
+    block.simulateTimeStep();
+
+    const double start = omp_get_wtime();
+    for (int step = 0; step < steps; step++) {
+      block.setGhostLayer();
+      block.simulateTimeStep();
+    }
+    return (omp_get_wtime() - start) / steps;
+  }
+} // namespace
+
+int main(int argc, char** argv) {
+  Tools::Args args;
+  args.addOption("grid-size", 'x', "Number of cells in x and y direction (default 1024)");
+  args.addOption("time-steps", 'n', "Number of measured time steps per run (default 20)");
+
+  Tools::Args::Result ret = args.parse(argc, argv);
+  if (ret == Tools::Args::Result::Help) {
+    return 0;
+  }
+  if (ret == Tools::Args::Result::Error) {
+    return 1;
+  }
+
+  const int size       = args.getArgument<int>("grid-size", 1024);
+  const int steps      = args.getArgument<int>("time-steps", 20);
+  const int maxThreads = omp_get_max_threads();
+
+  std::vector<int> threadCounts;
+  for (int threads = 1; threads < maxThreads; threads *= 2) {
+    threadCounts.push_back(threads);
+  }
+  threadCounts.push_back(maxThreads);
+
+  std::cout << "Grid: " << size << " x " << size << ", time steps: " << steps << std::endl;
+  if (omp_get_proc_bind() == omp_proc_bind_false) {
+    std::cout << "Threads are not pinned, set OMP_PROC_BIND and OMP_PLACES for meaningful numbers" << std::endl;
+  }
+
+  const std::vector<std::pair<std::string, Blocks::ExecutionMode>> executionModes{
+    {"Buffered", Blocks::ExecutionMode::Buffered}, {"Fused", Blocks::ExecutionMode::Fused}, {"Tiled", Blocks::ExecutionMode::Tiled}, {"TaskGraph", Blocks::ExecutionMode::TaskGraph}};
+
+  for (const auto& [name, executionMode] : executionModes) {
+    std::cout << name << std::endl;
+    double serialTime = 0;
+    for (int threads : threadCounts) {
+      const double time = measure(executionMode, size, steps, threads);
+      if (threads == 1) {
+        serialTime = time;
+      }
+      const double speedup = serialTime / time;
+      std::cout << "  " << threads << " threads: " << time * 1e3 << " ms per time step, speedup " << speedup << ", efficiency "
+                << speedup / threads << std::endl;
+    }
+  }
+  return 0;
+}
@@ -67,7 +67,7 @@ RealType Blocks::WavePropagationBlock1D::computeNumericalFluxes() {
   for (unsigned int i = 1; i < size_ + 2; i++) {
     RealType maxEdgeSpeed = RealType(0.0);
     // Compute net updates
-    solver_.computeNetUpdates(
+    Solvers::FWaveKernel::computeNetUpdates(
       h_[i - 1],
       h_[i],
       hu_[i - 1],
@@ -37,7 +37,7 @@
 #pragma once
 
 
-#include "Solvers/FWaveSolver.h"
+#include "Solvers/FWaveKernel.h"
 #include "Tools/RealType.hpp"
 
 namespace Blocks {
@@ -85,9 +85,6 @@ namespace Blocks {
 
     RealType cellSize_;
 
-    /** The solver used in computeNumericalFluxes */
-    Solvers::FWaveSolver solver_;
-
   public:
     /**
      * @param size Domain size (= number of cells) without ghost cells
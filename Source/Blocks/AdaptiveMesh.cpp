@@ -0,0 +1,556 @@
+#include "AdaptiveMesh.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#if defined(ENABLE_OPENMP)
+#include <omp.h>
+#endif
+
+template <class SolverPolicy>
+Blocks::AdaptiveMesh<SolverPolicy>::AdaptiveMesh(
+  DimensionalSplitting<SolverPolicy>& base,
+  Scenarios::Scenario&                scenario,
+  RealType                            offsetX,
+  RealType                            offsetY,
+  RealType                            dx,
+  RealType                            dy,
+  const Parameters&                   parameters
+):
+  base_(base),
+  scenario_(scenario),
+  parameters_(parameters),
+  offsetX_(offsetX),
+  offsetY_(offsetY),
+  nx_(parameters.levels),
+  ny_(parameters.levels),
+  dx_(parameters.levels),
+  dy_(parameters.levels),
+  patches_(parameters.levels) {
+
+  nx_[0] = base.getNx();
+  ny_[0] = base.getNy();
+  dx_[0] = dx;
+  dy_[0] = dy;
+  for (int level = 1; level < parameters_.levels; level++) {
+    nx_[level] = nx_[level - 1] * parameters_.ratio;
+    ny_[level] = ny_[level - 1] * parameters_.ratio;
+    dx_[level] = dx_[level - 1] / parameters_.ratio;
+    dy_[level] = dy_[level - 1] / parameters_.ratio;
+  }
+
+  // The flags need the bathymetry in the ghost layer of the base block
+  base_.setGhostLayer();
+  for (int level = 1; level < parameters_.levels; level++) {
+    regridLevel(level, true);
+  }
+}
+
+template <class SolverPolicy>
+void Blocks::AdaptiveMesh<SolverPolicy>::simulateTimeStep(RealType dt) {
+  prepareTimeStep();
+  advanceLevels(dt);
+}
+
+template <class SolverPolicy>
+RealType Blocks::AdaptiveMesh<SolverPolicy>::simulateTimeStep() {
+  prepareTimeStep();
+
+  // The time step of level 0 has to satisfy the CFL condition of every level, level l takes ratio^l steps in it
+  RealType dt    = base_.getMaxTimeStep();
+  int      steps = 1;
+  for (int level = 1; level < parameters_.levels; level++) {
+    steps *= parameters_.ratio;
+    sampleGhostLayers(level, &Patch::GhostLayer::current_);
+
+    std::vector<Patch*> patches;
+    for (auto& [tile, patch] : patches_[level]) {
+      patch->block_->setGhostLayer();
+      patches.push_back(patch.get());
+    }
+
+    RealType levelTimeStep = dt / steps;
+#if defined(ENABLE_OPENMP)
+#pragma omp parallel for schedule(dynamic) reduction(min : levelTimeStep)
+#endif
+    for (std::size_t p = 0; p < patches.size(); p++) {
+      patches[p]->block_->computeNumericalFluxes();
+      levelTimeStep = std::min(levelTimeStep, patches[p]->block_->getMaxTimeStep());
+    }
+    dt = std::min(dt, levelTimeStep * steps);
+  }
+
+  advanceLevels(dt);
+  return dt;
+}
+
+template <class SolverPolicy>
+void Blocks::AdaptiveMesh<SolverPolicy>::prepareTimeStep() {
+  if (steps_ > 0 && parameters_.regridInterval > 0 && steps_ % parameters_.regridInterval == 0) {
+    regrid();
+  }
+  base_.setGhostLayer();
+  base_.computeNumericalFluxes();
+}
+
+template <class SolverPolicy>
+void Blocks::AdaptiveMesh<SolverPolicy>::advanceLevels(RealType dt) {
+  advanceLevel(0, dt);
+
+  const int finest = parameters_.levels - 1;
+  uniformCellUpdates_ += std::uint64_t(nx_[finest]) * ny_[finest] * std::uint64_t(std::pow(parameters_.ratio, finest));
+  steps_++;
+}
+
+template <class SolverPolicy>
+void Blocks::AdaptiveMesh<SolverPolicy>::regrid() {
+  // Coarse to fine, the flags of a level depend on the patches of the level below
+  for (int level = 1; level < parameters_.levels; level++) {
+    regridLevel(level, false);
+  }
+}
+
+template <class SolverPolicy>
+std::vector<const typename Blocks::AdaptiveMesh<SolverPolicy>::Patch*> Blocks::AdaptiveMesh<SolverPolicy>::getPatches() const {
+  std::vector<const Patch*> patches;
+  for (const PatchMap& level : patches_) {
+    for (const auto& [tile, patch] : level) {
+      patches.push_back(patch.get());
+    }
+  }
+  return patches;
+}
+
+template <class SolverPolicy>
+int Blocks::AdaptiveMesh<SolverPolicy>::getPatchCount(int level) const {
+  return int(patches_[level].size());
+}
+
+template <class SolverPolicy>
+int Blocks::AdaptiveMesh<SolverPolicy>::getParentIndex(int index, int cells, int parentCells) const {
+  if (index <= 0) {
+    return 0;
+  }
+  if (index > cells) {
+    return parentCells + 1;
+  }
+  return (index - 1) / parameters_.ratio + 1;
+}
+
+template <class SolverPolicy>
+Blocks::DimensionalSplitting<SolverPolicy>* Blocks::AdaptiveMesh<SolverPolicy>::locate(int level, int i, int j, int& o_i, int& o_j) const {
+  if (level == 0) {
+    o_i = i;
+    o_j = j;
+    return &base_;
+  }
+
+  // Ghost cells of the domain belong to the patch of the cell next to them
+  const int patchCells = parameters_.patchSize * parameters_.ratio;
+  const int cellX      = std::clamp(i, 1, nx_[level]);
+  const int cellY      = std::clamp(j, 1, ny_[level]);
+  auto      patch      = patches_[level].find({(cellX - 1) / patchCells, (cellY - 1) / patchCells});
+  if (patch == patches_[level].end()) {
+    return nullptr;
+  }
+  o_i = i - patch->second->firstX_;
+  o_j = j - patch->second->firstY_;
+  return patch->second->block_.get();
+}
+
+template <class SolverPolicy>
+typename Blocks::AdaptiveMesh<SolverPolicy>::CellState Blocks::AdaptiveMesh<SolverPolicy>::sample(int level, int i, int j) const {
+  int                                 blockI = 0;
+  int                                 blockJ = 0;
+  DimensionalSplitting<SolverPolicy>* block  = locate(level, i, j, blockI, blockJ);
+  if (block == nullptr) {
+    return sample(level - 1, getParentIndex(i, nx_[level], nx_[level - 1]), getParentIndex(j, ny_[level], ny_[level - 1]));
+  }
+  return {
+    block->getWaterHeight()[blockI][blockJ],
+    block->getDischargeHu()[blockI][blockJ],
+    block->getDischargeHv()[blockI][blockJ],
+    block->getBathymetry()[blockI][blockJ]};
+}
+
+template <class SolverPolicy>
+typename Blocks::AdaptiveMesh<SolverPolicy>::CellState Blocks::AdaptiveMesh<SolverPolicy>::prolongate(int level, int i, int j, RealType b) const {
+  const CellState coarse = sample(level, i, j);
+  if (coarse.h <= RealType(0.0)) {
+    // A fine cell below the surface of a wet neighbour is wet, otherwise the coast line would drain the fine level
+    RealType surface = -std::numeric_limits<RealType>::max();
+    for (auto [neighbourI, neighbourJ] : {std::pair{i - 1, j}, {i + 1, j}, {i, j - 1}, {i, j + 1}}) {
+      const CellState neighbour = sample(level, std::clamp(neighbourI, 0, nx_[level] + 1), std::clamp(neighbourJ, 0, ny_[level] + 1));
+      if (neighbour.h > RealType(0.0)) {
+        surface = std::max(surface, neighbour.h + neighbour.b);
+      }
+    }
+    return {std::max(surface - b, RealType(0.0)), RealType(0.0), RealType(0.0), b};
+  }
+  const RealType h = std::max(coarse.h + coarse.b - b, RealType(0.0));
+  return {h, coarse.hu / coarse.h * h, coarse.hv / coarse.h * h, b};
+}
+
+template <class SolverPolicy>
+std::unique_ptr<typename Blocks::AdaptiveMesh<SolverPolicy>::Patch> Blocks::AdaptiveMesh<SolverPolicy>::createPatch(
+  int level, int tileX, int tileY, bool fromScenario
+) {
+  const int patchSize = parameters_.patchSize;
+  const int ratio     = parameters_.ratio;
+
+  auto patch     = std::make_unique<Patch>();
+  patch->level_  = level;
+  patch->name_   = "level" + std::to_string(level) + "_" + std::to_string(tileX) + "_" + std::to_string(tileY);
+  patch->tileX_  = tileX;
+  patch->tileY_  = tileY;
+  patch->firstX_ = tileX * patchSize * ratio;
+  patch->firstY_ = tileY * patchSize * ratio;
+  // The last tile of a row or column may be smaller
+  patch->nx_      = (std::min((tileX + 1) * patchSize, nx_[level - 1]) - tileX * patchSize) * ratio;
+  patch->ny_      = (std::min((tileY + 1) * patchSize, ny_[level - 1]) - tileY * patchSize) * ratio;
+  patch->dx_      = dx_[level];
+  patch->dy_      = dy_[level];
+  patch->offsetX_ = offsetX_ + patch->firstX_ * patch->dx_;
+  patch->offsetY_ = offsetY_ + patch->firstY_ * patch->dy_;
+
+  const int nx   = patch->nx_;
+  const int ny   = patch->ny_;
+  patch->block_  = std::make_unique<DimensionalSplitting<SolverPolicy>>(nx, ny, patch->dx_, patch->dy_, parameters_.executionMode);
+  auto& block    = *patch->block_;
+  block.initialiseScenario(patch->offsetX_, patch->offsetY_, scenario_, true);
+
+  // Connect boundaries do not transfer the bathymetry, the ghost layer gets it from the scenario as well
+  Tools::Float2D<RealType> b = block.getBathymetry();
+  for (int i = 0; i <= nx + 1; i++) {
+    for (int j = 0; j <= ny + 1; j++) {
+      if (i == 0 || i == nx + 1 || j == 0 || j == ny + 1) {
+        b[i][j] = scenario_.getBathymetry(patch->offsetX_ + (i - RealType(0.5)) * patch->dx_, patch->offsetY_ + (j - RealType(0.5)) * patch->dy_);
+      }
+    }
+  }
+  block.setB(b);
+
+  if (!fromScenario) {
+    Tools::Float2D<RealType> h  = block.getWaterHeight();
+    Tools::Float2D<RealType> hu = block.getDischargeHu();
+    Tools::Float2D<RealType> hv = block.getDischargeHv();
+    for (int i = 1; i <= nx; i++) {
+      const int parentI = getParentIndex(patch->firstX_ + i, nx_[level], nx_[level - 1]);
+      for (int j = 1; j <= ny; j++) {
+        const CellState state = prolongate(level - 1, parentI, getParentIndex(patch->firstY_ + j, ny_[level], ny_[level - 1]), b[i][j]);
+        h[i][j]               = state.h;
+        hu[i][j]              = state.hu;
+        hv[i][j]              = state.hv;
+      }
+    }
+    block.setH(h);
+    block.setHu(hu);
+    block.setHv(hv);
+  }
+
+  for (int edge = BoundaryEdge::Left; edge <= BoundaryEdge::Top; edge++) {
+    patch->copyLayers_[edge].reset(block.registerCopyLayer(BoundaryEdge(edge)));
+
+    typename Patch::GhostLayer& ghost = patch->ghostLayers_[edge];
+    const int                   size  = (edge == BoundaryEdge::Left || edge == BoundaryEdge::Right) ? ny + 2 : nx + 2;
+    for (int variable = 0; variable < 3; variable++) {
+      ghost.current_[variable].assign(size, RealType(0.0));
+      ghost.start_[variable].assign(size, RealType(0.0));
+      ghost.end_[variable].assign(size, RealType(0.0));
+    }
+    ghost.layer_ = std::make_unique<Block1D>(ghost.current_[0].data(), ghost.current_[1].data(), ghost.current_[2].data(), size);
+  }
+  return patch;
+}
+
+template <class SolverPolicy>
+void Blocks::AdaptiveMesh<SolverPolicy>::regridLevel(int level, bool fromScenario) {
+  const std::vector<char> flags  = flagTiles(level - 1);
+  const int               tilesY = getTileCountY(level - 1);
+
+  PatchMap patches;
+  for (int tileX = 0; tileX < getTileCountX(level - 1); tileX++) {
+    for (int tileY = 0; tileY < tilesY; tileY++) {
+      if (flags[tileX * tilesY + tileY] == 0) {
+        continue;
+      }
+      auto existing = patches_[level].find({tileX, tileY});
+      if (existing != patches_[level].end()) {
+        patches.emplace(existing->first, std::move(existing->second));
+      } else {
+        patches.emplace(std::pair{tileX, tileY}, createPatch(level, tileX, tileY, fromScenario));
+      }
+    }
+  }
+  patches_[level] = std::move(patches);
+  connectPatches(level);
+}
+
+template <class SolverPolicy>
+void Blocks::AdaptiveMesh<SolverPolicy>::connectPatches(int level) {
+  static constexpr BoundaryEdge Opposite[4]{BoundaryEdge::Right, BoundaryEdge::Left, BoundaryEdge::Top, BoundaryEdge::Bottom};
+  static constexpr int          NeighbourX[4]{-1, 1, 0, 0};
+  static constexpr int          NeighbourY[4]{0, 0, -1, 1};
+
+  for (auto& [tile, patch] : patches_[level]) {
+    const bool domainBoundary[4]{
+      patch->firstX_ == 0,
+      patch->firstX_ + patch->nx_ == nx_[level],
+      patch->firstY_ == 0,
+      patch->firstY_ + patch->ny_ == ny_[level]};
+
+    for (int edge = BoundaryEdge::Left; edge <= BoundaryEdge::Top; edge++) {
+      typename Patch::GhostLayer& ghost = patch->ghostLayers_[edge];
+      ghost.interpolated_               = false;
+
+      if (domainBoundary[edge]) {
+        patch->block_->setBoundaryType(BoundaryEdge(edge), scenario_.getBoundaryType(BoundaryEdge(edge)));
+        continue;
+      }
+      auto neighbour = patches_[level].find({patch->tileX_ + NeighbourX[edge], patch->tileY_ + NeighbourY[edge]});
+      if (neighbour != patches_[level].end()) {
+        patch->block_->setBoundaryType(BoundaryEdge(edge), BoundaryType::Connect, neighbour->second->copyLayers_[Opposite[edge]].get());
+      } else {
+        ghost.interpolated_ = true;
+        patch->block_->setBoundaryType(BoundaryEdge(edge), BoundaryType::Connect, ghost.layer_.get());
+      }
+    }
+  }
+}
+
+template <class SolverPolicy>
+void Blocks::AdaptiveMesh<SolverPolicy>::sampleGhostLayers(int level, std::array<std::vector<RealType>, 3> Patch::GhostLayer::* o_values) {
+  for (auto& [tile, patch] : patches_[level]) {
+    const Tools::Float2D<RealType>& b = patch->block_->getBathymetry();
+
+    for (int edge = BoundaryEdge::Left; edge <= BoundaryEdge::Top; edge++) {
+      typename Patch::GhostLayer& ghost = patch->ghostLayers_[edge];
+      if (!ghost.interpolated_) {
+        continue;
+      }
+      std::array<std::vector<RealType>, 3>& values = ghost.*o_values;
+
+      for (int k = 0; k < int(values[0].size()); k++) {
+        const int i = (edge == BoundaryEdge::Left) ? 0 : (edge == BoundaryEdge::Right) ? patch->nx_ + 1 : k;
+        const int j = (edge == BoundaryEdge::Bottom) ? 0 : (edge == BoundaryEdge::Top) ? patch->ny_ + 1 : k;
+
+        const CellState state = prolongate(
+          level - 1,
+          getParentIndex(patch->firstX_ + i, nx_[level], nx_[level - 1]),
+          getParentIndex(patch->firstY_ + j, ny_[level], ny_[level - 1]),
+          b[i][j]
+        );
+        values[0][k] = state.h;
+        values[1][k] = state.hu;
+        values[2][k] = state.hv;
+      }
+    }
+  }
+}
+
+template <class SolverPolicy>
+void Blocks::AdaptiveMesh<SolverPolicy>::interpolateGhostLayers(int level, RealType fraction) {
+  for (auto& [tile, patch] : patches_[level]) {
+    for (typename Patch::GhostLayer& ghost : patch->ghostLayers_) {
+      if (!ghost.interpolated_) {
+        continue;
+      }
+      for (int variable = 0; variable < 3; variable++) {
+        for (std::size_t k = 0; k < ghost.current_[variable].size(); k++) {
+          ghost.current_[variable][k] = (1 - fraction) * ghost.start_[variable][k] + fraction * ghost.end_[variable][k];
+        }
+      }
+    }
+  }
+}
+
+template <class SolverPolicy>
+void Blocks::AdaptiveMesh<SolverPolicy>::advanceLevel(int level, RealType dt) {
+  const bool refined = level + 1 < parameters_.levels && !patches_[level + 1].empty();
+  if (refined) {
+    sampleGhostLayers(level + 1, &Patch::GhostLayer::start_);
+  }
+
+  if (level == 0) {
+    base_.updateUnknowns(dt);
+    cellUpdates_ += std::uint64_t(nx_[0]) * ny_[0];
+  } else {
+    // All ghost layers first, the copy layers of the neighbours must not have advanced yet
+    std::vector<Patch*> patches;
+    for (auto& [tile, patch] : patches_[level]) {
+      patch->block_->setGhostLayer();
+      patches.push_back(patch.get());
+      cellUpdates_ += std::uint64_t(patch->nx_) * patch->ny_;
+    }
+
+    // The patches are small, so the threads work on whole patches and every block runs single-threaded
+#if defined(ENABLE_OPENMP)
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (std::size_t p = 0; p < patches.size(); p++) {
+      patches[p]->block_->simulateTimeStep(dt);
+    }
+  }
+
+  if (refined) {
+    sampleGhostLayers(level + 1, &Patch::GhostLayer::end_);
+    for (int step = 0; step < parameters_.ratio; step++) {
+      interpolateGhostLayers(level + 1, RealType(step) / parameters_.ratio);
+      advanceLevel(level + 1, dt / parameters_.ratio);
+    }
+    restrictLevel(level + 1);
+  }
+}
+
+template <class SolverPolicy>
+void Blocks::AdaptiveMesh<SolverPolicy>::restrictLevel(int level) {
+  const int ratio = parameters_.ratio;
+
+  // Every block of the level below is written once, with all patches that lie in it
+  std::map<DimensionalSplitting<SolverPolicy>*, std::vector<const Patch*>> children;
+  for (const auto& [tile, patch] : patches_[level]) {
+    int parentI = 0;
+    int parentJ = 0;
+    auto* parent = locate(
+      level - 1,
+      getParentIndex(patch->firstX_ + 1, nx_[level], nx_[level - 1]),
+      getParentIndex(patch->firstY_ + 1, ny_[level], ny_[level - 1]),
+      parentI,
+      parentJ
+    );
+    children[parent].push_back(patch.get());
+  }
+  std::vector<std::pair<DimensionalSplitting<SolverPolicy>*, std::vector<const Patch*>>> parents(children.begin(), children.end());
+
+#if defined(ENABLE_OPENMP)
+#pragma omp parallel for schedule(dynamic)
+#endif
+  for (std::size_t p = 0; p < parents.size(); p++) {
+    DimensionalSplitting<SolverPolicy>& parent = *parents[p].first;
+
+    // The arrays are only writable through the setters, which keep their memory (and the copy layers) in place
+    Tools::Float2D<RealType>        h  = parent.getWaterHeight();
+    Tools::Float2D<RealType>        hu = parent.getDischargeHu();
+    Tools::Float2D<RealType>        hv = parent.getDischargeHv();
+    const Tools::Float2D<RealType>& b  = parent.getBathymetry();
+
+    for (const Patch* patch : parents[p].second) {
+      auto&                           block  = *patch->block_;
+      const Tools::Float2D<RealType>& fineH  = block.getWaterHeight();
+      const Tools::Float2D<RealType>& fineHu = block.getDischargeHu();
+      const Tools::Float2D<RealType>& fineHv = block.getDischargeHv();
+      const Tools::Float2D<RealType>& fineB  = block.getBathymetry();
+
+      int firstI = 0;
+      int firstJ = 0;
+      locate(level - 1, patch->firstX_ / ratio + 1, patch->firstY_ / ratio + 1, firstI, firstJ);
+
+      for (int ci = 0; ci < patch->nx_ / ratio; ci++) {
+        for (int cj = 0; cj < patch->ny_ / ratio; cj++) {
+          // Average of the surface of the wet fine cells, such that the coast line does not raise the surface
+          RealType surface   = 0;
+          int      wetCells  = 0;
+          RealType dischargeU = 0;
+          RealType dischargeV = 0;
+          for (int i = ci * ratio + 1; i <= (ci + 1) * ratio; i++) {
+            for (int j = cj * ratio + 1; j <= (cj + 1) * ratio; j++) {
+              if (fineH[i][j] > RealType(0.0)) {
+                surface += fineH[i][j] + fineB[i][j];
+                wetCells++;
+              }
+              dischargeU += fineHu[i][j];
+              dischargeV += fineHv[i][j];
+            }
+          }
+
+          const int      i      = firstI + ci;
+          const int      j      = firstJ + cj;
+          const RealType height = (wetCells > 0) ? std::max(surface / wetCells - b[i][j], RealType(0.0)) : RealType(0.0);
+          h[i][j]               = height;
+          hu[i][j]              = (height > RealType(0.0)) ? dischargeU / (ratio * ratio) : RealType(0.0);
+          hv[i][j]              = (height > RealType(0.0)) ? dischargeV / (ratio * ratio) : RealType(0.0);
+        }
+      }
+    }
+
+    parent.setH(h);
+    parent.setHu(hu);
+    parent.setHv(hv);
+  }
+}
+
+template <class SolverPolicy>
+std::vector<char> Blocks::AdaptiveMesh<SolverPolicy>::flagTiles(int level) {
+  const int      patchSize = parameters_.patchSize;
+  const int      tilesX    = getTileCountX(level);
+  const int      tilesY    = getTileCountY(level);
+  const RealType dx        = dx_[level];
+  const RealType dy        = dy_[level];
+
+  std::vector<char> covered(std::size_t(tilesX) * tilesY, 0);
+  std::vector<char> refined(std::size_t(tilesX) * tilesY, 0);
+
+#if defined(ENABLE_OPENMP)
+#pragma omp parallel for schedule(dynamic)
+#endif
+  for (int tileX = 0; tileX < tilesX; tileX++) {
+    for (int tileY = 0; tileY < tilesY; tileY++) {
+      const int iBegin = tileX * patchSize + 1;
+      const int jBegin = tileY * patchSize + 1;
+      const int iEnd   = std::min((tileX + 1) * patchSize, nx_[level]);
+      const int jEnd   = std::min((tileY + 1) * patchSize, ny_[level]);
+
+      int   blockI = 0;
+      int   blockJ = 0;
+      auto* block  = locate(level, iBegin, jBegin, blockI, blockJ);
+      if (block == nullptr) {
+        continue;
+      }
+      covered[tileX * tilesY + tileY] = 1;
+
+      // Distance of the destination to the rectangle of the tile
+      bool nearDestination = false;
+      if (parameters_.destinationRadius >= 0) {
+        const RealType distanceX = std::max({offsetX_ + (iBegin - 1) * dx - parameters_.destinationX, parameters_.destinationX - (offsetX_ + iEnd * dx), RealType(0.0)});
+        const RealType distanceY = std::max({offsetY_ + (jBegin - 1) * dy - parameters_.destinationY, parameters_.destinationY - (offsetY_ + jEnd * dy), RealType(0.0)});
+        nearDestination = std::hypot(distanceX, distanceY) <= parameters_.destinationRadius;
+      }
+
+      const Tools::Float2D<RealType>& h = block->getWaterHeight();
+      const Tools::Float2D<RealType>& b = block->getBathymetry();
+
+      bool wave  = false;
+      bool steep = false;
+      for (int i = blockI; i <= blockI + iEnd - iBegin; i++) {
+        for (int j = blockJ; j <= blockJ + jEnd - jBegin; j++) {
+          wave = wave || (h[i][j] > RealType(0.0) && std::abs(h[i][j] + b[i][j] - parameters_.seaLevel) > parameters_.waveThreshold);
+          const RealType slopeX = std::abs(b[i + 1][j] - b[i - 1][j]) / (2 * dx);
+          const RealType slopeY = std::abs(b[i][j + 1] - b[i][j - 1]) / (2 * dy);
+          steep                 = steep || std::max(slopeX, slopeY) > parameters_.bathymetryGradient;
+        }
+      }
+      refined[tileX * tilesY + tileY] = wave && (nearDestination || steep);
+    }
+  }
+
+  // One tile of margin around the flagged tiles, and all neighbours of a refined tile have to be covered by the level
+  std::vector<char> flags(std::size_t(tilesX) * tilesY, 0);
+  for (int tileX = 0; tileX < tilesX; tileX++) {
+    for (int tileY = 0; tileY < tilesY; tileY++) {
+      bool nested     = true;
+      bool neighbours = false;
+      for (int x = std::max(tileX - 1, 0); x <= std::min(tileX + 1, tilesX - 1); x++) {
+        for (int y = std::max(tileY - 1, 0); y <= std::min(tileY + 1, tilesY - 1); y++) {
+          nested     = nested && covered[x * tilesY + y] != 0;
+          neighbours = neighbours || refined[x * tilesY + y] != 0;
+        }
+      }
+      flags[tileX * tilesY + tileY] = nested && neighbours;
+    }
+  }
+  return flags;
+}
+
+template class Blocks::AdaptiveMesh<Solvers::FWaveKernel>;
+template class Blocks::AdaptiveMesh<Solvers::RusanovKernel>;
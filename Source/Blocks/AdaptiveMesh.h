@@ -0,0 +1,255 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "DimensionalSplitting.h"
+#include "Scenarios/Scenario.hpp"
+
+namespace Blocks {
+  /**
+   * Block-structured adaptive mesh refinement on top of a dimensional splitting block.
+   *
+   * The block passed to the constructor is level 0. Level l + 1 consists of patches that refine a tile of
+   * patchSize x patchSize cells of level l by the refinement ratio in both directions, so the patches of a level are
+   * aligned on the tile grid of the level below, each patch lies in exactly one patch of the level below and two
+   * neighbouring patches share a whole edge. Every patch is a Blocks::DimensionalSplitting block of its own with the
+   * bathymetry of the scenario at its resolution.
+   *
+   * The ghost layers of the patches use the BoundaryType::Connect machinery of Blocks::Block: an edge next to a patch
+   * of the same level is connected to the copy layer of that patch, an edge at the boundary of the domain gets the
+   * boundary type of the scenario, and every other edge is connected to a Blocks::Block1D owned by the mesh. The mesh
+   * fills these layers from the level below, constant in space and linear in time between the start and the end of
+   * the step of the level below.
+   *
+   * The levels are subcycled (Berger-Oliger): simulateTimeStep advances level 0 by a time step that is small enough
+   * for every level, then each level l + 1 takes ratio steps for every step of level l and is averaged back onto the
+   * cells of level l it covers. Transfers between the levels keep the surface elevation h + b and the velocity, such
+   * that a lake at rest stays at rest across levels with different bathymetry. The fluxes over coarse-fine interfaces
+   * are not corrected (no refluxing), so mass is only conserved up to the difference of the coarse and fine fluxes.
+   *
+   * Every regridInterval time steps the patches are rebuilt from the current state: a tile of level l is refined if
+   * the wave has reached it (a wet cell whose surface differs from the sea level by more than waveThreshold) and it
+   * lies near the destination or along steep bathymetry (a slope |grad b| above bathymetryGradient). The flagged tiles
+   * are extended by one tile in every direction, such that the wave cannot leave the refined area before the next
+   * regrid, and only tiles whose neighbours are refined on level l are kept (proper nesting). Existing patches keep
+   * their data, new patches are interpolated from the level below.
+   *
+   * @tparam SolverPolicy the edge solver used in the sweeps, see Blocks::DimensionalSplitting.
+   */
+  template <class SolverPolicy = Solvers::FWaveKernel>
+  class AdaptiveMesh {
+  public:
+    struct Parameters {
+      //! number of levels including the base block
+      int levels{2};
+      //! refinement ratio between two levels, in space and in time
+      int ratio{2};
+      //! patch size in cells of the level below
+      int patchSize{16};
+      //! number of time steps between two regrids, 0 keeps the initial patches
+      int regridInterval{4};
+
+      //! surface elevation at rest and the difference to it above which a cell counts as reached by the wave
+      RealType seaLevel{0.0};
+      RealType waveThreshold{0.05};
+      //! slope of the bathymetry above which the wave front is refined
+      RealType bathymetryGradient{0.05};
+
+      //! tiles within destinationRadius of the destination are refined as soon as the wave reaches them, a negative
+      //! radius disables this criterion
+      RealType destinationX{0.0};
+      RealType destinationY{0.0};
+      RealType destinationRadius{-1.0};
+
+      //! execution mode of the patch blocks
+      ExecutionMode executionMode{ExecutionMode::Buffered};
+    };
+
+    /**
+     * A refined patch: a block together with its position in the hierarchy.
+     */
+    class Patch {
+    public:
+      int                                getLevel() const { return level_; }
+      const std::string&                 getName() const { return name_; }
+      RealType                           getOffsetX() const { return offsetX_; }
+      RealType                           getOffsetY() const { return offsetY_; }
+      RealType                           getDx() const { return dx_; }
+      RealType                           getDy() const { return dy_; }
+      DimensionalSplitting<SolverPolicy>& getBlock() const { return *block_; }
+
+    private:
+      friend class AdaptiveMesh;
+
+      /**
+       * Values of a ghost layer that is interpolated from the level below. The block reads from layer_, which
+       * points to current_, start_ and end_ hold the level below at the start and the end of its time step.
+       */
+      struct GhostLayer {
+        std::array<std::vector<RealType>, 3> current_;
+        std::array<std::vector<RealType>, 3> start_;
+        std::array<std::vector<RealType>, 3> end_;
+        std::unique_ptr<Block1D>             layer_;
+        bool                                 interpolated_{false};
+      };
+
+      int         level_;
+      std::string name_;
+      //! tile of the level below that is refined
+      int tileX_;
+      int tileY_;
+      //! cell (firstX_ + i, firstY_ + j) of the level is cell (i, j) of the block
+      int      firstX_;
+      int      firstY_;
+      int      nx_;
+      int      ny_;
+      RealType offsetX_;
+      RealType offsetY_;
+      RealType dx_;
+      RealType dy_;
+
+      std::unique_ptr<DimensionalSplitting<SolverPolicy>> block_;
+      std::array<std::unique_ptr<Block1D>, 4>              copyLayers_;
+      std::array<GhostLayer, 4>                            ghostLayers_;
+    };
+
+    /**
+     * @param base level 0, already initialised with the scenario.
+     * @param scenario provides the bathymetry of the patches and the boundary types of the domain.
+     * @param offsetX, offsetY, dx, dy origin and mesh size of the base block.
+     *
+     * The initial patches are built from the state of the base block, but with the initial values of the scenario.
+     */
+    AdaptiveMesh(
+      DimensionalSplitting<SolverPolicy>& base,
+      Scenarios::Scenario&                scenario,
+      RealType                            offsetX,
+      RealType                            offsetY,
+      RealType                            dx,
+      RealType                            dy,
+      const Parameters&                   parameters
+    );
+
+    /**
+     * @brief Advances all levels by one time step of level 0 and regrids first if it is due.
+     * @return the time step of level 0
+     */
+    RealType simulateTimeStep();
+
+    /**
+     * @brief Advances all levels by the time step dt of level 0, which has to satisfy the CFL condition of all levels.
+     */
+    void simulateTimeStep(RealType dt);
+
+    /**
+     * @brief Rebuilds the patches of all levels from the current state.
+     */
+    void regrid();
+
+    const Parameters& getParameters() const { return parameters_; }
+
+    /**
+     * @brief All patches, ordered by level.
+     */
+    std::vector<const Patch*> getPatches() const;
+    int                       getPatchCount(int level) const;
+
+    /**
+     * @brief Number of cell updates of all levels so far, and how many a uniform grid at the resolution of the finest
+     * level would have needed for the same time steps.
+     */
+    std::uint64_t getCellUpdates() const { return cellUpdates_; }
+    std::uint64_t getUniformCellUpdates() const { return uniformCellUpdates_; }
+
+  private:
+    using PatchMap = std::map<std::pair<int, int>, std::unique_ptr<Patch>>;
+
+    struct CellState {
+      RealType h;
+      RealType hu;
+      RealType hv;
+      RealType b;
+    };
+
+    DimensionalSplitting<SolverPolicy>& base_;
+    Scenarios::Scenario&                scenario_;
+    const Parameters                    parameters_;
+
+    RealType offsetX_;
+    RealType offsetY_;
+    //! cells and mesh size of every level
+    std::vector<int>      nx_;
+    std::vector<int>      ny_;
+    std::vector<RealType> dx_;
+    std::vector<RealType> dy_;
+
+    //! patches of level l by the tile of level l - 1 they refine, patches_[0] stays empty
+    std::vector<PatchMap> patches_;
+
+    int           steps_{0};
+    std::uint64_t cellUpdates_{0};
+    std::uint64_t uniformCellUpdates_{0};
+
+    int getTileCountX(int level) const { return (nx_[level] + parameters_.patchSize - 1) / parameters_.patchSize; }
+    int getTileCountY(int level) const { return (ny_[level] + parameters_.patchSize - 1) / parameters_.patchSize; }
+
+    //! Regrids if it is due and computes the net updates of level 0.
+    void prepareTimeStep();
+    //! Advances level 0 with the net updates of prepareTimeStep and all finer levels by dt.
+    void advanceLevels(RealType dt);
+
+    /**
+     * @brief Index of the cell of level - 1 that contains cell index of level, ghost cells map to ghost cells.
+     */
+    int getParentIndex(int index, int cells, int parentCells) const;
+
+    /**
+     * @brief Block of level that contains cell (i, j) of the level (a ghost cell of the domain if it is 0 or n + 1),
+     * and the cell in this block. nullptr if the level is not refined there.
+     */
+    DimensionalSplitting<SolverPolicy>* locate(int level, int i, int j, int& o_i, int& o_j) const;
+
+    /**
+     * @brief State of cell (i, j) of level. If the level is not refined there, the state of the cell of the next
+     * coarser level that covers it.
+     */
+    CellState sample(int level, int i, int j) const;
+
+    /**
+     * @brief Values in a cell with bathymetry b of level + 1 that lies in cell (i, j) of level: the same surface
+     * elevation and velocity.
+     */
+    CellState prolongate(int level, int i, int j, RealType b) const;
+
+    /**
+     * @brief Patch of level that refines tile (tileX, tileY) of level - 1, with the initial values of the scenario or
+     * interpolated from level - 1.
+     */
+    std::unique_ptr<Patch> createPatch(int level, int tileX, int tileY, bool fromScenario);
+
+    //! Replaces the patches of level by the flagged tiles of level - 1, keeping the patches that stay.
+    void regridLevel(int level, bool fromScenario);
+
+    //! Connects the edges of all patches of level to their neighbours, the domain boundary or the mesh.
+    void connectPatches(int level);
+
+    //! Interpolates the interpolated ghost layers of the patches of level from level - 1 into o_values.
+    void sampleGhostLayers(int level, std::array<std::vector<RealType>, 3> Patch::GhostLayer::* o_values);
+    //! Sets the current ghost layers of the patches of level to the given fraction of the step of level - 1.
+    void interpolateGhostLayers(int level, RealType fraction);
+
+    //! Advances level by dt and the finer levels by ratio steps each, level 0 uses the net updates of prepareTimeStep.
+    void advanceLevel(int level, RealType dt);
+
+    //! Averages the patches of level onto the cells of level - 1 they cover.
+    void restrictLevel(int level);
+
+    //! Tiles of level that have to be refined on level + 1.
+    std::vector<char> flagTiles(int level);
+  };
+} // namespace Blocks
@@ -34,7 +34,7 @@
 #include "WaveAccumulationBlock.hpp"
 #include "WavePropagationBlock.hpp"
 #elif defined(WITH_SOLVER_RUSANOV)
-#include "Rusanov/RusanovBlock.hpp"
+#include "DimensionalSplitting.h"
 #endif
 #endif
 
@@ -71,7 +71,7 @@ Blocks::Block* Blocks::Block::getBlockInstance(int nx, int ny, RealType dx, Real
   // block = new WaveAccumulationBlock(nx, ny, dx, dy);
   block = new WavePropagationBlock(nx, ny, dx, dy);
 #elif defined(WITH_SOLVER_RUSANOV)
-  block = new Rusanov::RusanovBlock(nx, ny, dx, dy);
+  block = new DimensionalSplitting<Solvers::RusanovKernel>(nx, ny, dx, dy);
 #elif defined(WITH_SOLVER_AUGRIE_SIMD)
 #error "Not implemented yet!"
 #endif
@@ -92,7 +92,7 @@ Blocks::Block* Blocks::Block::getBlockInstance(
   // block = new WaveAccumulationBlock(nx, ny, dx, dy);
   block = new WavePropagationBlock(nx, ny, dx, dy, h, hu, hv);
 #elif defined(WITH_SOLVER_RUSANOV)
-  block = new Rusanov::RusanovBlock(nx, ny, dx, dy);
+  block = new DimensionalSplitting<Solvers::RusanovKernel>(nx, ny, dx, dy);
 #elif defined(WITH_SOLVER_AUGRIE_SIMD)
 #error "Not implemented yet!"
 #endif
@@ -130,9 +130,9 @@ Blocks::Block::Block(
   ny_(ny),
   dx_(dx),
   dy_(dy),
-  h_(h, true),
-  hu_(hu, true),
-  hv_(hv, true),
+  h_(h.getCols(), h.getRows(), h.getData(), h.getStride()),
+  hu_(hu.getCols(), hu.getRows(), hu.getData(), hu.getStride()),
+  hv_(hv.getCols(), hv.getRows(), hv.getData(), hv.getStride()),
   b_(nx + 2, ny + 2),
   maxTimeStep_(0),
   offsetX_(0),
@@ -144,6 +144,26 @@ Blocks::Block::Block(
   }
 }
 
+Blocks::Block::Block(int nx, int ny, RealType dx, RealType dy, const Tools::Float2D<RealType>& b):
+  nx_(nx),
+  ny_(ny),
+  dx_(dx),
+  dy_(dy),
+  h_(nx + 2, ny + 2),
+  hu_(nx + 2, ny + 2),
+  hv_(nx + 2, ny + 2),
+  b_(b.getCols(), b.getRows(), const_cast<RealType*>(b.getData()), b.getStride()),
+  maxTimeStep_(0),
+  offsetX_(0),
+  offsetY_(0),
+  sharedBathymetry_(true) {
+
+  for (int i = 0; i < 4; i++) {
+    boundary_[i]  = BoundaryType::Passive;
+    neighbour_[i] = nullptr;
+  }
+}
+
 void Blocks::Block::initialiseScenario(
   RealType offsetX, RealType offsetY, Scenarios::Scenario& scenario, const bool useMultipleBlocks
 ) {
@@ -162,10 +182,43 @@ void Blocks::Block::initialiseScenario(
     }
   }
 
-  // Initialize bathymetry
-  for (int j = 1; j <= ny_; j++) {
-    for (int i = 1; i <= nx_; i++) {
-      b_[i][j] = scenario.getBathymetry(offsetX + (i - RealType(0.5)) * dx_, offsetY + (j - RealType(0.5f)) * dy_);
+  initialiseBathymetry(offsetX, offsetY, scenario, useMultipleBlocks);
+
+  // Perform update after external write to variables
+  synchAfterWrite();
+}
+
+void Blocks::Block::initialiseBathymetry(
+  RealType offsetX, RealType offsetY, Scenarios::Scenario& scenario, const bool useMultipleBlocks
+) {
+  offsetX_ = offsetX;
+  offsetY_ = offsetY;
+
+  // Initialize bathymetry, a shared one is already there
+  if (!sharedBathymetry_) {
+    for (int j = 1; j <= ny_; j++) {
+      for (int i = 1; i <= nx_; i++) {
+        b_[i][j] = scenario.getBathymetry(offsetX + (i - RealType(0.5)) * dx_, offsetY + (j - RealType(0.5f)) * dy_);
+      }
+    }
+
+    // Ghost cells inside the domain belong to a neighbouring block, which has the same bathymetry there. The ghost
+    // layers at the boundary of the domain are set with the boundary types by the calling routine.
+    if (useMultipleBlocks) {
+      const RealType left   = scenario.getBoundaryPos(BoundaryEdge::Left);
+      const RealType right  = scenario.getBoundaryPos(BoundaryEdge::Right);
+      const RealType bottom = scenario.getBoundaryPos(BoundaryEdge::Bottom);
+      const RealType top    = scenario.getBoundaryPos(BoundaryEdge::Top);
+      for (int j = 0; j <= ny_ + 1; j++) {
+        for (int i = 0; i <= nx_ + 1; i++) {
+          const RealType x = offsetX + (i - RealType(0.5)) * dx_;
+          const RealType y = offsetY + (j - RealType(0.5)) * dy_;
+          const bool     ghost = i == 0 || i == nx_ + 1 || j == 0 || j == ny_ + 1;
+          if (ghost && x > left && x < right && y > bottom && y < top) {
+            b_[i][j] = scenario.getBathymetry(x, y);
+          }
+        }
+      }
     }
   }
 
@@ -178,8 +231,7 @@ void Blocks::Block::initialiseScenario(
     setBoundaryType(BoundaryEdge::Top, scenario.getBoundaryType(BoundaryEdge::Top));
   }
 
-  // Perform update after external write to variables
-  synchAfterWrite();
+  synchBathymetryAfterWrite();
 }
 
 void Blocks::Block::setWaterHeight(RealType (*h)(RealType, RealType)) {
@@ -250,6 +302,43 @@ void Blocks::Block::simulateTimeStep(RealType dt) {
   updateUnknowns(dt);
 }
 
+void Blocks::Block::saveUnknowns() {
+  synchWaterHeightBeforeRead();
+  synchDischargeBeforeRead();
+
+  const size_t column = ny_ + 2;
+  savedUnknowns_.resize(3 * (nx_ + 2) * column);
+  RealType* saved = savedUnknowns_.data();
+  for (int i = 0; i <= nx_ + 1; i++) {
+    std::memcpy(saved, h_[i], sizeof(RealType) * column);
+    std::memcpy(saved + column, hu_[i], sizeof(RealType) * column);
+    std::memcpy(saved + 2 * column, hv_[i], sizeof(RealType) * column);
+    saved += 3 * column;
+  }
+}
+
+void Blocks::Block::restoreUnknowns() {
+  assert(!savedUnknowns_.empty());
+
+  const size_t    column = ny_ + 2;
+  const RealType* saved  = savedUnknowns_.data();
+  for (int i = 0; i <= nx_ + 1; i++) {
+    std::memcpy(h_[i], saved, sizeof(RealType) * column);
+    std::memcpy(hu_[i], saved + column, sizeof(RealType) * column);
+    std::memcpy(hv_[i], saved + 2 * column, sizeof(RealType) * column);
+    saved += 3 * column;
+  }
+
+  synchWaterHeightAfterWrite();
+  synchDischargeAfterWrite();
+}
+
+void Blocks::Block::computeNumericalFluxesInterior() {}
+
+void Blocks::Block::computeNumericalFluxesBoundary() { computeNumericalFluxes(); }
+
+int Blocks::Block::getHaloTimeSteps(int haloWidth) const { return haloWidth; }
+
 RealType Blocks::Block::simulate(RealType tStart, RealType tEnd) {
   RealType t = tStart;
   do {
@@ -269,14 +358,20 @@ void Blocks::Block::setBoundaryType(BoundaryEdge edge, BoundaryType boundaryType
   boundary_[edge]  = boundaryType;
   neighbour_[edge] = inflow;
 
-  if (boundaryType == BoundaryType::Outflow || boundaryType == BoundaryType::Wall) {
-    // One of the boundary was changed to BoundaryType::Outflow or BoundaryType::Wall
+  if (boundaryType == BoundaryType::Outflow || boundaryType == BoundaryType::Wall || boundaryType == BoundaryType::Periodic) {
+    // One of the boundary was changed to BoundaryType::Outflow, BoundaryType::Wall or BoundaryType::Periodic
     // -> Update the bathymetry for this boundary
     setBoundaryBathymetry();
   }
 }
 
 void Blocks::Block::setBoundaryBathymetry() {
+  // The owner of a shared bathymetry sets its ghost layer
+  if (sharedBathymetry_) {
+    synchBathymetryAfterWrite();
+    return;
+  }
+
   // Set bathymetry values in the ghost layer, if necessary
   if (boundary_[BoundaryEdge::Left] == BoundaryType::Outflow || boundary_[BoundaryEdge::Left] == BoundaryType::Wall) {
     std::memcpy(b_[0], b_[1], sizeof(RealType) * (ny_ + 2));
@@ -295,41 +390,63 @@ void Blocks::Block::setBoundaryBathymetry() {
     }
   }
 
-  // Set corner values
-  b_[0][0]             = b_[1][1];
-  b_[0][ny_ + 1]       = b_[1][ny_];
-  b_[nx_ + 1][0]       = b_[nx_][1];
-  b_[nx_ + 1][ny_ + 1] = b_[nx_][ny_];
+  // Periodic boundaries see the bathymetry of the opposite edge
+  if (boundary_[BoundaryEdge::Left] == BoundaryType::Periodic) {
+    std::memcpy(b_[0], b_[nx_], sizeof(RealType) * (ny_ + 2));
+  }
+  if (boundary_[BoundaryEdge::Right] == BoundaryType::Periodic) {
+    std::memcpy(b_[nx_ + 1], b_[1], sizeof(RealType) * (ny_ + 2));
+  }
+  if (boundary_[BoundaryEdge::Bottom] == BoundaryType::Periodic) {
+    for (int i = 0; i <= nx_ + 1; i++) {
+      b_[i][0] = b_[i][ny_];
+    }
+  }
+  if (boundary_[BoundaryEdge::Top] == BoundaryType::Periodic) {
+    for (int i = 0; i <= nx_ + 1; i++) {
+      b_[i][ny_ + 1] = b_[i][1];
+    }
+  }
+
+  // Set corner values, across a periodic boundary they come from the opposite side like in setBoundaryConditions
+  const int leftFrom   = boundary_[BoundaryEdge::Left] == BoundaryType::Periodic ? nx_ : 1;
+  const int rightFrom  = boundary_[BoundaryEdge::Right] == BoundaryType::Periodic ? 1 : nx_;
+  const int bottomFrom = boundary_[BoundaryEdge::Bottom] == BoundaryType::Periodic ? ny_ : 1;
+  const int topFrom    = boundary_[BoundaryEdge::Top] == BoundaryType::Periodic ? 1 : ny_;
+  b_[0][0]             = b_[leftFrom][bottomFrom];
+  b_[0][ny_ + 1]       = b_[leftFrom][topFrom];
+  b_[nx_ + 1][0]       = b_[rightFrom][bottomFrom];
+  b_[nx_ + 1][ny_ + 1] = b_[rightFrom][topFrom];
 
   // Synchronize after an external update of the bathymetry
   synchBathymetryAfterWrite();
 }
 
-Blocks::Block1D* Blocks::Block::registerCopyLayer(BoundaryEdge edge) {
+Blocks::Block1D* Blocks::Block::registerCopyLayer(BoundaryEdge edge, int depth) {
   switch (edge) {
   case BoundaryEdge::Left:
-    return new Block1D(h_.getColProxy(1), hu_.getColProxy(1), hv_.getColProxy(1));
+    return new Block1D(h_.getColProxy(1 + depth), hu_.getColProxy(1 + depth), hv_.getColProxy(1 + depth));
   case BoundaryEdge::Right:
-    return new Block1D(h_.getColProxy(nx_), hu_.getColProxy(nx_), hv_.getColProxy(nx_));
+    return new Block1D(h_.getColProxy(nx_ - depth), hu_.getColProxy(nx_ - depth), hv_.getColProxy(nx_ - depth));
   case BoundaryEdge::Bottom:
-    return new Block1D(h_.getRowProxy(1), hu_.getRowProxy(1), hv_.getRowProxy(1));
+    return new Block1D(h_.getRowProxy(1 + depth), hu_.getRowProxy(1 + depth), hv_.getRowProxy(1 + depth));
   case BoundaryEdge::Top:
-    return new Block1D(h_.getRowProxy(ny_), hu_.getRowProxy(ny_), hv_.getRowProxy(ny_));
+    return new Block1D(h_.getRowProxy(ny_ - depth), hu_.getRowProxy(ny_ - depth), hv_.getRowProxy(ny_ - depth));
   };
   return nullptr;
 }
 
-Blocks::Block1D* Blocks::Block::grabGhostLayer(BoundaryEdge edge) {
+Blocks::Block1D* Blocks::Block::grabGhostLayer(BoundaryEdge edge, int depth) {
   boundary_[edge] = BoundaryType::Passive;
   switch (edge) {
   case BoundaryEdge::Left:
-    return new Block1D(h_.getColProxy(0), hu_.getColProxy(0), hv_.getColProxy(0));
+    return new Block1D(h_.getColProxy(depth), hu_.getColProxy(depth), hv_.getColProxy(depth));
   case BoundaryEdge::Right:
-    return new Block1D(h_.getColProxy(nx_ + 1), hu_.getColProxy(nx_ + 1), hv_.getColProxy(nx_ + 1));
+    return new Block1D(h_.getColProxy(nx_ + 1 - depth), hu_.getColProxy(nx_ + 1 - depth), hv_.getColProxy(nx_ + 1 - depth));
   case BoundaryEdge::Bottom:
-    return new Block1D(h_.getRowProxy(0), hu_.getRowProxy(0), hv_.getRowProxy(0));
+    return new Block1D(h_.getRowProxy(depth), hu_.getRowProxy(depth), hv_.getRowProxy(depth));
   case BoundaryEdge::Top:
-    return new Block1D(h_.getRowProxy(ny_ + 1), hu_.getRowProxy(ny_ + 1), hv_.getRowProxy(ny_ + 1));
+    return new Block1D(h_.getRowProxy(ny_ + 1 - depth), hu_.getRowProxy(ny_ + 1 - depth), hv_.getRowProxy(ny_ + 1 - depth));
   };
   return nullptr;
 }
@@ -472,6 +589,14 @@ void Blocks::Block::setBoundaryConditions() {
     };
     break;
   }
+  case BoundaryType::Periodic: {
+    for (int j = 1; j <= ny_; j++) {
+      h_[0][j]  = h_[nx_][j];
+      hu_[0][j] = hu_[nx_][j];
+      hv_[0][j] = hv_[nx_][j];
+    };
+    break;
+  }
   case BoundaryType::Connect:
   case BoundaryType::Passive:
     break;
@@ -498,6 +623,14 @@ void Blocks::Block::setBoundaryConditions() {
     };
     break;
   }
+  case BoundaryType::Periodic: {
+    for (int j = 1; j <= ny_; j++) {
+      h_[nx_ + 1][j]  = h_[1][j];
+      hu_[nx_ + 1][j] = hu_[1][j];
+      hv_[nx_ + 1][j] = hv_[1][j];
+    };
+    break;
+  }
   case BoundaryType::Connect:
   case BoundaryType::Passive:
     break;
@@ -524,6 +657,14 @@ void Blocks::Block::setBoundaryConditions() {
     };
     break;
   }
+  case BoundaryType::Periodic: {
+    for (int i = 1; i <= nx_; i++) {
+      h_[i][0]  = h_[i][ny_];
+      hu_[i][0] = hu_[i][ny_];
+      hv_[i][0] = hv_[i][ny_];
+    };
+    break;
+  }
   case BoundaryType::Connect:
   case BoundaryType::Passive:
     break;
@@ -550,6 +691,14 @@ void Blocks::Block::setBoundaryConditions() {
     };
     break;
   }
+  case BoundaryType::Periodic: {
+    for (int i = 1; i <= nx_; i++) {
+      h_[i][ny_ + 1]  = h_[i][1];
+      hu_[i][ny_ + 1] = hu_[i][1];
+      hv_[i][ny_ + 1] = hv_[i][1];
+    };
+    break;
+  }
   case BoundaryType::Connect:
   case BoundaryType::Passive:
     break;
@@ -583,22 +732,30 @@ void Blocks::Block::setBoundaryConditions() {
    *                  *            *           *
    *                  **************************
    * </pre>
+   *
+   * Across a periodic boundary the corner takes the cell from the opposite side instead, as does the bathymetry in
+   * setBoundaryBathymetry.
    */
-  h_[0][0]  = h_[1][1];
-  hu_[0][0] = hu_[1][1];
-  hv_[0][0] = hv_[1][1];
-
-  h_[0][ny_ + 1]  = h_[1][ny_];
-  hu_[0][ny_ + 1] = hu_[1][ny_];
-  hv_[0][ny_ + 1] = hv_[1][ny_];
-
-  h_[nx_ + 1][0]  = h_[nx_][1];
-  hu_[nx_ + 1][0] = hu_[nx_][1];
-  hv_[nx_ + 1][0] = hv_[nx_][1];
-
-  h_[nx_ + 1][ny_ + 1]  = h_[nx_][ny_];
-  hu_[nx_ + 1][ny_ + 1] = hu_[nx_][ny_];
-  hv_[nx_ + 1][ny_ + 1] = hv_[nx_][ny_];
+  const int leftFrom   = boundary_[BoundaryEdge::Left] == BoundaryType::Periodic ? nx_ : 1;
+  const int rightFrom  = boundary_[BoundaryEdge::Right] == BoundaryType::Periodic ? 1 : nx_;
+  const int bottomFrom = boundary_[BoundaryEdge::Bottom] == BoundaryType::Periodic ? ny_ : 1;
+  const int topFrom    = boundary_[BoundaryEdge::Top] == BoundaryType::Periodic ? 1 : ny_;
+
+  h_[0][0]  = h_[leftFrom][bottomFrom];
+  hu_[0][0] = hu_[leftFrom][bottomFrom];
+  hv_[0][0] = hv_[leftFrom][bottomFrom];
+
+  h_[0][ny_ + 1]  = h_[leftFrom][topFrom];
+  hu_[0][ny_ + 1] = hu_[leftFrom][topFrom];
+  hv_[0][ny_ + 1] = hv_[leftFrom][topFrom];
+
+  h_[nx_ + 1][0]  = h_[rightFrom][bottomFrom];
+  hu_[nx_ + 1][0] = hu_[rightFrom][bottomFrom];
+  hv_[nx_ + 1][0] = hv_[rightFrom][bottomFrom];
+
+  h_[nx_ + 1][ny_ + 1]  = h_[rightFrom][topFrom];
+  hu_[nx_ + 1][ny_ + 1] = hu_[rightFrom][topFrom];
+  hv_[nx_ + 1][ny_ + 1] = hv_[rightFrom][topFrom];
 }
 
 int Blocks::Block::getNx() const { return nx_; }
@@ -36,6 +36,8 @@
 #include "Tools/Float2D.hpp"
 #include "Tools/RealType.hpp"
 
+#include <vector>
+
 namespace Blocks {
   /**
    * Blocks::Block1D is a simple struct that can represent a single line or row of
@@ -160,6 +162,12 @@ namespace Blocks {
     RealType offsetX_; ///< x-coordinate of the origin (left-bottom corner) of the Cartesian grid
     RealType offsetY_; ///< y-coordinate of the origin (left-bottom corner) of the Cartesian grid
 
+    /// b_ views the bathymetry of another block, which sets it up and owns it
+    bool sharedBathymetry_{false};
+
+    /// h, hu and hv of all cells as of the last saveUnknowns, column by column
+    std::vector<RealType> savedUnknowns_;
+
     /**
      * Constructor: allocate variables for simulation
      *
@@ -171,6 +179,9 @@ namespace Blocks {
      * The constructor is protected: no instances of Blocks::Block can be
      * generated.
      *
+     * The second variant works directly on the memory of h, hu and hv, which have to outlive the block.
+     * The third variant reads the bathymetry b of another block (including its ghost layer) and never writes it,
+     * so initialiseScenario and the boundary types leave it alone. b has to outlive the block.
      */
     Block(int nx, int ny, RealType dx, RealType dy);
     Block(
@@ -179,14 +190,19 @@ namespace Blocks {
       Tools::Float2D<RealType>& hu,
       Tools::Float2D<RealType>& hv
     );
+    Block(int nx, int ny, RealType dx, RealType dy, const Tools::Float2D<RealType>& b);
     
     /**
-     * Sets the bathymetry on BoundaryType::Outflow or BoundaryType::Wall.
-     * Should be called very time a boundary is changed to a BoundaryType::Outflow or
-     * BoundaryType::Wall <b>or</b> the bathymetry changes.
+     * Sets the bathymetry on BoundaryType::Outflow, BoundaryType::Wall or BoundaryType::Periodic.
+     * Should be called very time a boundary is changed to a BoundaryType::Outflow,
+     * BoundaryType::Wall or BoundaryType::Periodic <b>or</b> the bathymetry changes.
      */
     void setBoundaryBathymetry();
 
+    /// Whether the left and right (bottom and top) boundaries are both BoundaryType::Periodic
+    bool isPeriodicX() const { return boundary_[BoundaryEdge::Left] == BoundaryType::Periodic && boundary_[BoundaryEdge::Right] == BoundaryType::Periodic; }
+    bool isPeriodicY() const { return boundary_[BoundaryEdge::Bottom] == BoundaryType::Periodic && boundary_[BoundaryEdge::Top] == BoundaryType::Periodic; }
+
     // Synchronization Methods
     /**
      * Updates all temporary and non-local (for heterogeneous computing) variables
@@ -219,6 +235,7 @@ namespace Blocks {
      * Sets the values of all ghost cells depending on the specifed
      * boundary conditions
      * - set boundary conditions for types BoundaryType::Wall and BoundaryType::Outflow
+     * - copy the opposite edge of the block for BoundaryType::Periodic
      * - derived classes need to transfer ghost layers
      */
     virtual void setBoundaryConditions();
@@ -253,6 +270,14 @@ namespace Blocks {
       RealType offsetX, RealType offsetY, Scenarios::Scenario& scenario, const bool useMultipleBlocks = false
     );
 
+    /**
+     * Initialises only the bathymetry (and for a single block the boundary conditions) like initialiseScenario, so
+     * the scenario is not asked for the water height, which reads the bathymetry again in the file scenarios.
+     */
+    void initialiseBathymetry(
+      RealType offsetX, RealType offsetY, Scenarios::Scenario& scenario, const bool useMultipleBlocks = false
+    );
+
     /// Sets the water height according to a given function
     /**
      * Sets water height h in all interior grid cells (i.e. except ghost layer)
@@ -304,9 +329,10 @@ namespace Blocks {
     /**
      * Registers the row or column layer next to a boundary as a "copy layer",
      * from which values will be copied into the ghost layer or a neighbour;
+     * @param depth number of layers further inside the block, for a halo that is wider than the ghost layer.
      * @return a Blocks::Block1D object that contains row variables h, hu, and hv.
      */
-    virtual Block1D* registerCopyLayer(BoundaryEdge edge);
+    virtual Block1D* registerCopyLayer(BoundaryEdge edge, int depth = 0);
 
     /**
      * "Grab" the ghost layer at the specific boundary in order to set boundary values
@@ -315,10 +341,13 @@ namespace Blocks {
      * such that the grabbing program component is responsible to provide correct
      * values in the ghost layer, for example by receiving data from a remote
      * copy layer via MPI communication.
+     * With a depth > 0, the returned layer lies inside the block: the block still updates it, but the grabbing
+     * program component overwrites it with the values of a neighbour, for a halo that is wider than the ghost layer.
      * @param specified edge.
+     * @param depth number of layers inside the ghost layer.
      * @return a Blocks::Block1D object that contains row variables h, hu, and hv.
      */
-    virtual Block1D* grabGhostLayer(BoundaryEdge edge);
+    virtual Block1D* grabGhostLayer(BoundaryEdge edge, int depth = 0);
 
     /**
      * Sets the values of all ghost cells depending on the specifed
@@ -345,6 +374,15 @@ namespace Blocks {
     /// Executes a single time step (with fixed time step size) of the simulation
     virtual void simulateTimeStep(RealType dt);
 
+    /// Saves the unknowns h, hu and hv of all cells, including the ghost layer
+    void saveUnknowns();
+
+    /// Restores the unknowns of the last saveUnknowns, e.g. to repeat a time step with a smaller time step width
+    /**
+     * The net updates are not restored: computeNumericalFluxes has to be called again before updateUnknowns.
+     */
+    void restoreUnknowns();
+
     /// Performs the simulation starting with simulation time tStart, until simulation time tEnd is reached
     /**
      * Implements the main simulation loop between two checkpoints;
@@ -366,6 +404,24 @@ namespace Blocks {
      */
     virtual void computeNumericalFluxes() = 0;
 
+    /// Computes the numerical fluxes in two phases, such that the ghost layer can be exchanged in between
+    /**
+     * computeNumericalFluxesInterior computes the edges that do not touch the ghost layer,
+     * computeNumericalFluxesBoundary the remaining ones and the maximum time step.
+     * Together they give the same net updates and time step as computeNumericalFluxes.
+     * By default, the interior phase does nothing and the boundary phase computes all edges.
+     */
+    virtual void computeNumericalFluxesInterior();
+    virtual void computeNumericalFluxesBoundary();
+
+    /// Returns the number of time steps between two exchanges of a halo of the given width
+    /**
+     * A halo of width k is the ghost layer and the k - 1 layers of the block next to it, which are received from a
+     * neighbour and computed redundantly, see Blocks::HaloExchange. By default, every time step invalidates one layer.
+     * @param haloWidth number of layers of the halo.
+     */
+    virtual int getHaloTimeSteps(int haloWidth) const;
+
     /// Computes the new values of the unknowns h, hu, and hv in all grid cells
     /**
      * Based on the numerical fluxes (computed by computeNumericalFluxes)
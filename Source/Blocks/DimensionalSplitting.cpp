@@ -1,24 +1,87 @@
 #include "DimensionalSplitting.h"
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
 #if defined(ENABLE_OPENMP)
   #include <omp.h>
 #endif
 
-Blocks::DimensionalSplitting::DimensionalSplitting(int nx, int ny, RealType dx, RealType dy):
+template <class SolverPolicy>
+Blocks::DimensionalSplitting<SolverPolicy>::DimensionalSplitting(int nx, int ny, RealType dx, RealType dy, ExecutionMode executionMode):
   Block(nx, ny, dx, dy),
-  hNetUpdatesXLeft_(nx + 1, ny),
-  hNetUpdatesXRight_(nx + 1, ny),
-  huNetUpdatesXLeft_(nx + 1, ny),
-  huNetUpdatesXRight_(nx + 1, ny),
-  hNetUpdatesYLeft_(nx, ny + 1),
-  hNetUpdatesYRight_(nx, ny + 1),
-  hvNetUpdatesYLeft_(nx, ny + 1),
-  hvNetUpdatesYRight_(nx, ny + 1) {}
+  hNetUpdatesXLeft_(nx + 1, ny + 1, executionMode != ExecutionMode::Fused),
+  hNetUpdatesXRight_(nx + 1, ny + 1, executionMode != ExecutionMode::Fused),
+  huNetUpdatesXLeft_(nx + 1, ny + 1, executionMode != ExecutionMode::Fused),
+  huNetUpdatesXRight_(nx + 1, ny + 1, executionMode != ExecutionMode::Fused),
+  hNetUpdatesYLeft_(nx + 1, ny + 1, executionMode != ExecutionMode::Fused),
+  hNetUpdatesYRight_(nx + 1, ny + 1, executionMode != ExecutionMode::Fused),
+  hvNetUpdatesYLeft_(nx + 1, ny + 1, executionMode != ExecutionMode::Fused),
+  hvNetUpdatesYRight_(nx + 1, ny + 1, executionMode != ExecutionMode::Fused),
+  executionMode_(executionMode) {
+  firstTouch();
 
+  // The water height is not initialised yet, the mask is built in synchWaterHeightAfterWrite
+  wetMask_.setAllWet(nx, ny);
+  activityMap_.setAllActive(nx, ny);
+}
 
-void Blocks::DimensionalSplitting::computeNumericalFluxes() {
-  RealType maxWaveSpeedX{0.0};
-  RealType maxWaveSpeedY{0.0};
+template <class SolverPolicy>
+Blocks::DimensionalSplitting<SolverPolicy>::DimensionalSplitting(
+  int nx, int ny, RealType dx, RealType dy, const Tools::Float2D<RealType>& b, ExecutionMode executionMode
+):
+  Block(nx, ny, dx, dy, b),
+  hNetUpdatesXLeft_(nx + 1, ny + 1, executionMode != ExecutionMode::Fused),
+  hNetUpdatesXRight_(nx + 1, ny + 1, executionMode != ExecutionMode::Fused),
+  huNetUpdatesXLeft_(nx + 1, ny + 1, executionMode != ExecutionMode::Fused),
+  huNetUpdatesXRight_(nx + 1, ny + 1, executionMode != ExecutionMode::Fused),
+  hNetUpdatesYLeft_(nx + 1, ny + 1, executionMode != ExecutionMode::Fused),
+  hNetUpdatesYRight_(nx + 1, ny + 1, executionMode != ExecutionMode::Fused),
+  hvNetUpdatesYLeft_(nx + 1, ny + 1, executionMode != ExecutionMode::Fused),
+  hvNetUpdatesYRight_(nx + 1, ny + 1, executionMode != ExecutionMode::Fused),
+  executionMode_(executionMode) {
+  firstTouch();
+
+  wetMask_.setAllWet(nx, ny);
+  activityMap_.setAllActive(nx, ny);
+}
 
+template <class SolverPolicy>
+void Blocks::DimensionalSplitting<SolverPolicy>::firstTouch() {
+  Tools::Float2D<RealType>* arrays[] = {
+    &h_,
+    &hu_,
+    &hv_,
+    &b_,
+    &hNetUpdatesXLeft_,
+    &hNetUpdatesXRight_,
+    &huNetUpdatesXLeft_,
+    &huNetUpdatesXRight_,
+    &hNetUpdatesYLeft_,
+    &hNetUpdatesYRight_,
+    &hvNetUpdatesYLeft_,
+    &hvNetUpdatesYRight_};
+
+  // Column i of every array is swept together with the cells of column i
+#if defined(ENABLE_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+  for (int i = 0; i <= nx_ + 1; ++i) {
+    for (Tools::Float2D<RealType>* array : arrays) {
+      // A shared bathymetry is already written
+      if (array == &b_ && sharedBathymetry_) {
+        continue;
+      }
+      if (array->getData() != nullptr && i < array->getCols()) {
+        std::fill_n((*array)[i], array->getRows(), RealType(0.0));
+      }
+    }
+  }
+}
+
+
+template <class SolverPolicy>
+void Blocks::DimensionalSplitting<SolverPolicy>::computeNumericalFluxes() {
   /** Calculate the net-updates for the x-stride by iterating over the cells on the x-stride
    * Cells on the boundary are ghost cells and are not updated, but one net update is needed for the neighbouring cell.
    * Layout
@@ -29,119 +92,532 @@ void Blocks::DimensionalSplitting::computeNumericalFluxes() {
    * Q0,0   Q1,0   Q2,0   Q3,0   Q4,0  updates = |
    */
 
+  /** Calculate the net-updates for the y-stride by iterating over the cells on the y-stride
+   * Cells on the boundary are ghost cells and are not updated, but one net update is needed for the neighbouring cell.
+   * Layout
+   * Q0,4 Q1,4 Q2,4 Q3,4 Q4,4
+   *      --------------
+   * Q0,3 Q1,3 Q2,3 Q3,3 Q4,3
+   *      --------------
+   * Q0,2 Q1,2 Q2,2 Q3,2 Q4,2
+   *      --------------
+   * Q0,1 Q1,1 Q2,1 Q3,1 Q4,1
+   *      --------------       Qi,j
+   * Q0,0 Q1,0 Q2,0 Q3,0 Q4,0  updates = --------------
+   */
+
+  updateActivityMap();
+  reserveThreadStorage();
+  const SweepRanges ranges = getSweepRanges();
+
 #if defined(ENABLE_OPENMP)
-#pragma omp parallel for reduction(max : maxWaveSpeedX), schedule(dynamic)
+#pragma omp parallel
 #endif
-    for (int i = 0; i <= nx_; ++i) {
-      for (int j = 1; j <= ny_; ++j) {
-        RealType maxEdgeSpeed{0.0};
+  computeNumericalFluxesInRegion(ranges);
+}
 
-        fWaveSolver_.computeNetUpdates(
-          h_[i][j],
-          h_[i + 1][j],
-          hu_[i][j],
-          hu_[i + 1][j],
-          b_[i][j],
-          b_[i + 1][j],
-          hNetUpdatesXLeft_[i][j],
-          hNetUpdatesXRight_[i][j],
-          huNetUpdatesXLeft_[i][j],
-          huNetUpdatesXRight_[i][j],
-          maxEdgeSpeed
-        );
+template <class SolverPolicy>
+void Blocks::DimensionalSplitting<SolverPolicy>::computeNumericalFluxesInterior() {
+  // The other modes compute the net updates of a tile or a column from both sides at once
+  if (executionMode_ != ExecutionMode::Buffered || activeTileSize_ > 0) {
+    return;
+  }
 
+  updateActivityMap();
+  reserveThreadStorage();
+  const SweepRanges ranges = getSweepRanges();
+  const Range&      x      = ranges.xEdges;
+  const Range&      y      = ranges.yEdges;
+
+  // Without the x-edges to the ghost columns and the y-edges to the ghost rows
+  RealType maxWaveSpeedX{0.0};
+  RealType maxWaveSpeedY{0.0};
 #if defined(ENABLE_OPENMP)
-        maxWaveSpeedX = std::max(maxWaveSpeedX, maxEdgeSpeed);
-#else
-      // Update the maximum wave speed
-      maxWaveSpeedX = std::max(maxWaveSpeedX, maxEdgeSpeed);
+#pragma omp parallel reduction(max : maxWaveSpeedX, maxWaveSpeedY)
 #endif
-      }
+  {
+    maxWaveSpeedX = computeNetUpdatesX(std::max(x.iBegin, 1), std::min(x.iEnd, nx_ - 1), x.jBegin, x.jEnd);
+    maxWaveSpeedY = computeNetUpdatesY(y.iBegin, y.iEnd, std::max(y.jBegin, 1), std::min(y.jEnd, ny_ - 1));
+  }
+  interiorWaveSpeeds_ = {maxWaveSpeedX, maxWaveSpeedY};
+}
+
+template <class SolverPolicy>
+void Blocks::DimensionalSplitting<SolverPolicy>::computeNumericalFluxesBoundary() {
+  if (executionMode_ != ExecutionMode::Buffered || activeTileSize_ > 0) {
+    computeNumericalFluxes();
+    return;
+  }
+
+  reserveThreadStorage();
+  const SweepRanges ranges = getSweepRanges();
+  const Range&      x      = ranges.xEdges;
+  const Range&      y      = ranges.yEdges;
+
+#if defined(ENABLE_OPENMP)
+#pragma omp parallel
+#endif
+  {
+    RealType maxWaveSpeedX = interiorWaveSpeeds_.x;
+    RealType maxWaveSpeedY = interiorWaveSpeeds_.y;
+    maxWaveSpeedX          = std::max(maxWaveSpeedX, computeNetUpdatesX(x.iBegin, std::min(x.iEnd, 0), x.jBegin, x.jEnd));
+    maxWaveSpeedX          = std::max(maxWaveSpeedX, computeNetUpdatesX(std::max(x.iBegin, nx_), x.iEnd, x.jBegin, x.jEnd));
+    maxWaveSpeedY          = std::max(maxWaveSpeedY, computeNetUpdatesY(y.iBegin, y.iEnd, y.jBegin, std::min(y.jEnd, 0)));
+    maxWaveSpeedY          = std::max(maxWaveSpeedY, computeNetUpdatesY(y.iBegin, y.iEnd, std::max(y.jBegin, ny_), y.jEnd));
+    reduceMaxTimeStep(maxWaveSpeedX, maxWaveSpeedY);
+  }
+}
+
+template <class SolverPolicy>
+int Blocks::DimensionalSplitting<SolverPolicy>::getHaloTimeSteps(int haloWidth) const {
+  return executionMode_ == ExecutionMode::Fused ? std::max(haloWidth - 1, 1) : Block::getHaloTimeSteps(haloWidth);
+}
+
+template <class SolverPolicy>
+void Blocks::DimensionalSplitting<SolverPolicy>::updateUnknowns(RealType dt) {
+  reserveThreadStorage();
+  const SweepRanges ranges = getSweepRanges();
+
+#if defined(ENABLE_OPENMP)
+#pragma omp parallel
+#endif
+  updateUnknownsInRegion(dt, ranges);
+}
+
+template <class SolverPolicy>
+void Blocks::DimensionalSplitting<SolverPolicy>::simulateTimeStep(RealType dt) {
+  updateActivityMap();
+  reserveThreadStorage();
+  const SweepRanges ranges = getSweepRanges();
+
+#if defined(ENABLE_OPENMP)
+#pragma omp parallel
+#endif
+  {
+    if (executionMode_ == ExecutionMode::TaskGraph) {
+      // The time step is known, so the updates do not have to wait for the reduction
+      RealType maxWaveSpeedX{0.0};
+      RealType maxWaveSpeedY{0.0};
+      runTileTasks(ranges, true, true, dt, maxWaveSpeedX, maxWaveSpeedY);
+      reduceMaxTimeStep(maxWaveSpeedX, maxWaveSpeedY);
+    } else {
+      computeNumericalFluxesInRegion(ranges);
+      updateUnknownsInRegion(dt, ranges);
     }
+  }
+}
+
+template <class SolverPolicy>
+RealType Blocks::DimensionalSplitting<SolverPolicy>::simulateTimeStep() {
+  updateActivityMap();
+  reserveThreadStorage();
+  const SweepRanges ranges = getSweepRanges();
+
+#if defined(ENABLE_OPENMP)
+#pragma omp parallel
+#endif
+  {
+    computeNumericalFluxesInRegion(ranges);
+    updateUnknownsInRegion(maxTimeStep_, ranges);
+  }
+  return maxTimeStep_;
+}
+
+template <class SolverPolicy>
+typename Blocks::DimensionalSplitting<SolverPolicy>::SweepRanges Blocks::DimensionalSplitting<SolverPolicy>::getSweepRanges() const {
+  return {{0, nx_, 1, ny_}, {1, nx_, 0, ny_}, {1, nx_, 1, ny_}, {1, nx_, 1, ny_}};
+}
+
+template <class SolverPolicy>
+void Blocks::DimensionalSplitting<SolverPolicy>::computeNumericalFluxesInRegion(const SweepRanges& ranges) {
+  RealType maxWaveSpeedX{0.0};
+  RealType maxWaveSpeedY{0.0};
+
+  // The x- and y-sweep are independent, the threads only wait for each other in the reduction of the time step
+  if (executionMode_ == ExecutionMode::Fused) {
+    // Only the time step is needed here, the net updates are computed again in updateUnknowns
+    maxWaveSpeedX = computeMaxWaveSpeedX(ranges.xEdges.iBegin, ranges.xEdges.iEnd, ranges.xEdges.jBegin, ranges.xEdges.jEnd);
+    maxWaveSpeedY = computeMaxWaveSpeedY(ranges.yEdges.iBegin, ranges.yEdges.iEnd, ranges.yEdges.jBegin, ranges.yEdges.jEnd);
+  } else if (executionMode_ == ExecutionMode::Tiled) {
+    computeNetUpdatesTiled(ranges.xEdges, ranges.yEdges, maxWaveSpeedX, maxWaveSpeedY);
+  } else if (executionMode_ == ExecutionMode::TaskGraph) {
+    runTileTasks(ranges, true, false, 0.0, maxWaveSpeedX, maxWaveSpeedY);
+  } else if (executionMode_ == ExecutionMode::LocalTimeStepping) {
+    // The net updates are computed step by step in updateUnknowns
+    computeTimeStepLevels(ranges);
+    return;
+  } else {
+    maxWaveSpeedX = computeNetUpdatesX(ranges.xEdges.iBegin, ranges.xEdges.iEnd, ranges.xEdges.jBegin, ranges.xEdges.jEnd);
+    maxWaveSpeedY = computeNetUpdatesY(ranges.yEdges.iBegin, ranges.yEdges.iEnd, ranges.yEdges.jBegin, ranges.yEdges.jEnd);
+  }
+
+  reduceMaxTimeStep(maxWaveSpeedX, maxWaveSpeedY);
+}
 
-    /** Calculate the net-updates for the y-stride by iterating over the cells on the y-stride
-     * Cells on the boundary are ghost cells and are not updated, but one net update is needed for the neighbouring cell.
-     * Layout
-     * Q0,4 Q1,4 Q2,4 Q3,4 Q4,4
-     *      --------------
-     * Q0,3 Q1,3 Q2,3 Q3,3 Q4,3
-     *      --------------
-     * Q0,2 Q1,2 Q2,2 Q3,2 Q4,2
-     *      --------------
-     * Q0,1 Q1,1 Q2,1 Q3,1 Q4,1
-     *      --------------       Qi,j
-     * Q0,0 Q1,0 Q2,0 Q3,0 Q4,0  updates = --------------
-     */
-
-#if defined(ENABLE_OPENMP)
-#pragma omp parallel for reduction(max : maxWaveSpeedY), schedule(dynamic)
-#endif
-    for (int i = 1; i < nx_; ++i) {
-      for (int j = 0; j <= ny_; ++j) {
-        RealType maxEdgeSpeed{0.0};
-
-        fWaveSolver_.computeNetUpdates(
-          h_[i][j],
-          h_[i][j + 1],
-          hv_[i][j],
-          hv_[i][j + 1],
-          b_[i][j],
-          b_[i][j + 1],
-          hNetUpdatesYLeft_[i][j],
-          hNetUpdatesYRight_[i][j],
-          hvNetUpdatesYLeft_[i][j],
-          hvNetUpdatesYRight_[i][j],
-          maxEdgeSpeed
-        );
-
-#if defined(ENABLE_OPENMP)
-        maxWaveSpeedY = std::max(maxWaveSpeedY, maxEdgeSpeed);
+template <class SolverPolicy>
+void Blocks::DimensionalSplitting<SolverPolicy>::updateUnknownsInRegion(RealType dt, const SweepRanges& ranges) {
+  const Range& x = ranges.xCells;
+  const Range& y = ranges.yCells;
+  if (executionMode_ == ExecutionMode::Fused) {
+    updateUnknownsFusedX(dt, x.iBegin, x.iEnd, x.jBegin, x.jEnd);
+    updateUnknownsFusedY(dt, y.iBegin, y.iEnd, y.jBegin, y.jEnd);
+  } else if (executionMode_ == ExecutionMode::Tiled) {
+    updateUnknownsTiled(dt, x, y);
+  } else if (executionMode_ == ExecutionMode::TaskGraph) {
+    RealType maxWaveSpeedX{0.0};
+    RealType maxWaveSpeedY{0.0};
+    runTileTasks(ranges, false, true, dt, maxWaveSpeedX, maxWaveSpeedY);
+  } else if (executionMode_ == ExecutionMode::LocalTimeStepping) {
+    updateUnknownsLocal(dt, ranges);
+  } else {
+    updateUnknownsBufferedX(dt, x.iBegin, x.iEnd, x.jBegin, x.jEnd);
+    updateUnknownsBufferedY(dt, y.iBegin, y.iEnd, y.jBegin, y.jEnd);
+  }
+}
+
+template <class SolverPolicy>
+void Blocks::DimensionalSplitting<SolverPolicy>::reduceMaxTimeStep(RealType maxWaveSpeedX, RealType maxWaveSpeedY) {
+#if defined(ENABLE_OPENMP)
+  const int thread = omp_get_thread_num();
 #else
-      // Update the maximum wave speed
-      maxWaveSpeedY = std::max(maxWaveSpeedY, maxEdgeSpeed);
+  const int thread = 0;
 #endif
-      }
-    }
+  threadWaveSpeeds_[thread] = {maxWaveSpeedX, maxWaveSpeedY};
 
+#if defined(ENABLE_OPENMP)
+#pragma omp barrier
+#pragma omp single
+#endif
+  {
+#if defined(ENABLE_OPENMP)
+    const int threadCount = omp_get_num_threads();
+#else
+    const int threadCount = 1;
+#endif
+    // The edges of the inactive tiles are at rest and were skipped, but they still limit the time step
+    RealType speedX = activityMap_.getInactiveWaveSpeedX();
+    RealType speedY = activityMap_.getInactiveWaveSpeedY();
+    for (int i = 0; i < threadCount; i++) {
+      speedX = std::max(speedX, threadWaveSpeeds_[i].x);
+      speedY = std::max(speedY, threadWaveSpeeds_[i].y);
+    }
+    updateMaxTimeStep(speedX, speedY);
+  }
+}
 
-      // Compute the time step width
-      maxTimeStep_ = dx_ / maxWaveSpeedX;
-      maxTimeStep_ = std::min(maxTimeStep_, dy_ / maxWaveSpeedY);
+template <class SolverPolicy>
+void Blocks::DimensionalSplitting<SolverPolicy>::updateMaxTimeStep(RealType maxWaveSpeedX, RealType maxWaveSpeedY) {
+  // Compute the time step width
+  maxTimeStep_ = dx_ / maxWaveSpeedX;
+  maxTimeStep_ = std::min(maxTimeStep_, dy_ / maxWaveSpeedY);
 
-      // Reduce maximum time step size by "safety factor"
-      maxTimeStep_ *= RealType(0.4); // CFL-number = 0.5
+  // Reduce maximum time step size by "safety factor"
+  maxTimeStep_ *= RealType(0.4); // CFL-number = 0.5
 
-                                     // Debug only check if CFL condition is satisfied for the y-sweep (dt < dy /  (2* maxWaveSpeed))
+  // Debug only check if CFL condition is satisfied for the y-sweep (dt < dy /  (2* maxWaveSpeed))
 #ifndef NDEBUG
-      if (maxTimeStep_ >= ((dy_ / maxWaveSpeedY) * 0.5)) {
-        std::fprintf(stderr, "Warning: CFL condition not satisfied for y-sweep! dt = %f >= %f\n", maxTimeStep_, 0.5 * (dy_ / maxWaveSpeedY));
-      }
+  if (maxTimeStep_ >= ((dy_ / maxWaveSpeedY) * 0.5)) {
+    std::fprintf(stderr, "Warning: CFL condition not satisfied for y-sweep! dt = %f >= %f\n", maxTimeStep_, 0.5 * (dy_ / maxWaveSpeedY));
+  }
 #endif
-    }
+}
+
+template <class SolverPolicy>
+void Blocks::DimensionalSplitting<SolverPolicy>::synchWaterHeightAfterWrite() {
+  wetMask_.build(h_, nx_, ny_);
+  activityMapOutdated_ = true;
+}
 
-    void Blocks::DimensionalSplitting::updateUnknowns(RealType dt) {
+template <class SolverPolicy>
+void Blocks::DimensionalSplitting<SolverPolicy>::synchDischargeAfterWrite() {
+  activityMapOutdated_ = true;
+}
+
+template <class SolverPolicy>
+void Blocks::DimensionalSplitting<SolverPolicy>::synchBathymetryAfterWrite() {
+  activityMapOutdated_ = true;
+}
+
+template <class SolverPolicy>
+void Blocks::DimensionalSplitting<SolverPolicy>::setActiveTileSize(int tileSize) {
+  activeTileSize_      = tileSize;
+  activityMapOutdated_ = true;
+}
+
+template <class SolverPolicy>
+void Blocks::DimensionalSplitting<SolverPolicy>::updateActivityMap() {
+  if (!activityMapOutdated_) {
+    activityMap_.update(h_, hu_, hv_, b_);
+    return;
+  }
+  activityMapOutdated_ = false;
+
+  activityMap_.setAllActive(nx_, ny_);
+  if (activeTileSize_ <= 0) {
+    return;
+  }
+
+  // Wave speeds of the edges owned by each tile, computed while all tiles are active
+  Tools::TileActivityMap tiles;
+  tiles.setAllActive(nx_, ny_, activeTileSize_);
+  const int             tileCount = tiles.getTileCountX() * tiles.getTileCountY();
+  std::vector<RealType> restWaveSpeedX(tileCount);
+  std::vector<RealType> restWaveSpeedY(tileCount);
 
 #if defined(ENABLE_OPENMP)
 #pragma omp parallel for schedule(dynamic)
 #endif
-      for (int i = 1; i <= nx_; ++i) {
-        for (int j = 1; j < ny_; ++j) {
-          h_[i][j] -= dt / dx_ * (hNetUpdatesXRight_[i - 1][j] + hNetUpdatesXLeft_[i][j]);
-          hu_[i][j] -= dt / dx_ * (huNetUpdatesXRight_[i - 1][j] + huNetUpdatesXLeft_[i][j]);
-        }
+  for (int tile = 0; tile < tileCount; tile++) {
+    const int                          tx      = tile / tiles.getTileCountY();
+    const int                          ty      = tile % tiles.getTileCountY();
+    const Tools::TileActivityMap::Span columns = tiles.getColumns(tx);
+    const Tools::TileActivityMap::Span rows    = tiles.getRows(ty);
+
+    restWaveSpeedX[tile] = computeMaxWaveSpeedX(tx == 0 ? 0 : columns.begin, columns.end, rows.begin, rows.end);
+    restWaveSpeedY[tile] = computeMaxWaveSpeedY(columns.begin, columns.end, ty == 0 ? 0 : rows.begin, std::min(rows.end, ny_));
+  }
+
+  activityMap_.build(h_, hu_, hv_, b_, nx_, ny_, activeTileSize_);
+  for (int tile = 0; tile < tileCount; tile++) {
+    activityMap_.setRestWaveSpeed(tile / tiles.getTileCountY(), tile % tiles.getTileCountY(), restWaveSpeedX[tile], restWaveSpeedY[tile]);
+  }
+}
+
+template <class SolverPolicy>
+RealType Blocks::DimensionalSplitting<SolverPolicy>::computeNetUpdatesXColumn(int i, int jBegin, int jEnd) {
+  RealType maxWaveSpeed{0.0};
+
+  // The edges between column i and i + 1 are a contiguous slice of both columns
+  Tools::WetMask::forEachSpan(wetMask_.getXEdgeSpans(i), activityMap_.getXEdgeRows(i), jBegin, jEnd, [&](int begin, int end) {
+    const RealType maxEdgeSpeed = SolverPolicy::computeNetUpdatesBatch(
+      h_[i] + begin,
+      h_[i + 1] + begin,
+      hu_[i] + begin,
+      hu_[i + 1] + begin,
+      b_[i] + begin,
+      b_[i + 1] + begin,
+      hNetUpdatesXLeft_[i] + begin,
+      hNetUpdatesXRight_[i] + begin,
+      huNetUpdatesXLeft_[i] + begin,
+      huNetUpdatesXRight_[i] + begin,
+      end - begin + 1
+    );
+    maxWaveSpeed = std::max(maxWaveSpeed, maxEdgeSpeed);
+  });
+
+  return maxWaveSpeed;
+}
+
+template <class SolverPolicy>
+RealType Blocks::DimensionalSplitting<SolverPolicy>::computeNetUpdatesYColumn(int i, int jBegin, int jEnd) {
+  RealType maxWaveSpeed{0.0};
+
+  // The edges between row j and j + 1 of column i are two overlapping slices of the column
+  Tools::WetMask::forEachSpan(wetMask_.getYEdgeSpans(i), activityMap_.getYEdgeRows(i), jBegin, jEnd, [&](int begin, int end) {
+    const RealType maxEdgeSpeed = SolverPolicy::computeNetUpdatesBatch(
+      h_[i] + begin,
+      h_[i] + begin + 1,
+      hv_[i] + begin,
+      hv_[i] + begin + 1,
+      b_[i] + begin,
+      b_[i] + begin + 1,
+      hNetUpdatesYLeft_[i] + begin,
+      hNetUpdatesYRight_[i] + begin,
+      hvNetUpdatesYLeft_[i] + begin,
+      hvNetUpdatesYRight_[i] + begin,
+      end - begin + 1
+    );
+    maxWaveSpeed = std::max(maxWaveSpeed, maxEdgeSpeed);
+  });
+
+  return maxWaveSpeed;
+}
+
+template <class SolverPolicy>
+RealType Blocks::DimensionalSplitting<SolverPolicy>::computeNetUpdatesX(int iBegin, int iEnd, int jBegin, int jEnd) {
+  RealType maxWaveSpeed{0.0};
+
+#if defined(ENABLE_OPENMP)
+#pragma omp for schedule(static) nowait
+#endif
+  for (int i = iBegin; i <= iEnd; ++i) {
+    maxWaveSpeed = std::max(maxWaveSpeed, computeNetUpdatesXColumn(i, jBegin, jEnd));
+  }
+
+  return maxWaveSpeed;
+}
+
+template <class SolverPolicy>
+RealType Blocks::DimensionalSplitting<SolverPolicy>::computeNetUpdatesY(int iBegin, int iEnd, int jBegin, int jEnd) {
+  RealType maxWaveSpeed{0.0};
+
+#if defined(ENABLE_OPENMP)
+#pragma omp for schedule(static) nowait
+#endif
+  for (int i = iBegin; i <= iEnd; ++i) {
+    maxWaveSpeed = std::max(maxWaveSpeed, computeNetUpdatesYColumn(i, jBegin, jEnd));
+  }
+
+  return maxWaveSpeed;
+}
+
+template <class SolverPolicy>
+void Blocks::DimensionalSplitting<SolverPolicy>::updateUnknownsBufferedX(RealType dt, int iBegin, int iEnd, int jBegin, int jEnd) {
+#if defined(ENABLE_OPENMP)
+#pragma omp for schedule(static)
+#endif
+  for (int i = iBegin; i <= iEnd; ++i) {
+    Tools::WetMask::forEachSpan(wetMask_.getCellSpans(i), activityMap_.getCellRows(i), jBegin, jEnd, [&](int begin, int end) {
+      for (int j = begin; j <= end; ++j) {
+        h_[i][j] -= dt / dx_ * (hNetUpdatesXRight_[i - 1][j] + hNetUpdatesXLeft_[i][j]);
+        hu_[i][j] -= dt / dx_ * (huNetUpdatesXRight_[i - 1][j] + huNetUpdatesXLeft_[i][j]);
       }
+    });
+  }
+}
 
+template <class SolverPolicy>
+void Blocks::DimensionalSplitting<SolverPolicy>::updateUnknownsBufferedY(RealType dt, int iBegin, int iEnd, int jBegin, int jEnd) {
 #if defined(ENABLE_OPENMP)
-#pragma omp parallel for schedule(dynamic)
+#pragma omp for schedule(static)
 #endif
-      for (int i = 1; i < nx_; ++i) {
-        for (int j = 1; j <= ny_; ++j) {
-          h_[i][j] -= dt / dy_ * (hNetUpdatesYRight_[i][j - 1] + hNetUpdatesYLeft_[i][j]);
-          hv_[i][j] -= dt / dy_ * (hvNetUpdatesYRight_[i][j - 1] + hvNetUpdatesYLeft_[i][j]);
-        }
+  for (int i = iBegin; i <= iEnd; ++i) {
+    Tools::WetMask::forEachSpan(wetMask_.getCellSpans(i), activityMap_.getCellRows(i), jBegin, jEnd, [&](int begin, int end) {
+      for (int j = begin; j <= end; ++j) {
+        h_[i][j] -= dt / dy_ * (hNetUpdatesYRight_[i][j - 1] + hNetUpdatesYLeft_[i][j]);
+        hv_[i][j] -= dt / dy_ * (hvNetUpdatesYRight_[i][j - 1] + hvNetUpdatesYLeft_[i][j]);
       }
+    });
+  }
+}
+
+template <class SolverPolicy>
+RealType Blocks::DimensionalSplitting<SolverPolicy>::computeMaxWaveSpeedX(int iBegin, int iEnd, int jBegin, int jEnd) const {
+  RealType maxWaveSpeed{0.0};
+
+#if defined(ENABLE_OPENMP)
+#pragma omp for schedule(static) nowait
+#endif
+  for (int i = iBegin; i <= iEnd; ++i) {
+    maxWaveSpeed = std::max(maxWaveSpeed, computeMaxWaveSpeedXColumn(i, jBegin, jEnd));
+  }
+
+  return maxWaveSpeed;
+}
+
+template <class SolverPolicy>
+RealType Blocks::DimensionalSplitting<SolverPolicy>::computeMaxWaveSpeedY(int iBegin, int iEnd, int jBegin, int jEnd) const {
+  RealType maxWaveSpeed{0.0};
+
+#if defined(ENABLE_OPENMP)
+#pragma omp for schedule(static) nowait
+#endif
+  for (int i = iBegin; i <= iEnd; ++i) {
+    maxWaveSpeed = std::max(maxWaveSpeed, computeMaxWaveSpeedYColumn(i, jBegin, jEnd));
+  }
+
+  return maxWaveSpeed;
+}
+
+template <class SolverPolicy>
+RealType Blocks::DimensionalSplitting<SolverPolicy>::computeMaxWaveSpeedXColumn(int i, int jBegin, int jEnd) const {
+  RealType maxWaveSpeed{0.0};
+  Tools::WetMask::forEachSpan(wetMask_.getXEdgeSpans(i), activityMap_.getXEdgeRows(i), jBegin, jEnd, [&](int begin, int end) {
+    const RealType maxEdgeSpeed = SolverPolicy::computeMaxWaveSpeedBatch(
+      h_[i] + begin, h_[i + 1] + begin, hu_[i] + begin, hu_[i + 1] + begin, end - begin + 1
+    );
+    maxWaveSpeed = std::max(maxWaveSpeed, maxEdgeSpeed);
+  });
+  return maxWaveSpeed;
+}
+
+template <class SolverPolicy>
+RealType Blocks::DimensionalSplitting<SolverPolicy>::computeMaxWaveSpeedYColumn(int i, int jBegin, int jEnd) const {
+  RealType maxWaveSpeed{0.0};
+  Tools::WetMask::forEachSpan(wetMask_.getYEdgeSpans(i), activityMap_.getYEdgeRows(i), jBegin, jEnd, [&](int begin, int end) {
+    const RealType maxEdgeSpeed = SolverPolicy::computeMaxWaveSpeedBatch(
+      h_[i] + begin, h_[i] + begin + 1, hv_[i] + begin, hv_[i] + begin + 1, end - begin + 1
+    );
+    maxWaveSpeed = std::max(maxWaveSpeed, maxEdgeSpeed);
+  });
+  return maxWaveSpeed;
+}
+
+template <class SolverPolicy>
+void Blocks::DimensionalSplitting<SolverPolicy>::reserveThreadStorage() {
+#if defined(ENABLE_OPENMP)
+  const std::size_t threadCount = omp_get_max_threads();
+#else
+  const std::size_t threadCount = 1;
+#endif
+  if (threadWaveSpeeds_.size() < threadCount) {
+    threadWaveSpeeds_.resize(threadCount);
+  }
+  if (executionMode_ == ExecutionMode::TaskGraph || executionMode_ == ExecutionMode::LocalTimeStepping) {
+    const std::size_t tileCount = std::size_t(getTileCountX()) * getTileCountY();
+    if (tileWaveSpeeds_.size() < tileCount) {
+      tileWaveSpeeds_.resize(tileCount);
+      tileDependencies_.resize(tileCount);
+      tileLevels_.resize(tileCount);
     }
-    void Blocks::DimensionalSplitting::setHu(const Tools::Float2D<RealType>& hu) { hu_ = hu; }
-    void Blocks::DimensionalSplitting::setHv(const Tools::Float2D<RealType>& hv) { hv_ = hv; }
-    void Blocks::DimensionalSplitting::setB(const Tools::Float2D<RealType>& b) { b_ = b; }
-    void Blocks::DimensionalSplitting::setH(const Tools::Float2D<RealType>& h) { h_ = h; }
+  }
+  if (executionMode_ != ExecutionMode::Fused && executionMode_ != ExecutionMode::LocalTimeStepping) {
+    return;
+  }
+  const std::size_t size = threadCount * FusedScratchColumns * (ny_ + 2);
+  if (fusedScratch_.size() < size) {
+    fusedScratch_.resize(size);
+  }
+}
+
+template <class SolverPolicy>
+void Blocks::DimensionalSplitting<SolverPolicy>::setHu(const Tools::Float2D<RealType>& hu) {
+  assert(hu.getCols() == nx_ + 2 && hu.getRows() == ny_ + 2);
+  hu_ = hu;
+  synchDischargeAfterWrite();
+}
+template <class SolverPolicy>
+void Blocks::DimensionalSplitting<SolverPolicy>::setHu(Tools::Float2D<RealType>&& hu) {
+  assert(hu.getCols() == nx_ + 2 && hu.getRows() == ny_ + 2);
+  hu_ = std::move(hu);
+  synchDischargeAfterWrite();
+}
+template <class SolverPolicy>
+void Blocks::DimensionalSplitting<SolverPolicy>::setHv(const Tools::Float2D<RealType>& hv) {
+  assert(hv.getCols() == nx_ + 2 && hv.getRows() == ny_ + 2);
+  hv_ = hv;
+  synchDischargeAfterWrite();
+}
+template <class SolverPolicy>
+void Blocks::DimensionalSplitting<SolverPolicy>::setHv(Tools::Float2D<RealType>&& hv) {
+  assert(hv.getCols() == nx_ + 2 && hv.getRows() == ny_ + 2);
+  hv_ = std::move(hv);
+  synchDischargeAfterWrite();
+}
+template <class SolverPolicy>
+void Blocks::DimensionalSplitting<SolverPolicy>::setB(const Tools::Float2D<RealType>& b) {
+  assert(b.getCols() == nx_ + 2 && b.getRows() == ny_ + 2);
+  b_ = b;
+  synchBathymetryAfterWrite();
+}
+template <class SolverPolicy>
+void Blocks::DimensionalSplitting<SolverPolicy>::setB(Tools::Float2D<RealType>&& b) {
+  assert(b.getCols() == nx_ + 2 && b.getRows() == ny_ + 2);
+  b_ = std::move(b);
+  synchBathymetryAfterWrite();
+}
+template <class SolverPolicy>
+void Blocks::DimensionalSplitting<SolverPolicy>::setH(const Tools::Float2D<RealType>& h) {
+  assert(h.getCols() == nx_ + 2 && h.getRows() == ny_ + 2);
+  h_ = h;
+  synchWaterHeightAfterWrite();
+}
+template <class SolverPolicy>
+void Blocks::DimensionalSplitting<SolverPolicy>::setH(Tools::Float2D<RealType>&& h) {
+  assert(h.getCols() == nx_ + 2 && h.getRows() == ny_ + 2);
+  h_ = std::move(h);
+  synchWaterHeightAfterWrite();
+}
+
+template class Blocks::DimensionalSplitting<Solvers::FWaveKernel>;
+template class Blocks::DimensionalSplitting<Solvers::RusanovKernel>;
@@ -1,7 +1,67 @@
 #pragma once
+#include <cstdint>
+#include <vector>
+
 #include "Block.hpp"
-#include "Solvers/FWaveSolver.h"
+#include "Solvers/FWaveKernel.h"
+#include "Solvers/RusanovKernel.h"
+#include "Tools/TileActivityMap.h"
+#include "Tools/WetMask.h"
 namespace Blocks {
+  /**
+   * How a dimensional splitting block applies the net updates.
+   */
+  enum class ExecutionMode {
+    //! Store the net updates of all edges in eight arrays and apply them in updateUnknowns.
+    Buffered,
+    //! Apply the net updates of each edge directly to its cells, the y-sweep sees the result of the x-sweep.
+    Fused,
+    //! Like Buffered, but the block is traversed in cache-sized tiles and both updates are applied in one pass.
+    Tiled,
+    //! Like Tiled, but every tile is an OpenMP task that starts as soon as the tiles it depends on are done.
+    TaskGraph,
+    //! Every tile advances with the largest power-of-two multiple of the global time step its own CFL condition allows.
+    LocalTimeStepping
+  };
+
+  /**
+   * Block using dimensional splitting: an x-sweep followed by a y-sweep.
+   *
+   * The Riemann solver is a compile-time policy. It has to provide the static functions computeNetUpdates() for
+   * a single edge and computeNetUpdatesBatch() for a contiguous slice of edges, see Solvers::FWaveKernel.
+   * Instantiations exist for Solvers::FWaveKernel and Solvers::RusanovKernel.
+   *
+   * In ExecutionMode::Buffered all net updates are computed from the same state and stored. In ExecutionMode::Fused
+   * the net-update arrays are not allocated: computeNumericalFluxes only determines the time step and
+   * updateUnknowns applies each edge directly to its cells, so the y-sweep uses the state after the x-sweep.
+   * ExecutionMode::Tiled computes the same result as the buffered mode, but computes the net updates of both sweeps
+   * tile by tile, such that the columns of a tile stay in the L2 cache, and applies the x- and y-updates of a cell in
+   * a single pass. The tile size can be set with setTileSize or measured with autotuneTileSize.
+   * ExecutionMode::TaskGraph uses the same tiles, but as OpenMP tasks that idle threads pick up, so tiles that are
+   * expensive (e.g. along the coast) do not stall a static partitioning. The update of a tile depends only on the net
+   * updates of the tile and of its left and lower neighbour, with a fixed time step (simulateTimeStep(dt)) there is no
+   * barrier between the phases at all.
+   *
+   * In ExecutionMode::LocalTimeStepping, computeNumericalFluxes sorts the tiles into levels: a tile of level l is
+   * updated every 2^l global time steps dt (the time step of the fastest edge), as often as its own wave speeds require.
+   * An edge is computed at the rate of the finer of its two cells, its net updates times the step size are summed up
+   * in the net-update arrays until the cell on the respective side is updated. Every edge therefore transfers the same
+   * amount to both sides and the scheme stays conservative. getMaxTimeStep returns 2^maxLevel * dt, which updateUnknowns
+   * splits into 2^maxLevel global steps.
+   *
+   * All five execution modes skip cells and edges that are dry according to the Tools::WetMask, which is rebuilt
+   * whenever the water height is written from outside (initialiseScenario, setWaterHeight, setH).
+   *
+   * The buffered mode and the code shared by all modes are in DimensionalSplitting.cpp. Each other mode has a file of
+   * its own (DimensionalSplittingFused.cpp, ...Tiled.cpp, ...TaskGraph.cpp, ...LocalTimeStepping.cpp), the tiles that
+   * the last three modes share are defined in DimensionalSplittingTiled.cpp.
+   *
+   * With setActiveTileSize, the block is split into tiles and only the tiles of the Tools::TileActivityMap that the
+   * wave has reached are swept. The result is the same as without tiles, including the time step.
+   *
+   * @tparam SolverPolicy the edge solver used in the sweeps.
+   */
+  template <class SolverPolicy = Solvers::FWaveKernel>
   class DimensionalSplitting: public Block {
   protected:
     //! net-updates for the heights of the cells on the x-stride.
@@ -20,7 +80,246 @@ namespace Blocks {
     Tools::Float2D<RealType> hvNetUpdatesYLeft_;
     Tools::Float2D<RealType> hvNetUpdatesYRight_;
 
-    Solvers::FWaveSolver fWaveSolver_;
+    //! execution mode chosen at construction, the net-update arrays are allocated in all modes but the fused one.
+    const ExecutionMode executionMode_;
+
+    //! per-thread scratch columns for the net updates of the fused and the local time stepping mode.
+    std::vector<RealType> fusedScratch_;
+
+    //! maximum wave speeds found by one thread or in one tile, on its own cache line.
+    struct alignas(64) WaveSpeeds {
+      RealType x;
+      RealType y;
+    };
+
+    //! per-thread maximum wave speeds, reduced to the time step inside the parallel region.
+    std::vector<WaveSpeeds> threadWaveSpeeds_;
+
+    //! maximum wave speeds of the edges computed by computeNumericalFluxesInterior.
+    WaveSpeeds interiorWaveSpeeds_{0.0, 0.0};
+
+    //! task graph mode: maximum wave speeds of every tile and the objects the tile tasks depend on.
+    std::vector<WaveSpeeds> tileWaveSpeeds_;
+    std::vector<char>       tileDependencies_;
+
+    //! local time stepping: level of every tile, the highest level and the number of levels that may be used.
+    std::vector<int> tileLevels_;
+    int              maxLevel_{0};
+    int              timeStepLevels_{4};
+
+    //! local time stepping: cell updates done and cell updates global time stepping would have needed.
+    std::uint64_t localCellUpdates_{0};
+    std::uint64_t globalCellUpdates_{0};
+
+    //! number of scratch columns per thread in fused mode: four edges with four net updates each.
+    static constexpr int FusedScratchColumns = 16;
+
+    //! inclusive ranges of columns [iBegin, iEnd] and rows [jBegin, jEnd].
+    struct Range {
+      int iBegin;
+      int iEnd;
+      int jBegin;
+      int jEnd;
+    };
+
+    //! edges and cells that are swept in a time step.
+    struct SweepRanges {
+      Range xEdges;
+      Range yEdges;
+      Range xCells;
+      Range yCells;
+    };
+
+    //! columns and rows of a tile in tiled and task graph mode.
+    int tileColumns_{16};
+    int tileRows_{256};
+
+    //! cells and edges that can change, everything else is dry for the whole simulation.
+    Tools::WetMask wetMask_;
+
+    //! tiles that are swept, all of them if activeTileSize_ is 0.
+    Tools::TileActivityMap activityMap_;
+    int                    activeTileSize_{0};
+    bool                   activityMapOutdated_{true};
+
+    /**
+     * @brief Rebuilds the activity map if the state was written from outside, otherwise activates the tiles the wave reached.
+     */
+    void updateActivityMap();
+
+    /**
+     * @brief Writes zeros to all arrays of the block, column by column with the static partitioning of the sweeps.
+     *
+     * The arrays are allocated without being touched, so each page lands on the NUMA node of the thread that sweeps it.
+     */
+    void firstTouch();
+
+    /**
+     * @brief Make sure that threadWaveSpeeds_ has a slot and, in fused mode, fusedScratch_ holds FusedScratchColumns
+     * columns for every thread. In task graph and local time stepping mode, the tile vectors get an entry for every tile.
+     */
+    void reserveThreadStorage();
+
+    /**
+     * @brief Edges and cells swept by computeNumericalFluxes and updateUnknowns, the whole block by default.
+     */
+    virtual SweepRanges getSweepRanges() const;
+
+    /**
+     * @brief The phases of a time step. They have to be called by all threads of a parallel region (or outside of one)
+     * and contain only worksharing loops with a static schedule, so a column is always handled by the same thread.
+     *
+     * computeNumericalFluxesInRegion ends with the reduction of the time step, all threads see maxTimeStep_ afterwards.
+     */
+    void computeNumericalFluxesInRegion(const SweepRanges& ranges);
+    void updateUnknownsInRegion(RealType dt, const SweepRanges& ranges);
+
+    /**
+     * @brief Combines the maximum wave speeds of all threads into maxTimeStep_, ends with a barrier.
+     */
+    void reduceMaxTimeStep(RealType maxWaveSpeedX, RealType maxWaveSpeedY);
+
+    /**
+     * @brief Computes the time step from the maximum wave speeds of both sweeps.
+     */
+    void updateMaxTimeStep(RealType maxWaveSpeedX, RealType maxWaveSpeedY);
+
+    /**
+     * The following sweeps are worksharing loops without an implicit barrier at the end (the updates have one), they return
+     * the maximum wave speed of the edges of the calling thread.
+     */
+
+    /**
+     * @brief Buffered x-sweep: net updates of the x-edges between column i and i + 1 for i in [iBegin, iEnd] and rows [jBegin, jEnd].
+     * @return maximum wave speed of these edges
+     */
+    RealType computeNetUpdatesX(int iBegin, int iEnd, int jBegin, int jEnd);
+
+    /**
+     * @brief Buffered y-sweep: net updates of the y-edges between row j and j + 1 for j in [jBegin, jEnd] and columns [iBegin, iEnd].
+     * @return maximum wave speed of these edges
+     */
+    RealType computeNetUpdatesY(int iBegin, int iEnd, int jBegin, int jEnd);
+
+    /**
+     * @brief Net updates of the x-/y-edges between column/row i and i + 1 in column i for the rows [jBegin, jEnd].
+     * @return maximum wave speed of these edges
+     */
+    RealType computeNetUpdatesXColumn(int i, int jBegin, int jEnd);
+    RealType computeNetUpdatesYColumn(int i, int jBegin, int jEnd);
+
+    int getTileCountX() const { return (nx_ + tileColumns_ - 1) / tileColumns_; }
+    int getTileCountY() const { return (ny_ + tileRows_ - 1) / tileRows_; }
+
+    /**
+     * @brief Cells of tile (tx, ty) and the edges it owns: the edges right of and above its cells, the tiles at the
+     * boundary also the edges to the ghost layer.
+     */
+    Range getTileCells(int tx, int ty) const;
+    Range getTileEdges(int tx, int ty) const;
+
+    /**
+     * @brief Net updates of the edges of tile (tx, ty) that lie in xEdges and yEdges.
+     * @return maximum wave speeds of these edges
+     */
+    WaveSpeeds computeNetUpdatesTile(int tx, int ty, const Range& xEdges, const Range& yEdges);
+
+    /**
+     * @brief Applies the x net updates to the cells of tile (tx, ty) in xCells and the y net updates to its cells in yCells.
+     */
+    void updateUnknownsTile(RealType dt, int tx, int ty, const Range& xCells, const Range& yCells);
+
+    /**
+     * @brief Tiled mode: net updates of the x-edges in xEdges and the y-edges in yEdges (ranges as in computeNetUpdatesX/Y).
+     */
+    void computeNetUpdatesTiled(Range xEdges, Range yEdges, RealType& o_maxWaveSpeedX, RealType& o_maxWaveSpeedY);
+
+    /**
+     * @brief Tiled mode: applies the x net updates to the cells in xCells and the y net updates to the cells in yCells.
+     */
+    void updateUnknownsTiled(RealType dt, Range xCells, Range yCells);
+
+    /**
+     * @brief Task graph mode: one thread creates a task per tile for the net updates (if computeFluxes is set) and one
+     * for the update of the cells (if updateCells is set), the other threads of the region execute them. Without a
+     * barrier between the phases, the update of a tile waits only for the net updates of the tile and of its left and
+     * lower neighbour, which read the cells of the tile as well.
+     *
+     * Ends with a barrier. The thread that created the tasks returns the maximum wave speeds, the others 0.
+     */
+    void runTileTasks(
+      const SweepRanges& ranges, bool computeFluxes, bool updateCells, RealType dt, RealType& o_maxWaveSpeedX, RealType& o_maxWaveSpeedY
+    );
+
+    /**
+     * @brief Applies the buffered x net updates to h and hu of the cells in columns [iBegin, iEnd] and rows [jBegin, jEnd].
+     */
+    void updateUnknownsBufferedX(RealType dt, int iBegin, int iEnd, int jBegin, int jEnd);
+
+    /**
+     * @brief Applies the buffered y net updates to h and hv of the cells in columns [iBegin, iEnd] and rows [jBegin, jEnd].
+     */
+    void updateUnknownsBufferedY(RealType dt, int iBegin, int iEnd, int jBegin, int jEnd);
+
+    /**
+     * @brief Local time stepping: sorts the tiles into levels by the wave speeds of the edges around their cells.
+     *
+     * Called by all threads of a parallel region, ends with maxTimeStep_ = 2^maxLevel_ * global time step.
+     */
+    void computeTimeStepLevels(const SweepRanges& ranges);
+
+    /**
+     * @brief Local time stepping: 2^maxLevel_ global steps of size dt / 2^maxLevel_, called by all threads of a parallel region.
+     */
+    void updateUnknownsLocal(RealType dt, const SweepRanges& ranges);
+
+    /**
+     * @brief Adds dt times the net updates of the x-/y-edges in column i and rows [jBegin, jEnd] to the net-update
+     * arrays, scratch holds four columns.
+     */
+    void accumulateNetUpdatesXColumn(int i, int jBegin, int jEnd, RealType dt, RealType* scratch);
+    void accumulateNetUpdatesYColumn(int i, int jBegin, int jEnd, RealType dt, RealType* scratch);
+
+    /**
+     * @brief Applies the summed up net updates to the cells of tile (tx, ty) and clears them.
+     */
+    void applyAccumulatedNetUpdates(int tx, int ty, const Range& xCells, const Range& yCells);
+
+    /**
+     * @brief Maximum wave speed of the x-/y-edges in column i and rows [jBegin, jEnd].
+     */
+    RealType computeMaxWaveSpeedXColumn(int i, int jBegin, int jEnd) const;
+    RealType computeMaxWaveSpeedYColumn(int i, int jBegin, int jEnd) const;
+
+    /**
+     * @brief Maximum wave speed of the x-edges between column i and i + 1 for i in [iBegin, iEnd] and rows [jBegin, jEnd].
+     */
+    RealType computeMaxWaveSpeedX(int iBegin, int iEnd, int jBegin, int jEnd) const;
+
+    /**
+     * @brief Maximum wave speed of the y-edges between row j and j + 1 for j in [jBegin, jEnd] and columns [iBegin, iEnd].
+     */
+    RealType computeMaxWaveSpeedY(int iBegin, int iEnd, int jBegin, int jEnd) const;
+
+    /**
+     * @brief Fused x-sweep: updates h and hu of the cells in columns [iBegin, iEnd] and rows [jBegin, jEnd] in place.
+     *
+     * Every thread owns a contiguous range of columns. The edges on the borders of the ranges are computed before
+     * any cell is changed, the edges inside a range are computed column by column right before they are needed.
+     */
+    void updateUnknownsFusedX(RealType dt, int iBegin, int iEnd, int jBegin, int jEnd);
+
+    /**
+     * @brief Fused y-sweep: updates h and hv of the cells in columns [iBegin, iEnd] and rows [jBegin, jEnd] in place.
+     */
+    void updateUnknownsFusedY(RealType dt, int iBegin, int iEnd, int jBegin, int jEnd);
+
+    /**
+     * @brief Rebuilds the wet mask from the new water height, the activity map is rebuilt in the next time step.
+     */
+    void synchWaterHeightAfterWrite() override;
+    void synchDischargeAfterWrite() override;
+    void synchBathymetryAfterWrite() override;
 
   public:
     /**
@@ -29,25 +328,117 @@ namespace Blocks {
      * @param ny cell count in y-direction
      * @param dx cell size in x-direction
      * @param dy cell size in y-direction
+     * @param executionMode whether the net updates are buffered or fused into the sweeps
      */
-    DimensionalSplitting(int nx, int ny, RealType dx, RealType dy);
+    DimensionalSplitting(int nx, int ny, RealType dx, RealType dy, ExecutionMode executionMode = ExecutionMode::Buffered);
+    /**
+     * @brief A block that reads the bathymetry b of another block instead of owning one, see Blocks::Ensemble.
+     */
+    DimensionalSplitting(int nx, int ny, RealType dx, RealType dy, const Tools::Float2D<RealType>& b, ExecutionMode executionMode = ExecutionMode::Buffered);
     ~DimensionalSplitting() override = default;
 
     /**
      * @brief Compute the net-updates for the x- and y-stride.
      */
     void computeNumericalFluxes() override;
+    /**
+     * @brief Compute the net-updates of the edges that do not touch the ghost layer.
+     *
+     * Only ExecutionMode::Buffered without active tiles splits the edges, the other modes compute all of them in
+     * computeNumericalFluxesBoundary.
+     */
+    void computeNumericalFluxesInterior() override;
+    /**
+     * @brief Compute the net-updates of the edges to the ghost layer and the time step of all edges.
+     */
+    void computeNumericalFluxesBoundary() override;
+    /**
+     * @brief In ExecutionMode::Fused, the y-sweep reads the ghost rows, which the x-sweep does not update, so the ghost
+     * layer lasts no time step. A halo of width 1 is still exchanged every time step, with the ghost rows as they are.
+     *
+     * The other modes compute all net updates from the same state and keep the default of Block.
+     */
+    int getHaloTimeSteps(int haloWidth) const override;
     /**
      * @brief Update the unknowns with the net-updates.
      * @param dt maximum time step size
      */
     void updateUnknowns(RealType dt) override;
-    // needed for the tests
+
+    /**
+     * @brief computeNumericalFluxes followed by updateUnknowns(dt) in a single parallel region.
+     */
+    void simulateTimeStep(RealType dt) override;
+
+    /**
+     * @brief A time step with the maximum time step allowed by the CFL condition, computed in a single parallel region.
+     * @return the time step size
+     */
+    RealType simulateTimeStep();
+
+    ExecutionMode getExecutionMode() const { return executionMode_; }
+
+    /**
+     * @brief Wet cells and edges of the block, can be used to skip dry land in the output as well.
+     */
+    const Tools::WetMask& getWetMask() const { return wetMask_; }
+
+    /**
+     * @brief Only sweep the tiles of tileSize * tileSize cells that the wave has reached, 0 sweeps the whole block.
+     */
+    void setActiveTileSize(int tileSize);
+
+    const Tools::TileActivityMap& getActivityMap() const { return activityMap_; }
+
+    /**
+     * @brief Local time stepping: tiles use at most levels levels, i.e. time steps up to 2^(levels - 1) times the global one.
+     */
+    void setTimeStepLevels(int levels);
+    int  getTimeStepLevels() const { return timeStepLevels_; }
+
+    /**
+     * @brief Local time stepping: level of every tile in the last time step, indexed by tx * tile count in y + ty.
+     */
+    const std::vector<int>& getTileLevels() const { return tileLevels_; }
+
+    /**
+     * @brief Local time stepping: number of cell updates so far and the number global time stepping would have needed.
+     */
+    std::uint64_t getLocalCellUpdates() const { return localCellUpdates_; }
+    std::uint64_t getGlobalCellUpdates() const { return globalCellUpdates_; }
+
+    /**
+     * @brief Number of columns and rows of a tile in tiled, task graph and local time stepping mode.
+     */
+    void setTileSize(int columns, int rows);
+    int  getTileColumns() const { return tileColumns_; }
+    int  getTileRows() const { return tileRows_; }
+
+    /**
+     * @brief Times computeNumericalFluxes for a few tile sizes and keeps the fastest one.
+     *
+     * Only the net updates are recomputed, the state of the block does not change.
+     */
+    void autotuneTileSize();
+
+    /**
+     * @brief Setters for the whole arrays including the ghost layer.
+     *
+     * The const overloads copy the values into the existing arrays of the block, the rvalue overloads take over the
+     * memory of the argument. Either way the argument must have (nx + 2) x (ny + 2) elements.
+     */
     void setHv(const Tools::Float2D<RealType>& hv);
     void setHu(const Tools::Float2D<RealType>& hu);
     void setB(const Tools::Float2D<RealType>& b);
     void setH(const Tools::Float2D<RealType>& h);
+    void setHv(Tools::Float2D<RealType>&& hv);
+    void setHu(Tools::Float2D<RealType>&& hu);
+    void setB(Tools::Float2D<RealType>&& b);
+    void setH(Tools::Float2D<RealType>&& h);
   };
 
+  extern template class DimensionalSplitting<Solvers::FWaveKernel>;
+  extern template class DimensionalSplitting<Solvers::RusanovKernel>;
+
 
 } // namespace Blocks
\ No newline at end of file
@@ -0,0 +1,137 @@
+#include "DimensionalSplitting.h"
+
+#if defined(ENABLE_OPENMP)
+  #include <omp.h>
+#endif
+
+template <class SolverPolicy>
+void Blocks::DimensionalSplitting<SolverPolicy>::updateUnknownsFusedX(RealType dt, int iBegin, int iEnd, int jBegin, int jEnd) {
+  if (iBegin > iEnd || jBegin > jEnd) {
+    return;
+  }
+
+  // A scratch edge consists of the columns hLeft, hRight, huLeft and huRight, indexed by the row
+  const int columnSize   = ny_ + 2;
+  auto      computeEdges = [&](int i, RealType* edge) {
+    Tools::WetMask::forEachSpan(wetMask_.getXEdgeSpans(i), activityMap_.getXEdgeRows(i), jBegin, jEnd, [&](int begin, int end) {
+      SolverPolicy::computeNetUpdatesBatch(
+        h_[i] + begin,
+        h_[i + 1] + begin,
+        hu_[i] + begin,
+        hu_[i + 1] + begin,
+        b_[i] + begin,
+        b_[i + 1] + begin,
+        edge + begin,
+        edge + columnSize + begin,
+        edge + 2 * columnSize + begin,
+        edge + 3 * columnSize + begin,
+        end - begin + 1
+      );
+    });
+  };
+
+  {
+#if defined(ENABLE_OPENMP)
+    const int threadCount = omp_get_num_threads();
+    const int thread      = omp_get_thread_num();
+#else
+    const int threadCount = 1;
+    const int thread      = 0;
+#endif
+    // Static partition of the columns, every thread owns [first, last]
+    const int columns = iEnd - iBegin + 1;
+    const int first   = iBegin + (columns * thread) / threadCount;
+    const int last    = iBegin + (columns * (thread + 1)) / threadCount - 1;
+
+    RealType* scratch     = fusedScratch_.data() + std::size_t(thread) * FusedScratchColumns * columnSize;
+    RealType* leftBorder  = scratch;
+    RealType* rightBorder = scratch + 4 * columnSize;
+    RealType* inner[2]    = {scratch + 8 * columnSize, scratch + 12 * columnSize};
+
+    // The border edges read the columns of the neighbouring threads and have to be computed before they change
+    if (first <= last) {
+      computeEdges(first - 1, leftBorder);
+      computeEdges(last, rightBorder);
+    }
+
+#if defined(ENABLE_OPENMP)
+#pragma omp barrier
+#endif
+
+    const RealType* previous = leftBorder;
+    for (int i = first; i <= last; ++i) {
+      RealType* next = rightBorder;
+      if (i < last) {
+        next = inner[(i - first) % 2];
+        computeEdges(i, next);
+      }
+
+      // Only wet cells are updated, their edges are part of the wet x-edges on both sides
+      Tools::WetMask::forEachSpan(wetMask_.getCellSpans(i), activityMap_.getCellRows(i), jBegin, jEnd, [&](int begin, int end) {
+        for (int j = begin; j <= end; ++j) {
+          h_[i][j] -= dt / dx_ * (previous[columnSize + j] + next[j]);
+          hu_[i][j] -= dt / dx_ * (previous[3 * columnSize + j] + next[2 * columnSize + j]);
+        }
+      });
+      previous = next;
+    }
+  }
+
+  // The y-sweep partitions the columns differently
+#if defined(ENABLE_OPENMP)
+#pragma omp barrier
+#endif
+}
+
+template <class SolverPolicy>
+void Blocks::DimensionalSplitting<SolverPolicy>::updateUnknownsFusedY(RealType dt, int iBegin, int iEnd, int jBegin, int jEnd) {
+  if (iBegin > iEnd || jBegin > jEnd) {
+    return;
+  }
+
+  const int columnSize = ny_ + 2;
+
+  {
+#if defined(ENABLE_OPENMP)
+    const int thread = omp_get_thread_num();
+#else
+    const int thread = 0;
+#endif
+    // The columns hLeft, hRight, hvLeft and hvRight of the edges between row j and j + 1, indexed by j
+    RealType* edges = fusedScratch_.data() + std::size_t(thread) * FusedScratchColumns * columnSize;
+
+#if defined(ENABLE_OPENMP)
+#pragma omp for schedule(static)
+#endif
+    for (int i = iBegin; i <= iEnd; ++i) {
+      Tools::WetMask::forEachSpan(wetMask_.getYEdgeSpans(i), activityMap_.getYEdgeRows(i), jBegin - 1, jEnd, [&](int begin, int end) {
+        SolverPolicy::computeNetUpdatesBatch(
+          h_[i] + begin,
+          h_[i] + begin + 1,
+          hv_[i] + begin,
+          hv_[i] + begin + 1,
+          b_[i] + begin,
+          b_[i] + begin + 1,
+          edges + begin,
+          edges + columnSize + begin,
+          edges + 2 * columnSize + begin,
+          edges + 3 * columnSize + begin,
+          end - begin + 1
+        );
+      });
+
+      Tools::WetMask::forEachSpan(wetMask_.getCellSpans(i), activityMap_.getCellRows(i), jBegin, jEnd, [&](int begin, int end) {
+        for (int j = begin; j <= end; ++j) {
+          h_[i][j] -= dt / dy_ * (edges[columnSize + j - 1] + edges[j]);
+          hv_[i][j] -= dt / dy_ * (edges[3 * columnSize + j - 1] + edges[2 * columnSize + j]);
+        }
+      });
+    }
+  }
+}
+
+template void Blocks::DimensionalSplitting<Solvers::FWaveKernel>::updateUnknownsFusedX(RealType, int, int, int, int);
+template void Blocks::DimensionalSplitting<Solvers::FWaveKernel>::updateUnknownsFusedY(RealType, int, int, int, int);
+
+template void Blocks::DimensionalSplitting<Solvers::RusanovKernel>::updateUnknownsFusedX(RealType, int, int, int, int);
+template void Blocks::DimensionalSplitting<Solvers::RusanovKernel>::updateUnknownsFusedY(RealType, int, int, int, int);
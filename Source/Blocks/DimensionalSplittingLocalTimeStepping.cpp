@@ -0,0 +1,301 @@
+#include "DimensionalSplitting.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#if defined(ENABLE_OPENMP)
+  #include <omp.h>
+#endif
+
+template <class SolverPolicy>
+void Blocks::DimensionalSplitting<SolverPolicy>::setTimeStepLevels(int levels) {
+  timeStepLevels_ = std::max(1, levels);
+}
+
+template <class SolverPolicy>
+void Blocks::DimensionalSplitting<SolverPolicy>::computeTimeStepLevels(const SweepRanges& ranges) {
+  const int tileCountX = getTileCountX();
+  const int tileCountY = getTileCountY();
+
+  // Wave speeds of the edges each tile owns
+  RealType maxWaveSpeedX{0.0};
+  RealType maxWaveSpeedY{0.0};
+#if defined(ENABLE_OPENMP)
+#pragma omp for schedule(static)
+#endif
+  for (int tile = 0; tile < tileCountX * tileCountY; ++tile) {
+    const Range edges = getTileEdges(tile / tileCountY, tile % tileCountY);
+    const Range x     = {std::max(edges.iBegin, ranges.xEdges.iBegin), std::min(edges.iEnd, ranges.xEdges.iEnd), std::max(edges.jBegin, ranges.xEdges.jBegin), std::min(edges.jEnd, ranges.xEdges.jEnd)};
+    const Range y     = {std::max(edges.iBegin, ranges.yEdges.iBegin), std::min(edges.iEnd, ranges.yEdges.iEnd), std::max(edges.jBegin, ranges.yEdges.jBegin), std::min(edges.jEnd, ranges.yEdges.jEnd)};
+
+    WaveSpeeds speeds{0.0, 0.0};
+    for (int i = x.iBegin; i <= x.iEnd; ++i) {
+      speeds.x = std::max(speeds.x, computeMaxWaveSpeedXColumn(i, x.jBegin, x.jEnd));
+    }
+    for (int i = y.iBegin; i <= y.iEnd; ++i) {
+      speeds.y = std::max(speeds.y, computeMaxWaveSpeedYColumn(i, y.jBegin, y.jEnd));
+    }
+    tileWaveSpeeds_[tile] = speeds;
+    maxWaveSpeedX         = std::max(maxWaveSpeedX, speeds.x);
+    maxWaveSpeedY         = std::max(maxWaveSpeedY, speeds.y);
+  }
+
+  reduceMaxTimeStep(maxWaveSpeedX, maxWaveSpeedY);
+
+#if defined(ENABLE_OPENMP)
+#pragma omp single
+#endif
+  {
+    const RealType globalTimeStep = maxTimeStep_;
+
+    maxLevel_ = 0;
+    for (int tx = 0; tx < tileCountX; ++tx) {
+      for (int ty = 0; ty < tileCountY; ++ty) {
+        // The edges left of and below the cells belong to the neighbours
+        const int  tile   = tx * tileCountY + ty;
+        WaveSpeeds speeds = tileWaveSpeeds_[tile];
+        if (tx > 0) {
+          speeds.x = std::max(speeds.x, tileWaveSpeeds_[tile - tileCountY].x);
+        }
+        if (ty > 0) {
+          speeds.y = std::max(speeds.y, tileWaveSpeeds_[tile - 1].y);
+        }
+
+        // Same safety factor as in updateMaxTimeStep, dry and inactive tiles get the highest level
+        const RealType infinity = std::numeric_limits<RealType>::infinity();
+        const RealType timeStep = RealType(0.4) * std::min(speeds.x > 0 ? dx_ / speeds.x : infinity, speeds.y > 0 ? dy_ / speeds.y : infinity);
+        int            level    = 0;
+        while (level + 1 < timeStepLevels_ && globalTimeStep * RealType(2 << level) <= timeStep) {
+          level++;
+        }
+        tileLevels_[tile] = level;
+      }
+    }
+
+    // Neighbouring tiles differ by at most one level, so a wave needs a few coarse steps to cross into a much coarser tile
+    for (bool changed = true; changed;) {
+      changed = false;
+      for (int tx = 0; tx < tileCountX; ++tx) {
+        for (int ty = 0; ty < tileCountY; ++ty) {
+          const int tile  = tx * tileCountY + ty;
+          int       level = tileLevels_[tile];
+          if (tx > 0) {
+            level = std::min(level, tileLevels_[tile - tileCountY] + 1);
+          }
+          if (tx < tileCountX - 1) {
+            level = std::min(level, tileLevels_[tile + tileCountY] + 1);
+          }
+          if (ty > 0) {
+            level = std::min(level, tileLevels_[tile - 1] + 1);
+          }
+          if (ty < tileCountY - 1) {
+            level = std::min(level, tileLevels_[tile + 1] + 1);
+          }
+          changed           = changed || level != tileLevels_[tile];
+          tileLevels_[tile] = level;
+        }
+      }
+    }
+
+    for (int tx = 0; tx < tileCountX; ++tx) {
+      for (int ty = 0; ty < tileCountY; ++ty) {
+        maxLevel_ = std::max(maxLevel_, tileLevels_[tx * tileCountY + ty]);
+      }
+    }
+    for (int tx = 0; tx < tileCountX; ++tx) {
+      for (int ty = 0; ty < tileCountY; ++ty) {
+        const Range         cells = getTileCells(tx, ty);
+        const std::uint64_t count = std::uint64_t(cells.iEnd - cells.iBegin + 1) * (cells.jEnd - cells.jBegin + 1);
+        localCellUpdates_ += count << (maxLevel_ - tileLevels_[tx * tileCountY + ty]);
+        globalCellUpdates_ += count << maxLevel_;
+      }
+    }
+
+    maxTimeStep_ = globalTimeStep * RealType(1 << maxLevel_);
+  }
+}
+
+template <class SolverPolicy>
+void Blocks::DimensionalSplitting<SolverPolicy>::updateUnknownsLocal(RealType dt, const SweepRanges& ranges) {
+  const int      tileCountX = getTileCountX();
+  const int      tileCountY = getTileCountY();
+  const int      steps      = 1 << maxLevel_;
+  const RealType stepSize   = dt / steps;
+
+#if defined(ENABLE_OPENMP)
+  const int thread = omp_get_thread_num();
+#else
+  const int thread = 0;
+#endif
+  RealType* scratch = fusedScratch_.data() + std::size_t(thread) * FusedScratchColumns * (ny_ + 2);
+
+  for (int step = 0; step < steps; ++step) {
+    // The work per tile depends on how many of its edges are due in this step
+#if defined(ENABLE_OPENMP)
+#pragma omp for schedule(dynamic)
+#endif
+    for (int tile = 0; tile < tileCountX * tileCountY; ++tile) {
+      const int tx    = tile / tileCountY;
+      const int ty    = tile % tileCountY;
+      const int level = tileLevels_[tile];
+
+      // Edges on the right and upper border of the tile run at the rate of the finer side
+      const int   rightLevel = tx < tileCountX - 1 ? std::min(level, tileLevels_[tile + tileCountY]) : level;
+      const int   upperLevel = ty < tileCountY - 1 ? std::min(level, tileLevels_[tile + 1]) : level;
+      const int   rightEdge  = tx < tileCountX - 1 ? (tx + 1) * tileColumns_ : nx_ + 2;
+      const int   upperEdge  = ty < tileCountY - 1 ? (ty + 1) * tileRows_ : ny_ + 2;
+      auto        isDue      = [&](int edgeLevel) { return step % (1 << edgeLevel) == 0; };
+      const Range edges      = getTileEdges(tx, ty);
+
+      const int xLow  = std::max(edges.jBegin, ranges.xEdges.jBegin);
+      const int xHigh = std::min(edges.jEnd, ranges.xEdges.jEnd);
+      for (int i = std::max(edges.iBegin, ranges.xEdges.iBegin); i <= std::min(edges.iEnd, ranges.xEdges.iEnd); ++i) {
+        const int edgeLevel = i == rightEdge ? rightLevel : level;
+        if (isDue(edgeLevel)) {
+          accumulateNetUpdatesXColumn(i, xLow, xHigh, stepSize * RealType(1 << edgeLevel), scratch);
+        }
+      }
+
+      const int yLow  = std::max(edges.jBegin, ranges.yEdges.jBegin);
+      const int yHigh = std::min(edges.jEnd, ranges.yEdges.jEnd);
+      for (int i = std::max(edges.iBegin, ranges.yEdges.iBegin); i <= std::min(edges.iEnd, ranges.yEdges.iEnd); ++i) {
+        if (isDue(level)) {
+          accumulateNetUpdatesYColumn(i, yLow, std::min(yHigh, upperEdge - 1), stepSize * RealType(1 << level), scratch);
+        }
+        if (upperEdge >= yLow && upperEdge <= yHigh && isDue(upperLevel)) {
+          accumulateNetUpdatesYColumn(i, upperEdge, upperEdge, stepSize * RealType(1 << upperLevel), scratch);
+        }
+      }
+    }
+
+    // Tiles whose step ends now
+#if defined(ENABLE_OPENMP)
+#pragma omp for schedule(dynamic)
+#endif
+    for (int tile = 0; tile < tileCountX * tileCountY; ++tile) {
+      if ((step + 1) % (1 << tileLevels_[tile]) == 0) {
+        applyAccumulatedNetUpdates(tile / tileCountY, tile % tileCountY, ranges.xCells, ranges.yCells);
+      }
+    }
+  }
+}
+
+template <class SolverPolicy>
+void Blocks::DimensionalSplitting<SolverPolicy>::accumulateNetUpdatesXColumn(int i, int jBegin, int jEnd, RealType dt, RealType* scratch) {
+  const int columnSize = ny_ + 2;
+  Tools::WetMask::forEachSpan(wetMask_.getXEdgeSpans(i), activityMap_.getXEdgeRows(i), jBegin, jEnd, [&](int begin, int end) {
+    SolverPolicy::computeNetUpdatesBatch(
+      h_[i] + begin,
+      h_[i + 1] + begin,
+      hu_[i] + begin,
+      hu_[i + 1] + begin,
+      b_[i] + begin,
+      b_[i + 1] + begin,
+      scratch + begin,
+      scratch + columnSize + begin,
+      scratch + 2 * columnSize + begin,
+      scratch + 3 * columnSize + begin,
+      end - begin + 1
+    );
+    for (int j = begin; j <= end; ++j) {
+      hNetUpdatesXLeft_[i][j] += dt * scratch[j];
+      hNetUpdatesXRight_[i][j] += dt * scratch[columnSize + j];
+      huNetUpdatesXLeft_[i][j] += dt * scratch[2 * columnSize + j];
+      huNetUpdatesXRight_[i][j] += dt * scratch[3 * columnSize + j];
+    }
+  });
+}
+
+template <class SolverPolicy>
+void Blocks::DimensionalSplitting<SolverPolicy>::accumulateNetUpdatesYColumn(int i, int jBegin, int jEnd, RealType dt, RealType* scratch) {
+  const int columnSize = ny_ + 2;
+  Tools::WetMask::forEachSpan(wetMask_.getYEdgeSpans(i), activityMap_.getYEdgeRows(i), jBegin, jEnd, [&](int begin, int end) {
+    SolverPolicy::computeNetUpdatesBatch(
+      h_[i] + begin,
+      h_[i] + begin + 1,
+      hv_[i] + begin,
+      hv_[i] + begin + 1,
+      b_[i] + begin,
+      b_[i] + begin + 1,
+      scratch + begin,
+      scratch + columnSize + begin,
+      scratch + 2 * columnSize + begin,
+      scratch + 3 * columnSize + begin,
+      end - begin + 1
+    );
+    for (int j = begin; j <= end; ++j) {
+      hNetUpdatesYLeft_[i][j] += dt * scratch[j];
+      hNetUpdatesYRight_[i][j] += dt * scratch[columnSize + j];
+      hvNetUpdatesYLeft_[i][j] += dt * scratch[2 * columnSize + j];
+      hvNetUpdatesYRight_[i][j] += dt * scratch[3 * columnSize + j];
+    }
+  });
+}
+
+template <class SolverPolicy>
+void Blocks::DimensionalSplitting<SolverPolicy>::applyAccumulatedNetUpdates(int tx, int ty, const Range& xCells, const Range& yCells) {
+  const auto [iBegin, iEnd, jBegin, jEnd] = getTileCells(tx, ty);
+  const int rowCount                      = jEnd - jBegin + 1;
+
+  for (int i = iBegin; i <= iEnd; ++i) {
+    if (i >= xCells.iBegin && i <= xCells.iEnd) {
+      Tools::WetMask::forEachSpan(wetMask_.getCellSpans(i), activityMap_.getCellRows(i), std::max(jBegin, xCells.jBegin), std::min(jEnd, xCells.jEnd), [&](int begin, int end) {
+        for (int j = begin; j <= end; ++j) {
+          h_[i][j] -= (hNetUpdatesXRight_[i - 1][j] + hNetUpdatesXLeft_[i][j]) / dx_;
+          hu_[i][j] -= (huNetUpdatesXRight_[i - 1][j] + huNetUpdatesXLeft_[i][j]) / dx_;
+        }
+      });
+    }
+    if (i >= yCells.iBegin && i <= yCells.iEnd) {
+      Tools::WetMask::forEachSpan(wetMask_.getCellSpans(i), activityMap_.getCellRows(i), std::max(jBegin, yCells.jBegin), std::min(jEnd, yCells.jEnd), [&](int begin, int end) {
+        for (int j = begin; j <= end; ++j) {
+          h_[i][j] -= (hNetUpdatesYRight_[i][j - 1] + hNetUpdatesYLeft_[i][j]) / dy_;
+          hv_[i][j] -= (hvNetUpdatesYRight_[i][j - 1] + hvNetUpdatesYLeft_[i][j]) / dy_;
+        }
+      });
+    }
+
+    // Clear everything the cells of the tile receive, including the net updates of dry cells and of cells outside the
+    // ranges, and at the boundary what the ghost cells would receive
+    std::fill_n(hNetUpdatesXRight_[i - 1] + jBegin, rowCount, RealType(0.0));
+    std::fill_n(huNetUpdatesXRight_[i - 1] + jBegin, rowCount, RealType(0.0));
+    std::fill_n(hNetUpdatesXLeft_[i] + jBegin, rowCount, RealType(0.0));
+    std::fill_n(huNetUpdatesXLeft_[i] + jBegin, rowCount, RealType(0.0));
+    if (i == 1) {
+      std::fill_n(hNetUpdatesXLeft_[0] + jBegin, rowCount, RealType(0.0));
+      std::fill_n(huNetUpdatesXLeft_[0] + jBegin, rowCount, RealType(0.0));
+    }
+    if (i == nx_) {
+      std::fill_n(hNetUpdatesXRight_[nx_] + jBegin, rowCount, RealType(0.0));
+      std::fill_n(huNetUpdatesXRight_[nx_] + jBegin, rowCount, RealType(0.0));
+    }
+    if (i < hNetUpdatesYLeft_.getCols()) {
+      std::fill_n(hNetUpdatesYRight_[i] + jBegin - 1, rowCount, RealType(0.0));
+      std::fill_n(hvNetUpdatesYRight_[i] + jBegin - 1, rowCount, RealType(0.0));
+      std::fill_n(hNetUpdatesYLeft_[i] + jBegin, rowCount, RealType(0.0));
+      std::fill_n(hvNetUpdatesYLeft_[i] + jBegin, rowCount, RealType(0.0));
+      if (jBegin == 1) {
+        hNetUpdatesYLeft_[i][0]  = 0;
+        hvNetUpdatesYLeft_[i][0] = 0;
+      }
+      if (jEnd == ny_) {
+        hNetUpdatesYRight_[i][ny_]  = 0;
+        hvNetUpdatesYRight_[i][ny_] = 0;
+      }
+    }
+  }
+}
+
+template void Blocks::DimensionalSplitting<Solvers::FWaveKernel>::setTimeStepLevels(int);
+template void Blocks::DimensionalSplitting<Solvers::FWaveKernel>::computeTimeStepLevels(const SweepRanges&);
+template void Blocks::DimensionalSplitting<Solvers::FWaveKernel>::updateUnknownsLocal(RealType, const SweepRanges&);
+template void Blocks::DimensionalSplitting<Solvers::FWaveKernel>::accumulateNetUpdatesXColumn(int, int, int, RealType, RealType*);
+template void Blocks::DimensionalSplitting<Solvers::FWaveKernel>::accumulateNetUpdatesYColumn(int, int, int, RealType, RealType*);
+template void Blocks::DimensionalSplitting<Solvers::FWaveKernel>::applyAccumulatedNetUpdates(int, int, const Range&, const Range&);
+
+template void Blocks::DimensionalSplitting<Solvers::RusanovKernel>::setTimeStepLevels(int);
+template void Blocks::DimensionalSplitting<Solvers::RusanovKernel>::computeTimeStepLevels(const SweepRanges&);
+template void Blocks::DimensionalSplitting<Solvers::RusanovKernel>::updateUnknownsLocal(RealType, const SweepRanges&);
+template void Blocks::DimensionalSplitting<Solvers::RusanovKernel>::accumulateNetUpdatesXColumn(int, int, int, RealType, RealType*);
+template void Blocks::DimensionalSplitting<Solvers::RusanovKernel>::accumulateNetUpdatesYColumn(int, int, int, RealType, RealType*);
+template void Blocks::DimensionalSplitting<Solvers::RusanovKernel>::applyAccumulatedNetUpdates(int, int, const Range&, const Range&);
@@ -0,0 +1,61 @@
+#include "DimensionalSplitting.h"
+
+#include <algorithm>
+
+template <class SolverPolicy>
+void Blocks::DimensionalSplitting<SolverPolicy>::runTileTasks(
+  const SweepRanges& ranges, bool computeFluxes, bool updateCells, RealType dt, RealType& o_maxWaveSpeedX, RealType& o_maxWaveSpeedY
+) {
+  const int tileCountX = getTileCountX();
+  const int tileCountY = getTileCountY();
+
+  // Only the addresses matter, a flux task writes the entry of its tile and the update tasks read it
+  [[maybe_unused]] char* dependencies = tileDependencies_.data();
+
+  RealType maxWaveSpeedX{0.0};
+  RealType maxWaveSpeedY{0.0};
+
+#if defined(ENABLE_OPENMP)
+#pragma omp single
+#endif
+  {
+    // Tasks can only depend on tasks created before them. In this order the net updates of the left and lower
+    // neighbour already exist when the update task of a tile is created.
+    for (int tx = 0; tx < tileCountX; ++tx) {
+      for (int ty = 0; ty < tileCountY; ++ty) {
+        const int tile = tx * tileCountY + ty;
+        if (computeFluxes) {
+#if defined(ENABLE_OPENMP)
+#pragma omp task default(shared) firstprivate(tx, ty, tile) depend(out : dependencies[tile])
+#endif
+          tileWaveSpeeds_[tile] = computeNetUpdatesTile(tx, ty, ranges.xEdges, ranges.yEdges);
+        }
+        if (updateCells) {
+          [[maybe_unused]] const int left  = tx > 0 ? tile - tileCountY : tile;
+          [[maybe_unused]] const int lower = ty > 0 ? tile - 1 : tile;
+#if defined(ENABLE_OPENMP)
+#pragma omp task default(shared) firstprivate(tx, ty) depend(in : dependencies[tile], dependencies[left], dependencies[lower])
+#endif
+          updateUnknownsTile(dt, tx, ty, ranges.xCells, ranges.yCells);
+        }
+      }
+    }
+
+#if defined(ENABLE_OPENMP)
+#pragma omp taskwait
+#endif
+    if (computeFluxes) {
+      for (int tile = 0; tile < tileCountX * tileCountY; ++tile) {
+        maxWaveSpeedX = std::max(maxWaveSpeedX, tileWaveSpeeds_[tile].x);
+        maxWaveSpeedY = std::max(maxWaveSpeedY, tileWaveSpeeds_[tile].y);
+      }
+    }
+  }
+
+  o_maxWaveSpeedX = maxWaveSpeedX;
+  o_maxWaveSpeedY = maxWaveSpeedY;
+}
+
+template void Blocks::DimensionalSplitting<Solvers::FWaveKernel>::runTileTasks(const SweepRanges&, bool, bool, RealType, RealType&, RealType&);
+
+template void Blocks::DimensionalSplitting<Solvers::RusanovKernel>::runTileTasks(const SweepRanges&, bool, bool, RealType, RealType&, RealType&);
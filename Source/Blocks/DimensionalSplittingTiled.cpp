@@ -0,0 +1,182 @@
+#include "DimensionalSplitting.h"
+
+#include <algorithm>
+#include <chrono>
+
+template <class SolverPolicy>
+typename Blocks::DimensionalSplitting<SolverPolicy>::Range Blocks::DimensionalSplitting<SolverPolicy>::getTileCells(int tx, int ty) const {
+  return {tx * tileColumns_ + 1, std::min((tx + 1) * tileColumns_, nx_), ty * tileRows_ + 1, std::min((ty + 1) * tileRows_, ny_)};
+}
+
+template <class SolverPolicy>
+typename Blocks::DimensionalSplitting<SolverPolicy>::Range Blocks::DimensionalSplitting<SolverPolicy>::getTileEdges(int tx, int ty) const {
+  return {
+    tx == 0 ? 0 : tx * tileColumns_ + 1,
+    tx == getTileCountX() - 1 ? nx_ + 1 : (tx + 1) * tileColumns_,
+    ty == 0 ? 0 : ty * tileRows_ + 1,
+    ty == getTileCountY() - 1 ? ny_ + 1 : (ty + 1) * tileRows_};
+}
+
+template <class SolverPolicy>
+typename Blocks::DimensionalSplitting<SolverPolicy>::WaveSpeeds Blocks::DimensionalSplitting<SolverPolicy>::computeNetUpdatesTile(
+  int tx, int ty, const Range& xEdges, const Range& yEdges
+) {
+  const auto [iBegin, iEnd, jBegin, jEnd] = getTileEdges(tx, ty);
+
+  WaveSpeeds maxWaveSpeeds{0.0, 0.0};
+  for (int i = std::max(iBegin, xEdges.iBegin); i <= std::min(iEnd, xEdges.iEnd); ++i) {
+    maxWaveSpeeds.x = std::max(maxWaveSpeeds.x, computeNetUpdatesXColumn(i, std::max(jBegin, xEdges.jBegin), std::min(jEnd, xEdges.jEnd)));
+  }
+  for (int i = std::max(iBegin, yEdges.iBegin); i <= std::min(iEnd, yEdges.iEnd); ++i) {
+    maxWaveSpeeds.y = std::max(maxWaveSpeeds.y, computeNetUpdatesYColumn(i, std::max(jBegin, yEdges.jBegin), std::min(jEnd, yEdges.jEnd)));
+  }
+  return maxWaveSpeeds;
+}
+
+template <class SolverPolicy>
+void Blocks::DimensionalSplitting<SolverPolicy>::updateUnknownsTile(RealType dt, int tx, int ty, const Range& xCells, const Range& yCells) {
+  const auto [iBegin, iEnd, jBegin, jEnd] = getTileCells(tx, ty);
+
+  for (int i = iBegin; i <= iEnd; ++i) {
+    // Rows of column i that receive the x- and the y-update, empty if the column is outside of the range
+    const bool inX   = i >= xCells.iBegin && i <= xCells.iEnd;
+    const bool inY   = i >= yCells.iBegin && i <= yCells.iEnd;
+    const int  xLow  = std::max(jBegin, xCells.jBegin);
+    const int  xHigh = inX ? std::min(jEnd, xCells.jEnd) : xLow - 1;
+    const int  yLow  = std::max(jBegin, yCells.jBegin);
+    const int  yHigh = inY ? std::min(jEnd, yCells.jEnd) : yLow - 1;
+
+    auto updateX = [&](int j) {
+      h_[i][j] -= dt / dx_ * (hNetUpdatesXRight_[i - 1][j] + hNetUpdatesXLeft_[i][j]);
+      hu_[i][j] -= dt / dx_ * (huNetUpdatesXRight_[i - 1][j] + huNetUpdatesXLeft_[i][j]);
+    };
+    auto updateY = [&](int j) {
+      h_[i][j] -= dt / dy_ * (hNetUpdatesYRight_[i][j - 1] + hNetUpdatesYLeft_[i][j]);
+      hv_[i][j] -= dt / dy_ * (hvNetUpdatesYRight_[i][j - 1] + hvNetUpdatesYLeft_[i][j]);
+    };
+
+    Tools::WetMask::forEachSpan(wetMask_.getCellSpans(i), activityMap_.getCellRows(i), std::min(xLow, yLow), std::max(xHigh, yHigh), [&](int begin, int end) {
+      // Both updates in one pass over the cells, the x-update first like in the buffered mode
+      const int bothBegin = std::max({begin, xLow, yLow});
+      const int bothEnd   = std::min({end, xHigh, yHigh});
+      for (int j = bothBegin; j <= bothEnd; ++j) {
+        updateX(j);
+        updateY(j);
+      }
+
+      // The rows at the ends of the ranges that only receive one of the updates
+      auto forEachRemainingRow = [&](int low, int high, auto&& update) {
+        if (bothBegin > bothEnd) {
+          for (int j = low; j <= high; ++j) {
+            update(j);
+          }
+          return;
+        }
+        for (int j = low; j <= std::min(high, bothBegin - 1); ++j) {
+          update(j);
+        }
+        for (int j = std::max(low, bothEnd + 1); j <= high; ++j) {
+          update(j);
+        }
+      };
+      forEachRemainingRow(std::max(begin, xLow), std::min(end, xHigh), updateX);
+      forEachRemainingRow(std::max(begin, yLow), std::min(end, yHigh), updateY);
+    });
+  }
+}
+
+template <class SolverPolicy>
+void Blocks::DimensionalSplitting<SolverPolicy>::computeNetUpdatesTiled(Range xEdges, Range yEdges, RealType& o_maxWaveSpeedX, RealType& o_maxWaveSpeedY) {
+  const int tileCountX = getTileCountX();
+  const int tileCountY = getTileCountY();
+
+  RealType maxWaveSpeedX{0.0};
+  RealType maxWaveSpeedY{0.0};
+
+#if defined(ENABLE_OPENMP)
+#pragma omp for collapse(2) schedule(static) nowait
+#endif
+  for (int tx = 0; tx < tileCountX; ++tx) {
+    for (int ty = 0; ty < tileCountY; ++ty) {
+      const WaveSpeeds maxWaveSpeeds = computeNetUpdatesTile(tx, ty, xEdges, yEdges);
+      maxWaveSpeedX                  = std::max(maxWaveSpeedX, maxWaveSpeeds.x);
+      maxWaveSpeedY                  = std::max(maxWaveSpeedY, maxWaveSpeeds.y);
+    }
+  }
+
+  o_maxWaveSpeedX = maxWaveSpeedX;
+  o_maxWaveSpeedY = maxWaveSpeedY;
+}
+
+template <class SolverPolicy>
+void Blocks::DimensionalSplitting<SolverPolicy>::updateUnknownsTiled(RealType dt, Range xCells, Range yCells) {
+  const int tileCountX = getTileCountX();
+  const int tileCountY = getTileCountY();
+
+#if defined(ENABLE_OPENMP)
+#pragma omp for collapse(2) schedule(static)
+#endif
+  for (int tx = 0; tx < tileCountX; ++tx) {
+    for (int ty = 0; ty < tileCountY; ++ty) {
+      updateUnknownsTile(dt, tx, ty, xCells, yCells);
+    }
+  }
+}
+
+template <class SolverPolicy>
+void Blocks::DimensionalSplitting<SolverPolicy>::setTileSize(int columns, int rows) {
+  tileColumns_ = std::max(1, columns);
+  tileRows_    = std::max(1, rows);
+}
+
+template <class SolverPolicy>
+void Blocks::DimensionalSplitting<SolverPolicy>::autotuneTileSize() {
+  const RealType maxTimeStep = maxTimeStep_;
+
+  int    bestColumns = tileColumns_;
+  int    bestRows    = tileRows_;
+  double bestTime    = -1.0;
+  for (int columns : {4, 16, 64}) {
+    for (int rows : {64, 256, 1024, ny_}) {
+      if (columns > nx_ || rows > ny_) {
+        continue;
+      }
+      setTileSize(columns, rows);
+
+      // The fastest of a few runs, the first one may still fault in pages
+      double time = -1.0;
+      for (int run = 0; run < 3; run++) {
+        const auto start = std::chrono::steady_clock::now();
+        computeNumericalFluxes();
+        const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        time                 = time < 0.0 ? elapsed : std::min(time, elapsed);
+      }
+      if (bestTime < 0.0 || time < bestTime) {
+        bestTime    = time;
+        bestColumns = columns;
+        bestRows    = rows;
+      }
+    }
+  }
+
+  setTileSize(bestColumns, bestRows);
+  maxTimeStep_ = maxTimeStep;
+}
+
+template Blocks::DimensionalSplitting<Solvers::FWaveKernel>::Range Blocks::DimensionalSplitting<Solvers::FWaveKernel>::getTileCells(int, int) const;
+template Blocks::DimensionalSplitting<Solvers::FWaveKernel>::Range Blocks::DimensionalSplitting<Solvers::FWaveKernel>::getTileEdges(int, int) const;
+template Blocks::DimensionalSplitting<Solvers::FWaveKernel>::WaveSpeeds Blocks::DimensionalSplitting<Solvers::FWaveKernel>::computeNetUpdatesTile(int, int, const Range&, const Range&);
+template void Blocks::DimensionalSplitting<Solvers::FWaveKernel>::updateUnknownsTile(RealType, int, int, const Range&, const Range&);
+template void Blocks::DimensionalSplitting<Solvers::FWaveKernel>::computeNetUpdatesTiled(Range, Range, RealType&, RealType&);
+template void Blocks::DimensionalSplitting<Solvers::FWaveKernel>::updateUnknownsTiled(RealType, Range, Range);
+template void Blocks::DimensionalSplitting<Solvers::FWaveKernel>::setTileSize(int, int);
+template void Blocks::DimensionalSplitting<Solvers::FWaveKernel>::autotuneTileSize();
+
+template Blocks::DimensionalSplitting<Solvers::RusanovKernel>::Range Blocks::DimensionalSplitting<Solvers::RusanovKernel>::getTileCells(int, int) const;
+template Blocks::DimensionalSplitting<Solvers::RusanovKernel>::Range Blocks::DimensionalSplitting<Solvers::RusanovKernel>::getTileEdges(int, int) const;
+template Blocks::DimensionalSplitting<Solvers::RusanovKernel>::WaveSpeeds Blocks::DimensionalSplitting<Solvers::RusanovKernel>::computeNetUpdatesTile(int, int, const Range&, const Range&);
+template void Blocks::DimensionalSplitting<Solvers::RusanovKernel>::updateUnknownsTile(RealType, int, int, const Range&, const Range&);
+template void Blocks::DimensionalSplitting<Solvers::RusanovKernel>::computeNetUpdatesTiled(Range, Range, RealType&, RealType&);
+template void Blocks::DimensionalSplitting<Solvers::RusanovKernel>::updateUnknownsTiled(RealType, Range, Range);
+template void Blocks::DimensionalSplitting<Solvers::RusanovKernel>::setTileSize(int, int);
+template void Blocks::DimensionalSplitting<Solvers::RusanovKernel>::autotuneTileSize();
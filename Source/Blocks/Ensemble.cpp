@@ -0,0 +1,142 @@
+#include "Ensemble.h"
+
+#include <limits>
+
+#if defined(ENABLE_OPENMP)
+#include <omp.h>
+#endif
+
+template <class SolverPolicy>
+Blocks::Ensemble<SolverPolicy>::Ensemble(
+  int                  nx,
+  int                  ny,
+  RealType             dx,
+  RealType             dy,
+  RealType             offsetX,
+  RealType             offsetY,
+  Scenarios::Scenario& scenario,
+  int                  members,
+  ExecutionMode        executionMode
+):
+  offsetX_(offsetX),
+  offsetY_(offsetY),
+  dx_(dx),
+  dy_(dy),
+  times_(members, RealType(0.0)),
+  maxElevations_(members, RealType(0.0)),
+  steps_(members, 0) {
+
+  // The only pass over the bathymetry of the scenario, the other members share it. The water height is set by
+  // initialiseMember, so it is not read from the scenario.
+  members_.push_back(std::make_unique<DimensionalSplitting<SolverPolicy>>(nx, ny, dx, dy, executionMode));
+  members_[0]->initialiseBathymetry(offsetX, offsetY, scenario);
+  const Tools::Float2D<RealType>& b = members_[0]->getBathymetry();
+  for (int member = 1; member < members; member++) {
+    members_.push_back(std::make_unique<DimensionalSplitting<SolverPolicy>>(nx, ny, dx, dy, b, executionMode));
+    for (int edge = BoundaryEdge::Left; edge <= BoundaryEdge::Top; edge++) {
+      members_.back()->setBoundaryType(BoundaryEdge(edge), scenario.getBoundaryType(BoundaryEdge(edge)));
+    }
+  }
+
+#if defined(ENABLE_OPENMP)
+  setTeams(std::min(omp_get_max_threads(), members));
+#endif
+}
+
+template <class SolverPolicy>
+void Blocks::Ensemble<SolverPolicy>::setTeams(int teams) {
+  teams_ = std::max(teams, 1);
+}
+
+template <class SolverPolicy>
+std::uint64_t Blocks::Ensemble<SolverPolicy>::getCellUpdates() const {
+  std::uint64_t cellUpdates = 0;
+  for (int member = 0; member < getMemberCount(); member++) {
+    cellUpdates += steps_[member] * std::uint64_t(members_[member]->getNx()) * members_[member]->getNy();
+  }
+  return cellUpdates;
+}
+
+template <class SolverPolicy>
+void Blocks::Ensemble<SolverPolicy>::recordElevation(int member) {
+  auto&                           block = *members_[member];
+  const Tools::Float2D<RealType>& h     = block.getWaterHeight();
+  const Tools::Float2D<RealType>& b     = block.getBathymetry();
+  const auto [x, y]                     = destination_;
+  for (int i = std::max(x - 3, 1); i <= std::min(x + 3, block.getNx()); i++) {
+    for (int j = std::max(y - 3, 1); j <= std::min(y + 3, block.getNy()); j++) {
+      if (h[i][j] > RealType(0.0)) {
+        maxElevations_[member] = std::max(maxElevations_[member], h[i][j] + b[i][j]);
+      }
+    }
+  }
+}
+
+template <class SolverPolicy>
+void Blocks::Ensemble<SolverPolicy>::advanceMember(int member, RealType time) {
+  auto&    block = *members_[member];
+  RealType t     = times_[member];
+  while (t < time) {
+    block.setGhostLayer();
+    block.computeNumericalFluxes();
+
+    // The last step ends exactly at time
+    const RealType remaining = time - t;
+    if (block.getMaxTimeStep() < remaining) {
+      block.updateUnknowns(block.getMaxTimeStep());
+      t += block.getMaxTimeStep();
+    } else {
+      block.updateUnknowns(remaining);
+      t = time;
+    }
+    steps_[member]++;
+    recordElevation(member);
+  }
+  times_[member] = t;
+}
+
+template <class SolverPolicy>
+void Blocks::Ensemble<SolverPolicy>::simulateUntil(RealType time) {
+  const int members = getMemberCount();
+#if defined(ENABLE_OPENMP)
+  if (teams_ > 1) {
+    // The blocks open their parallel regions nested inside with the size of the team
+    const int threads      = std::max(omp_get_max_threads() / teams_, 1);
+    const int activeLevels = omp_get_max_active_levels();
+    omp_set_max_active_levels(std::max(activeLevels, 2));
+#pragma omp parallel num_threads(teams_) proc_bind(spread)
+    {
+      omp_set_num_threads(threads);
+#pragma omp for schedule(dynamic, 1)
+      for (int member = 0; member < members; member++) {
+        advanceMember(member, time);
+      }
+    }
+    omp_set_max_active_levels(activeLevels);
+  } else
+#endif
+  {
+    for (int member = 0; member < members; member++) {
+      advanceMember(member, time);
+    }
+  }
+  time_ = time;
+}
+
+template <class SolverPolicy>
+typename Blocks::Ensemble<SolverPolicy>::Statistics Blocks::Ensemble<SolverPolicy>::summarise(const std::vector<RealType>& maxElevations, RealType threshold) {
+  Statistics statistics{RealType(0.0), -std::numeric_limits<RealType>::max(), RealType(0.0)};
+  for (const RealType elevation : maxElevations) {
+    statistics.mean += elevation;
+    statistics.max = std::max(statistics.max, elevation);
+    if (elevation > threshold) {
+      statistics.exceedance += 1;
+    }
+  }
+  statistics.mean /= RealType(maxElevations.size());
+  statistics.exceedance /= RealType(maxElevations.size());
+  return statistics;
+}
+
+template class Blocks::Ensemble<Solvers::FWaveKernel>;
+template class Blocks::Ensemble<Solvers::RusanovKernel>;
@@ -0,0 +1,148 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "DimensionalSplitting.h"
+#include "Scenarios/Scenario.hpp"
+
+namespace Blocks {
+  /**
+   * An ensemble of runs over the same bathymetry that only differ in their initial condition, e.g. perturbations of
+   * the epicenter and the magnitude of an earthquake.
+   *
+   * The first member reads the bathymetry from the scenario once and owns it, all other members are
+   * Blocks::DimensionalSplitting blocks that read it and only have h, hu and hv of their own. By default the members run
+   * in ExecutionMode::Fused, which does not store net updates either. The members are independent: simulateUntil
+   * advances every member with its own time steps up to the given time. They are distributed over teams of threads,
+   * a team advances one member at a time with the parallel regions of the block.
+   *
+   * Around the destination every member records the highest surface elevation h + b of the wet cells after each of
+   * its time steps, getStatistics summarises them over the ensemble.
+   *
+   * @tparam SolverPolicy the edge solver used in the sweeps, see Blocks::DimensionalSplitting.
+   */
+  template <class SolverPolicy = Solvers::FWaveKernel>
+  class Ensemble {
+  public:
+    /**
+     * Highest surface elevation at the destination over the members.
+     */
+    struct Statistics {
+      RealType mean;
+      RealType max;
+      //! fraction of the members that exceed the threshold
+      RealType exceedance;
+    };
+
+    /**
+     * @param nx, ny, dx, dy size of the members.
+     * @param offsetX, offsetY origin of the members.
+     * @param scenario provides the bathymetry and the boundary types.
+     * @param members number of members.
+     * @param executionMode execution mode of the members.
+     */
+    Ensemble(
+      int                  nx,
+      int                  ny,
+      RealType             dx,
+      RealType             dy,
+      RealType             offsetX,
+      RealType             offsetY,
+      Scenarios::Scenario& scenario,
+      int                  members,
+      ExecutionMode        executionMode = ExecutionMode::Fused
+    );
+
+    /**
+     * @brief Sets a member to the sea at rest, raised by displacement(x, y) at the cell centers (x, y), and at rest.
+     */
+    template <class Displacement>
+    void initialiseMember(int member, Displacement&& displacement);
+
+    /**
+     * @brief The statistics are taken over the wet cells within 3 cells of the destination, like the corridor search.
+     */
+    void setDestination(std::pair<int, int> destination) { destination_ = destination; }
+
+    /**
+     * @brief Splits the threads into teams of omp_get_max_threads() / teams threads. By default there are as many
+     * teams as threads (or members, if there are less), so that every member runs on a single thread.
+     */
+    void setTeams(int teams);
+    int  getTeams() const { return teams_; }
+
+    /**
+     * @brief Advances every member up to time, the last time step of a member is shortened to end there.
+     */
+    void simulateUntil(RealType time);
+
+    int                                 getMemberCount() const { return int(members_.size()); }
+    DimensionalSplitting<SolverPolicy>& getMember(int member) const { return *members_[member]; }
+    RealType                            getTime() const { return time_; }
+    std::uint64_t                       getCellUpdates() const;
+
+    //! The bathymetry of all members.
+    const Tools::Float2D<RealType>& getBathymetry() const { return members_[0]->getBathymetry(); }
+
+    //! Highest surface elevation at the destination of a member so far.
+    RealType   getMaxElevation(int member) const { return maxElevations_[member]; }
+    Statistics getStatistics(RealType threshold) const { return summarise(maxElevations_, threshold); }
+
+    //! Statistics of the highest surface elevations of the members.
+    static Statistics summarise(const std::vector<RealType>& maxElevations, RealType threshold);
+
+  private:
+    std::vector<std::unique_ptr<DimensionalSplitting<SolverPolicy>>> members_;
+
+    RealType offsetX_;
+    RealType offsetY_;
+    RealType dx_;
+    RealType dy_;
+
+    std::pair<int, int> destination_{0, 0};
+    int                 teams_{1};
+
+    RealType                   time_{0.0};
+    std::vector<RealType>      times_;
+    std::vector<RealType>      maxElevations_;
+    std::vector<std::uint64_t> steps_;
+
+    //! Advances a member from its time up to time.
+    void advanceMember(int member, RealType time);
+
+    //! Updates the highest surface elevation of a member around the destination.
+    void recordElevation(int member);
+  };
+
+  template <class SolverPolicy>
+  template <class Displacement>
+  void Ensemble<SolverPolicy>::initialiseMember(int member, Displacement&& displacement) {
+    auto&                           block = *members_[member];
+    const Tools::Float2D<RealType>& b     = block.getBathymetry();
+    Tools::Float2D<RealType>        h     = block.getWaterHeight();
+    Tools::Float2D<RealType>        hu    = block.getDischargeHu();
+    Tools::Float2D<RealType>        hv    = block.getDischargeHv();
+    for (int i = 1; i <= block.getNx(); i++) {
+      for (int j = 1; j <= block.getNy(); j++) {
+        const RealType x = offsetX_ + (i - RealType(0.5)) * dx_;
+        const RealType y = offsetY_ + (j - RealType(0.5)) * dy_;
+        h[i][j]          = b[i][j] < RealType(0.0) ? displacement(x, y) - b[i][j] : RealType(0.0);
+        hu[i][j]         = RealType(0.0);
+        hv[i][j]         = RealType(0.0);
+      }
+    }
+    block.setH(h);
+    block.setHu(hu);
+    block.setHv(hv);
+
+    times_[member]         = time_;
+    maxElevations_[member] = RealType(0.0);
+    recordElevation(member);
+  }
+
+  extern template class Ensemble<Solvers::FWaveKernel>;
+  extern template class Ensemble<Solvers::RusanovKernel>;
+} // namespace Blocks
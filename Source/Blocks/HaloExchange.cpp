@@ -0,0 +1,127 @@
+#include "HaloExchange.h"
+
+#if defined(ENABLE_MPI)
+
+Blocks::HaloExchange::HaloExchange(Block& block, const int (&neighbours)[4], int width, MPI_Comm communicator):
+  width_(width) {
+  // A receive and a send for every edge
+  requests_[0].reserve(8);
+
+  for (const BoundaryEdge edge : {BoundaryEdge::Left, BoundaryEdge::Right, BoundaryEdge::Bottom, BoundaryEdge::Top}) {
+    const int neighbour = neighbours[edge];
+    if (neighbour == MPI_PROC_NULL) {
+      continue;
+    }
+
+    // The ghost layer at depth d receives the layer the neighbour has at the same distance from its own halo
+    for (int depth = 0; depth < width_; depth++) {
+      ghostLayers_[edge].emplace_back(block.grabGhostLayer(edge, depth));
+      copyLayers_[edge].emplace_back(block.registerCopyLayer(edge, 2 * width_ - 2 - depth));
+    }
+
+    // The rows of a wide halo include the corners, which arrived with the columns
+    const bool column = edge == BoundaryEdge::Left || edge == BoundaryEdge::Right;
+    const bool corner = !column && width_ > 1;
+    firstCell_[edge]  = corner ? 0 : 1;
+    cellCount_[edge]  = column ? block.getNy() : block.getNx() + (corner ? 2 : 0);
+
+    const int count = 3 * width_ * cellCount_[edge];
+    sendBuffers_[edge].resize(count);
+    receiveBuffers_[edge].resize(count);
+
+    // A message is tagged with the edge it leaves the sender through, the neighbour receives it at the opposite edge
+    const int                 opposite = edge ^ 1;
+    std::vector<MPI_Request>& requests = requests_[getPhase(edge)];
+    MPI_Request               request;
+    MPI_Recv_init(receiveBuffers_[edge].data(), count, MY_MPI_FLOAT, neighbour, opposite, communicator, &request);
+    requests.push_back(request);
+    MPI_Send_init(sendBuffers_[edge].data(), count, MY_MPI_FLOAT, neighbour, edge, communicator, &request);
+    requests.push_back(request);
+  }
+}
+
+Blocks::HaloExchange::~HaloExchange() {
+  for (std::vector<MPI_Request>& requests : requests_) {
+    for (MPI_Request& request : requests) {
+      MPI_Request_free(&request);
+    }
+  }
+}
+
+void Blocks::HaloExchange::exchange() {
+  start();
+  wait();
+}
+
+void Blocks::HaloExchange::start() { startPhase(0); }
+
+void Blocks::HaloExchange::wait() {
+  completePhase(0);
+  if (!requests_[1].empty()) {
+    startPhase(1);
+    completePhase(1);
+  }
+}
+
+int Blocks::HaloExchange::getPhase(BoundaryEdge edge) const {
+  return width_ > 1 && (edge == BoundaryEdge::Bottom || edge == BoundaryEdge::Top) ? 1 : 0;
+}
+
+void Blocks::HaloExchange::startPhase(int phase) {
+  for (const BoundaryEdge edge : {BoundaryEdge::Left, BoundaryEdge::Right, BoundaryEdge::Bottom, BoundaryEdge::Top}) {
+    if (copyLayers_[edge].empty() || getPhase(edge) != phase) {
+      continue;
+    }
+    const int count = cellCount_[edge];
+    for (int depth = 0; depth < width_; depth++) {
+      pack(*copyLayers_[edge][depth], firstCell_[edge], count, &sendBuffers_[edge][3 * depth * count]);
+    }
+  }
+  MPI_Startall(static_cast<int>(requests_[phase].size()), requests_[phase].data());
+}
+
+void Blocks::HaloExchange::completePhase(int phase) {
+  MPI_Waitall(static_cast<int>(requests_[phase].size()), requests_[phase].data(), MPI_STATUSES_IGNORE);
+  for (const BoundaryEdge edge : {BoundaryEdge::Left, BoundaryEdge::Right, BoundaryEdge::Bottom, BoundaryEdge::Top}) {
+    if (ghostLayers_[edge].empty() || getPhase(edge) != phase) {
+      continue;
+    }
+    const int count = cellCount_[edge];
+    for (int depth = 0; depth < width_; depth++) {
+      unpack(&receiveBuffers_[edge][3 * depth * count], firstCell_[edge], count, *ghostLayers_[edge][depth]);
+    }
+  }
+}
+
+void Blocks::HaloExchange::pack(const Block1D& layer, int first, int count, RealType* buffer) {
+  RealType* const h  = buffer;
+  RealType* const hu = h + count;
+  RealType* const hv = hu + count;
+
+  // Contiguous for the columns, a gather for the rows
+#if defined(ENABLE_OPENMP)
+#pragma omp simd
+#endif
+  for (int k = 0; k < count; k++) {
+    h[k]  = layer.h[first + k];
+    hu[k] = layer.hu[first + k];
+    hv[k] = layer.hv[first + k];
+  }
+}
+
+void Blocks::HaloExchange::unpack(const RealType* buffer, int first, int count, Block1D& layer) {
+  const RealType* const h  = buffer;
+  const RealType* const hu = h + count;
+  const RealType* const hv = hu + count;
+
+#if defined(ENABLE_OPENMP)
+#pragma omp simd
+#endif
+  for (int k = 0; k < count; k++) {
+    layer.h[first + k]  = h[k];
+    layer.hu[first + k] = hu[k];
+    layer.hv[first + k] = hv[k];
+  }
+}
+
+#endif
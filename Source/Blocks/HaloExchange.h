@@ -0,0 +1,87 @@
+#pragma once
+#if defined(ENABLE_MPI)
+#include <memory>
+#include <mpi.h>
+#include <vector>
+
+#include "Block.hpp"
+
+namespace Blocks {
+  /**
+   * Exchanges the ghost layers of a block with the blocks of the neighbouring MPI ranks.
+   *
+   * The ghost layers of the edges with a neighbour are grabbed from the block (they become passive) and receive the
+   * copy layer of the neighbour. Only the cells 1 to n of a layer are sent: the corners are not read by the edges of
+   * the block, and without them the messages of all four edges can be in flight at the same time.
+   *
+   * h, hu and hv of an edge travel packed in one contiguous message. The messages are persistent requests that are
+   * set up once, so a step only packs the copy layers, starts the requests and unpacks the ghost layers.
+   *
+   * A halo of width k > 1 consists of the ghost layer and the k - 1 layers of the block next to it, which overlap
+   * with the neighbour. The block computes the overlap redundantly, and as the ghost layer is not updated, one more
+   * layer of the overlap becomes stale every time step: the halo has to be exchanged every k time steps. The cells
+   * next to the corners then depend on the diagonal neighbour, so the rows are sent across the whole width of the
+   * block after the columns have been received.
+   *
+   * exchange() returns when the ghost layers are up to date. start() only sends the messages, wait() completes them.
+   * With a width of 1, the block may compute everything that does not read the ghost layer in between, see
+   * Blocks::Block::computeNumericalFluxesInterior, but must not change the copy layer.
+   */
+  class HaloExchange {
+  public:
+    /**
+     * @param block the block of this rank.
+     * @param neighbours rank of the neighbour at every BoundaryEdge, MPI_PROC_NULL at the boundary of the domain.
+     * @param width number of layers of the halo, at most half the number of cells of the block in each direction.
+     * @param communicator the communicator of the ranks.
+     */
+    HaloExchange(Block& block, const int (&neighbours)[4], int width = 1, MPI_Comm communicator = MPI_COMM_WORLD);
+    ~HaloExchange();
+
+    HaloExchange(const HaloExchange&)            = delete;
+    HaloExchange& operator=(const HaloExchange&) = delete;
+
+    //! Sends the copy layers and receives the ghost layers.
+    void exchange();
+
+    //! Packs the copy layers and starts the receives and sends of all edges (only the columns for a width > 1).
+    void start();
+
+    //! Waits for the messages started by start and unpacks the ghost layers (exchanges the rows for a width > 1).
+    void wait();
+
+  private:
+    int width_;
+
+    //! Layers at the depths 0 to width - 1, the copy layers in the order the neighbour receives them.
+    std::vector<std::unique_ptr<Block1D>> ghostLayers_[4];
+    std::vector<std::unique_ptr<Block1D>> copyLayers_[4];
+
+    //! First cell and number of cells of the layers of an edge.
+    int firstCell_[4];
+    int cellCount_[4];
+
+    //! h, hu and hv of the cells of the layers, one after the other.
+    std::vector<RealType> sendBuffers_[4];
+    std::vector<RealType> receiveBuffers_[4];
+
+    //! Persistent receives and sends of the edges with a neighbour, for a width > 1 the rows after the columns.
+    std::vector<MPI_Request> requests_[2];
+
+    //! The phase the messages of edge belong to.
+    int getPhase(BoundaryEdge edge) const;
+
+    //! Packs the copy layers of the edges of phase and starts their messages.
+    void startPhase(int phase);
+
+    //! Completes the messages of phase and unpacks the ghost layers of its edges.
+    void completePhase(int phase);
+
+    //! Copies h, hu and hv of count cells of layer starting at first to buffer.
+    static void pack(const Block1D& layer, int first, int count, RealType* buffer);
+
+    //! Copies buffer to h, hu and hv of count cells of layer starting at first.
+    static void unpack(const RealType* buffer, int first, int count, Block1D& layer);
+  };
+} // namespace Blocks
+#endif
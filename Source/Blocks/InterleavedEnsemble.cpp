@@ -0,0 +1,352 @@
+#include "InterleavedEnsemble.h"
+
+#include <algorithm>
+#include <cassert>
+
+#if defined(ENABLE_OPENMP)
+#include <omp.h>
+#endif
+
+namespace {
+  //! Columns of edges in the scratch of a thread, like in Blocks::DimensionalSplitting.
+  constexpr int FusedScratchColumns = 16;
+} // namespace
+
+template <class SolverPolicy>
+Blocks::InterleavedEnsemble<SolverPolicy>::InterleavedEnsemble(
+  int nx, int ny, RealType dx, RealType dy, RealType offsetX, RealType offsetY, Scenarios::Scenario& scenario, int members
+):
+  nx_(nx),
+  ny_(ny),
+  members_(members),
+  dx_(dx),
+  dy_(dy),
+  offsetX_(offsetX),
+  offsetY_(offsetY),
+  h_(nx + 2, (ny + 2) * members),
+  hu_(nx + 2, (ny + 2) * members),
+  hv_(nx + 2, (ny + 2) * members),
+  b_(nx + 2, ny + 2),
+  times_(members, RealType(0.0)),
+  maxElevations_(members, RealType(0.0)),
+  steps_(members, 0),
+  timeSteps_(3 * std::size_t(members), RealType(0.0)) {
+
+  // A block of its own sets up the bathymetry and its ghost layer, like for every other block
+  {
+    DimensionalSplitting<SolverPolicy> block(nx, ny, dx, dy, ExecutionMode::Fused);
+    block.initialiseBathymetry(offsetX, offsetY, scenario);
+    b_ = block.getBathymetry();
+  }
+  for (int edge = BoundaryEdge::Left; edge <= BoundaryEdge::Top; edge++) {
+    boundary_[edge] = scenario.getBoundaryType(BoundaryEdge(edge));
+    assert(boundary_[edge] == BoundaryType::Outflow || boundary_[edge] == BoundaryType::Wall || boundary_[edge] == BoundaryType::Periodic);
+  }
+
+  // Column i is swept by the same thread as in updateUnknownsY
+#if defined(ENABLE_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+  for (int i = 0; i <= nx_ + 1; ++i) {
+    std::fill_n(h_[i], h_.getRows(), RealType(0.0));
+    std::fill_n(hu_[i], hu_.getRows(), RealType(0.0));
+    std::fill_n(hv_[i], hv_.getRows(), RealType(0.0));
+  }
+  for (int member = 0; member < members_; member++) {
+    initialiseMember(member, []([[maybe_unused]] RealType x, [[maybe_unused]] RealType y) { return RealType(0.0); });
+  }
+}
+
+template <class SolverPolicy>
+std::uint64_t Blocks::InterleavedEnsemble<SolverPolicy>::getCellUpdates() const {
+  std::uint64_t cellUpdates = 0;
+  for (int member = 0; member < members_; member++) {
+    cellUpdates += steps_[member] * std::uint64_t(nx_) * ny_;
+  }
+  return cellUpdates;
+}
+
+template <class SolverPolicy>
+typename Blocks::InterleavedEnsemble<SolverPolicy>::Statistics Blocks::InterleavedEnsemble<SolverPolicy>::getStatistics(RealType threshold) const {
+  return Ensemble<SolverPolicy>::summarise(maxElevations_, threshold);
+}
+
+template <class SolverPolicy>
+Tools::Float2D<RealType> Blocks::InterleavedEnsemble<SolverPolicy>::extractMember(const Tools::Float2D<RealType>& array, int member) const {
+  Tools::Float2D<RealType> result(nx_ + 2, ny_ + 2);
+  for (int i = 0; i <= nx_ + 1; i++) {
+    for (int j = 0; j <= ny_ + 1; j++) {
+      result[i][j] = array[i][j * members_ + member];
+    }
+  }
+  return result;
+}
+
+template <class SolverPolicy>
+void Blocks::InterleavedEnsemble<SolverPolicy>::recordElevation(int member) {
+  const auto [x, y] = destination_;
+  for (int i = std::max(x - 3, 1); i <= std::min(x + 3, nx_); i++) {
+    for (int j = std::max(y - 3, 1); j <= std::min(y + 3, ny_); j++) {
+      const RealType h = h_[i][j * members_ + member];
+      if (h > RealType(0.0)) {
+        maxElevations_[member] = std::max(maxElevations_[member], h + b_[i][j]);
+      }
+    }
+  }
+}
+
+template <class SolverPolicy>
+void Blocks::InterleavedEnsemble<SolverPolicy>::setGhostLayer() {
+  const int members = members_;
+  // Copies the members of count cells from column fromI, row fromJ on to column toI, row toJ on
+  auto copy = [members](Tools::Float2D<RealType>& array, int toI, int toJ, int fromI, int fromJ, int count, RealType sign) {
+    const RealType* from = array[fromI] + fromJ * members;
+    RealType*       to   = array[toI] + toJ * members;
+    for (int k = 0; k < count * members; k++) {
+      to[k] = sign * from[k];
+    }
+  };
+
+  // Same conditions as Blocks::Block::setBoundaryConditions, the wall mirrors the normal discharge
+  const RealType leftSign  = boundary_[BoundaryEdge::Left] == BoundaryType::Wall ? RealType(-1.0) : RealType(1.0);
+  const RealType rightSign = boundary_[BoundaryEdge::Right] == BoundaryType::Wall ? RealType(-1.0) : RealType(1.0);
+  const int      leftFrom  = boundary_[BoundaryEdge::Left] == BoundaryType::Periodic ? nx_ : 1;
+  const int      rightFrom = boundary_[BoundaryEdge::Right] == BoundaryType::Periodic ? 1 : nx_;
+  copy(h_, 0, 1, leftFrom, 1, ny_, RealType(1.0));
+  copy(hu_, 0, 1, leftFrom, 1, ny_, leftSign);
+  copy(hv_, 0, 1, leftFrom, 1, ny_, RealType(1.0));
+  copy(h_, nx_ + 1, 1, rightFrom, 1, ny_, RealType(1.0));
+  copy(hu_, nx_ + 1, 1, rightFrom, 1, ny_, rightSign);
+  copy(hv_, nx_ + 1, 1, rightFrom, 1, ny_, RealType(1.0));
+
+  const RealType bottomSign = boundary_[BoundaryEdge::Bottom] == BoundaryType::Wall ? RealType(-1.0) : RealType(1.0);
+  const RealType topSign    = boundary_[BoundaryEdge::Top] == BoundaryType::Wall ? RealType(-1.0) : RealType(1.0);
+  const int      bottomFrom = boundary_[BoundaryEdge::Bottom] == BoundaryType::Periodic ? ny_ : 1;
+  const int      topFrom    = boundary_[BoundaryEdge::Top] == BoundaryType::Periodic ? 1 : ny_;
+  for (int i = 1; i <= nx_; i++) {
+    copy(h_, i, 0, i, bottomFrom, 1, RealType(1.0));
+    copy(hu_, i, 0, i, bottomFrom, 1, RealType(1.0));
+    copy(hv_, i, 0, i, bottomFrom, 1, bottomSign);
+    copy(h_, i, ny_ + 1, i, topFrom, 1, RealType(1.0));
+    copy(hu_, i, ny_ + 1, i, topFrom, 1, RealType(1.0));
+    copy(hv_, i, ny_ + 1, i, topFrom, 1, topSign);
+  }
+
+  // The corners form steady states with their neighbours, across periodic boundaries with the opposite side
+  for (Tools::Float2D<RealType>* array : {&h_, &hu_, &hv_}) {
+    copy(*array, 0, 0, leftFrom, bottomFrom, 1, RealType(1.0));
+    copy(*array, 0, ny_ + 1, leftFrom, topFrom, 1, RealType(1.0));
+    copy(*array, nx_ + 1, 0, rightFrom, bottomFrom, 1, RealType(1.0));
+    copy(*array, nx_ + 1, ny_ + 1, rightFrom, topFrom, 1, RealType(1.0));
+  }
+}
+
+template <class SolverPolicy>
+void Blocks::InterleavedEnsemble<SolverPolicy>::computeTimeSteps(RealType time) {
+#if defined(ENABLE_OPENMP)
+  const int threadCount = omp_get_num_threads();
+  const int thread      = omp_get_thread_num();
+#else
+  const int threadCount = 1;
+  const int thread      = 0;
+#endif
+  const int members = members_;
+  RealType* speedsX = threadWaveSpeedsX_.data() + std::size_t(thread) * members;
+  RealType* speedsY = threadWaveSpeedsY_.data() + std::size_t(thread) * members;
+  std::fill_n(speedsX, members, RealType(0.0));
+  std::fill_n(speedsY, members, RealType(0.0));
+
+  // The same edges as Blocks::DimensionalSplitting::getSweepRanges
+#if defined(ENABLE_OPENMP)
+#pragma omp for schedule(static) nowait
+#endif
+  for (int i = 0; i <= nx_; ++i) {
+    SolverPolicy::computeMaxWaveSpeedInterleaved(h_[i] + members, h_[i + 1] + members, hu_[i] + members, hu_[i + 1] + members, speedsX, ny_, members);
+  }
+#if defined(ENABLE_OPENMP)
+#pragma omp for schedule(static) nowait
+#endif
+  for (int i = 1; i <= nx_; ++i) {
+    SolverPolicy::computeMaxWaveSpeedInterleaved(h_[i], h_[i] + members, hv_[i], hv_[i] + members, speedsY, ny_ + 1, members);
+  }
+
+#if defined(ENABLE_OPENMP)
+#pragma omp barrier
+#pragma omp single
+#endif
+  for (int member = 0; member < members; member++) {
+    RealType speedX = RealType(0.0);
+    RealType speedY = RealType(0.0);
+    for (int t = 0; t < threadCount; t++) {
+      speedX = std::max(speedX, threadWaveSpeedsX_[std::size_t(t) * members + member]);
+      speedY = std::max(speedY, threadWaveSpeedsY_[std::size_t(t) * members + member]);
+    }
+
+    // Same time step as Blocks::DimensionalSplitting::updateMaxTimeStep, the last one ends at time
+    RealType maxTimeStep = dx_ / speedX;
+    maxTimeStep          = std::min(maxTimeStep, dy_ / speedY);
+    maxTimeStep *= RealType(0.4);
+    const RealType remaining = time - times_[member];
+    if (remaining <= RealType(0.0)) {
+      timeSteps_[member] = RealType(0.0);
+    } else {
+      timeSteps_[member] = maxTimeStep < remaining ? maxTimeStep : remaining;
+    }
+  }
+}
+
+template <class SolverPolicy>
+void Blocks::InterleavedEnsemble<SolverPolicy>::updateUnknownsX() {
+  const int members    = members_;
+  const int columnSize = (ny_ + 2) * members;
+
+  // A scratch edge consists of the columns hLeft, hRight, huLeft and huRight, indexed like the cells
+  auto computeEdges = [&](int i, RealType* edge) {
+    SolverPolicy::computeNetUpdatesInterleaved(
+      h_[i] + members,
+      h_[i + 1] + members,
+      hu_[i] + members,
+      hu_[i + 1] + members,
+      b_[i] + 1,
+      b_[i + 1] + 1,
+      edge + members,
+      edge + columnSize + members,
+      edge + 2 * columnSize + members,
+      edge + 3 * columnSize + members,
+      ny_,
+      members
+    );
+  };
+
+#if defined(ENABLE_OPENMP)
+  const int threadCount = omp_get_num_threads();
+  const int thread      = omp_get_thread_num();
+#else
+  const int threadCount = 1;
+  const int thread      = 0;
+#endif
+  // Static partition of the columns, every thread owns [first, last]
+  const int first = 1 + (nx_ * thread) / threadCount;
+  const int last  = (nx_ * (thread + 1)) / threadCount;
+
+  RealType* scratch     = fusedScratch_.data() + std::size_t(thread) * FusedScratchColumns * columnSize;
+  RealType* leftBorder  = scratch;
+  RealType* rightBorder = scratch + 4 * columnSize;
+  RealType* inner[2]    = {scratch + 8 * columnSize, scratch + 12 * columnSize};
+  const RealType* ratios = timeSteps_.data() + members;
+
+  // The border edges read the columns of the neighbouring threads and have to be computed before they change
+  if (first <= last) {
+    computeEdges(first - 1, leftBorder);
+    computeEdges(last, rightBorder);
+  }
+
+#if defined(ENABLE_OPENMP)
+#pragma omp barrier
+#endif
+
+  const RealType* previous = leftBorder;
+  for (int i = first; i <= last; ++i) {
+    RealType* next = rightBorder;
+    if (i < last) {
+      next = inner[(i - first) % 2];
+      computeEdges(i, next);
+    }
+
+    for (int j = 1; j <= ny_; ++j) {
+      const int offset = j * members;
+#pragma omp simd
+      for (int m = 0; m < members; ++m) {
+        const int k = offset + m;
+        h_[i][k] -= ratios[m] * (previous[columnSize + k] + next[k]);
+        hu_[i][k] -= ratios[m] * (previous[3 * columnSize + k] + next[2 * columnSize + k]);
+      }
+    }
+    previous = next;
+  }
+
+  // The y-sweep partitions the columns differently
+#if defined(ENABLE_OPENMP)
+#pragma omp barrier
+#endif
+}
+
+template <class SolverPolicy>
+void Blocks::InterleavedEnsemble<SolverPolicy>::updateUnknownsY() {
+  const int members    = members_;
+  const int columnSize = (ny_ + 2) * members;
+
+#if defined(ENABLE_OPENMP)
+  const int thread = omp_get_thread_num();
+#else
+  const int thread = 0;
+#endif
+  // The columns hLeft, hRight, hvLeft and hvRight of the edges between row j and j + 1, indexed like row j
+  RealType*       edges  = fusedScratch_.data() + std::size_t(thread) * FusedScratchColumns * columnSize;
+  const RealType* ratios = timeSteps_.data() + 2 * members;
+
+#if defined(ENABLE_OPENMP)
+#pragma omp for schedule(static)
+#endif
+  for (int i = 1; i <= nx_; ++i) {
+    SolverPolicy::computeNetUpdatesInterleaved(
+      h_[i], h_[i] + members, hv_[i], hv_[i] + members, b_[i], b_[i] + 1, edges, edges + columnSize, edges + 2 * columnSize, edges + 3 * columnSize, ny_ + 1, members
+    );
+
+    for (int j = 1; j <= ny_; ++j) {
+      const int offset = j * members;
+#pragma omp simd
+      for (int m = 0; m < members; ++m) {
+        const int k = offset + m;
+        h_[i][k] -= ratios[m] * (edges[columnSize + k - members] + edges[k]);
+        hv_[i][k] -= ratios[m] * (edges[3 * columnSize + k - members] + edges[2 * columnSize + k]);
+      }
+    }
+  }
+}
+
+template <class SolverPolicy>
+void Blocks::InterleavedEnsemble<SolverPolicy>::simulateUntil(RealType time) {
+#if defined(ENABLE_OPENMP)
+  const int threads = omp_get_max_threads();
+#else
+  const int threads = 1;
+#endif
+  const std::size_t columnSize = std::size_t(ny_ + 2) * members_;
+  threadWaveSpeedsX_.resize(std::size_t(threads) * members_);
+  threadWaveSpeedsY_.resize(std::size_t(threads) * members_);
+  fusedScratch_.resize(std::size_t(threads) * FusedScratchColumns * columnSize);
+
+  while (std::any_of(times_.begin(), times_.end(), [time](RealType t) { return t < time; })) {
+    setGhostLayer();
+
+#if defined(ENABLE_OPENMP)
+#pragma omp parallel
+#endif
+    {
+      computeTimeSteps(time);
+#if defined(ENABLE_OPENMP)
+#pragma omp single
+#endif
+      for (int member = 0; member < members_; member++) {
+        timeSteps_[members_ + member]     = timeSteps_[member] / dx_;
+        timeSteps_[2 * members_ + member] = timeSteps_[member] / dy_;
+      }
+      updateUnknownsX();
+      updateUnknownsY();
+    }
+
+    for (int member = 0; member < members_; member++) {
+      const RealType dt = timeSteps_[member];
+      if (dt > RealType(0.0)) {
+        times_[member] = dt == time - times_[member] ? time : times_[member] + dt;
+        steps_[member]++;
+        recordElevation(member);
+      }
+    }
+  }
+  time_ = time;
+}
+
+template class Blocks::InterleavedEnsemble<Solvers::FWaveKernel>;
+template class Blocks::InterleavedEnsemble<Solvers::RusanovKernel>;
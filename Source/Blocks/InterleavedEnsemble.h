@@ -0,0 +1,145 @@
+#pragma once
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "Ensemble.h"
+
+namespace Blocks {
+  /**
+   * The ensemble of Blocks::Ensemble with the members interleaved in the innermost dimension: the state of member m
+   * in cell (i, j) is h[i][j * members + m]. The sweeps vectorise across the members instead of across the cells, with
+   * the bathymetry of a cell broadcast to all of them and the wet/dry cases as lane masks, see
+   * Solvers::FWaveKernel::computeNetUpdatesInterleaved. The vector lanes are full however small or ragged the wet
+   * parts of the grid are, at the price of sweeping dry cells (which stay dry) and of advancing all members together.
+   *
+   * Every member still has its own time step, the updates scale the net updates of a member with its own dt / dx.
+   * simulateUntil steps until the last member arrives at the given time, a member that is already there gets a time
+   * step of zero. The members give the same results as the independent runs of Blocks::Ensemble.
+   *
+   * The sweeps work like ExecutionMode::Fused, without net-update arrays. Outflow, wall and periodic boundaries are
+   * supported.
+   *
+   * @tparam SolverPolicy the edge solver used in the sweeps, see Blocks::DimensionalSplitting.
+   */
+  template <class SolverPolicy = Solvers::FWaveKernel>
+  class InterleavedEnsemble {
+  public:
+    using Statistics = typename Ensemble<SolverPolicy>::Statistics;
+
+    /**
+     * All members start with the sea at rest.
+     *
+     * @param nx, ny, dx, dy size of the members.
+     * @param offsetX, offsetY origin of the members.
+     * @param scenario provides the bathymetry and the boundary types.
+     * @param members number of members.
+     */
+    InterleavedEnsemble(int nx, int ny, RealType dx, RealType dy, RealType offsetX, RealType offsetY, Scenarios::Scenario& scenario, int members);
+
+    /**
+     * @brief Sets a member to the sea at rest, raised by displacement(x, y) at the cell centers (x, y), and at rest.
+     */
+    template <class Displacement>
+    void initialiseMember(int member, Displacement&& displacement);
+
+    /**
+     * @brief The statistics are taken over the wet cells within 3 cells of the destination, like the corridor search.
+     */
+    void setDestination(std::pair<int, int> destination) { destination_ = destination; }
+
+    /**
+     * @brief Advances every member up to time, the last time step of a member is shortened to end there.
+     */
+    void simulateUntil(RealType time);
+
+    int           getMemberCount() const { return members_; }
+    int           getNx() const { return nx_; }
+    int           getNy() const { return ny_; }
+    RealType      getTime() const { return time_; }
+    std::uint64_t getCellUpdates() const;
+
+    //! The arrays of a member including the ghost layer, copied out of the interleaved arrays.
+    Tools::Float2D<RealType>        getWaterHeight(int member) const { return extractMember(h_, member); }
+    Tools::Float2D<RealType>        getDischargeHu(int member) const { return extractMember(hu_, member); }
+    Tools::Float2D<RealType>        getDischargeHv(int member) const { return extractMember(hv_, member); }
+    const Tools::Float2D<RealType>& getBathymetry() const { return b_; }
+
+    //! Highest surface elevation at the destination of a member so far.
+    RealType   getMaxElevation(int member) const { return maxElevations_[member]; }
+    Statistics getStatistics(RealType threshold) const;
+
+  private:
+    int      nx_;
+    int      ny_;
+    int      members_;
+    RealType dx_;
+    RealType dy_;
+    RealType offsetX_;
+    RealType offsetY_;
+
+    //! (nx + 2) columns of (ny + 2) * members rows.
+    Tools::Float2D<RealType> h_;
+    Tools::Float2D<RealType> hu_;
+    Tools::Float2D<RealType> hv_;
+    //! the bathymetry with its ghost layer, one value per cell.
+    Tools::Float2D<RealType> b_;
+
+    BoundaryType boundary_[4];
+
+    std::pair<int, int> destination_{0, 0};
+
+    RealType                   time_{0.0};
+    std::vector<RealType>      times_;
+    std::vector<RealType>      maxElevations_;
+    std::vector<std::uint64_t> steps_;
+
+    //! the time steps of the members in the current step (zero for the members that arrived), then dt / dx and dt / dy.
+    std::vector<RealType> timeSteps_;
+    //! maximum wave speeds per member in x and y, members entries for every thread.
+    std::vector<RealType> threadWaveSpeedsX_;
+    std::vector<RealType> threadWaveSpeedsY_;
+    //! 16 edge columns for every thread, see DimensionalSplitting::updateUnknownsFusedX.
+    std::vector<RealType> fusedScratch_;
+
+    bool isPeriodicX() const { return boundary_[BoundaryEdge::Left] == BoundaryType::Periodic && boundary_[BoundaryEdge::Right] == BoundaryType::Periodic; }
+    bool isPeriodicY() const { return boundary_[BoundaryEdge::Bottom] == BoundaryType::Periodic && boundary_[BoundaryEdge::Top] == BoundaryType::Periodic; }
+
+    //! Sets the ghost layer of every member from the boundary types.
+    void setGhostLayer();
+
+    //! Computes the time step of every member from its wave speeds, clipped to end at time.
+    void computeTimeSteps(RealType time);
+
+    //! The fused x- and y-sweep, called by all threads of the parallel region.
+    void updateUnknownsX();
+    void updateUnknownsY();
+
+    //! Updates the highest surface elevation of a member around the destination.
+    void recordElevation(int member);
+
+    Tools::Float2D<RealType> extractMember(const Tools::Float2D<RealType>& array, int member) const;
+  };
+
+  template <class SolverPolicy>
+  template <class Displacement>
+  void InterleavedEnsemble<SolverPolicy>::initialiseMember(int member, Displacement&& displacement) {
+    for (int i = 1; i <= nx_; i++) {
+      for (int j = 1; j <= ny_; j++) {
+        const RealType x = offsetX_ + (i - RealType(0.5)) * dx_;
+        const RealType y = offsetY_ + (j - RealType(0.5)) * dy_;
+        const int      k = j * members_ + member;
+        h_[i][k]         = b_[i][j] < RealType(0.0) ? displacement(x, y) - b_[i][j] : RealType(0.0);
+        hu_[i][k]        = RealType(0.0);
+        hv_[i][k]        = RealType(0.0);
+      }
+    }
+
+    times_[member]         = time_;
+    maxElevations_[member] = RealType(0.0);
+    recordElevation(member);
+  }
+
+  extern template class InterleavedEnsemble<Solvers::FWaveKernel>;
+  extern template class InterleavedEnsemble<Solvers::RusanovKernel>;
+} // namespace Blocks
@@ -0,0 +1,292 @@
+#include "NestedGrid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+#if defined(ENABLE_OPENMP)
+#include <omp.h>
+#endif
+
+template <class SolverPolicy>
+Blocks::NestedGrid<SolverPolicy>::NestedGrid(
+  DimensionalSplitting<SolverPolicy>& coarse,
+  Scenarios::Scenario&                scenario,
+  RealType                            offsetX,
+  RealType                            offsetY,
+  RealType                            dx,
+  RealType                            dy,
+  int                                 ratio,
+  const std::vector<Region>&          regions,
+  bool                                fromScenario,
+  ExecutionMode                       executionMode
+):
+  coarse_(coarse),
+  scenario_(scenario),
+  ratio_(ratio) {
+
+  std::uint64_t fineCells = 0;
+  for (const Region& region : regions) {
+    auto nest      = std::make_unique<Nest>();
+    nest->name_    = "region" + std::to_string(nests_.size());
+    nest->region_  = region;
+    nest->dx_      = dx / ratio;
+    nest->dy_      = dy / ratio;
+    nest->offsetX_ = offsetX + (region.firstX - 1) * dx;
+    nest->offsetY_ = offsetY + (region.firstY - 1) * dy;
+
+    const int nx = (region.lastX - region.firstX + 1) * ratio;
+    const int ny = (region.lastY - region.firstY + 1) * ratio;
+    fineCells += std::uint64_t(nx) * ny;
+
+    nest->block_ = std::make_unique<DimensionalSplitting<SolverPolicy>>(nx, ny, nest->dx_, nest->dy_, executionMode);
+    auto& block  = *nest->block_;
+    block.initialiseScenario(nest->offsetX_, nest->offsetY_, scenario_, true);
+
+    // Passive boundaries do not transfer the bathymetry, the ghost layer gets it from the scenario as well
+    Tools::Float2D<RealType> b = block.getBathymetry();
+    for (int i = 0; i <= nx + 1; i++) {
+      for (int j = 0; j <= ny + 1; j++) {
+        if (i == 0 || i == nx + 1 || j == 0 || j == ny + 1) {
+          b[i][j] = scenario_.getBathymetry(nest->offsetX_ + (i - RealType(0.5)) * nest->dx_, nest->offsetY_ + (j - RealType(0.5)) * nest->dy_);
+        }
+      }
+    }
+    block.setB(b);
+
+    if (!fromScenario) {
+      Tools::Float2D<RealType> h  = block.getWaterHeight();
+      Tools::Float2D<RealType> hu = block.getDischargeHu();
+      Tools::Float2D<RealType> hv = block.getDischargeHv();
+      for (int i = 1; i <= nx; i++) {
+        for (int j = 1; j <= ny; j++) {
+          const auto state = prolongate(getCoarseIndex(region.firstX, i), getCoarseIndex(region.firstY, j), b[i][j]);
+          h[i][j]          = state[0];
+          hu[i][j]         = state[1];
+          hv[i][j]         = state[2];
+        }
+      }
+      block.setH(h);
+      block.setHu(hu);
+      block.setHv(hv);
+    }
+
+    const bool domainBoundary[4]{region.firstX == 1, region.lastX == coarse_.getNx(), region.firstY == 1, region.lastY == coarse_.getNy()};
+    for (int edge = BoundaryEdge::Left; edge <= BoundaryEdge::Top; edge++) {
+      if (domainBoundary[edge]) {
+        block.setBoundaryType(BoundaryEdge(edge), scenario_.getBoundaryType(BoundaryEdge(edge)));
+        continue;
+      }
+      typename Nest::GhostLayer& ghost = nest->ghostLayers_[edge];
+      const int                  size  = (edge == BoundaryEdge::Left || edge == BoundaryEdge::Right) ? ny + 2 : nx + 2;
+      for (int k = 0; k < 3; k++) {
+        ghost.start_[k].assign(size, RealType(0.0));
+        ghost.end_[k].assign(size, RealType(0.0));
+      }
+      ghost.layer_.reset(block.grabGhostLayer(BoundaryEdge(edge)));
+    }
+    nests_.push_back(std::move(nest));
+  }
+  sampleGhostLayers();
+
+  // Split the threads by the cell updates per coarse time step, the regions take about ratio steps for every one
+#if defined(ENABLE_OPENMP)
+  const int           threads     = omp_get_max_threads();
+  const std::uint64_t coarseCells = std::uint64_t(coarse_.getNx()) * coarse_.getNy();
+  const double        fineShare   = double(fineCells * ratio) / double(fineCells * ratio + coarseCells);
+  const int           fineThreads = std::clamp(int(std::lround(threads * fineShare)), 1, std::max(threads - 1, 1));
+  setTeamSizes(threads - fineThreads, fineThreads);
+#endif
+}
+
+template <class SolverPolicy>
+void Blocks::NestedGrid<SolverPolicy>::setTeamSizes(int coarseThreads, int fineThreads) {
+  if (coarseThreads < 1 || fineThreads < 1) {
+    coarseThreads = 0;
+    fineThreads   = 0;
+  }
+  coarseThreads_ = coarseThreads;
+  fineThreads_   = fineThreads;
+}
+
+template <class SolverPolicy>
+std::vector<const typename Blocks::NestedGrid<SolverPolicy>::Nest*> Blocks::NestedGrid<SolverPolicy>::getNests() const {
+  std::vector<const Nest*> nests;
+  for (const auto& nest : nests_) {
+    nests.push_back(nest.get());
+  }
+  return nests;
+}
+
+template <class SolverPolicy>
+int Blocks::NestedGrid<SolverPolicy>::getCoarseIndex(int first, int index) const {
+  // Rounds down for the ghost cell 0 as well
+  const int offset = index - 1;
+  return first + (offset >= 0 ? offset / ratio_ : -1);
+}
+
+template <class SolverPolicy>
+std::array<RealType, 3> Blocks::NestedGrid<SolverPolicy>::prolongate(int i, int j, RealType b) const {
+  const Tools::Float2D<RealType>& h       = coarse_.getWaterHeight();
+  const Tools::Float2D<RealType>& hu      = coarse_.getDischargeHu();
+  const Tools::Float2D<RealType>& hv      = coarse_.getDischargeHv();
+  const Tools::Float2D<RealType>& coarseB = coarse_.getBathymetry();
+
+  i = std::clamp(i, 0, coarse_.getNx() + 1);
+  j = std::clamp(j, 0, coarse_.getNy() + 1);
+  if (h[i][j] <= RealType(0.0)) {
+    // A fine cell below the surface of a wet neighbour is wet, otherwise the coast line would drain the region
+    RealType surface = -std::numeric_limits<RealType>::max();
+    for (auto [neighbourI, neighbourJ] : {std::pair{i - 1, j}, {i + 1, j}, {i, j - 1}, {i, j + 1}}) {
+      neighbourI = std::clamp(neighbourI, 0, coarse_.getNx() + 1);
+      neighbourJ = std::clamp(neighbourJ, 0, coarse_.getNy() + 1);
+      if (h[neighbourI][neighbourJ] > RealType(0.0)) {
+        surface = std::max(surface, h[neighbourI][neighbourJ] + coarseB[neighbourI][neighbourJ]);
+      }
+    }
+    return {std::max(surface - b, RealType(0.0)), RealType(0.0), RealType(0.0)};
+  }
+  const RealType fineH = std::max(h[i][j] + coarseB[i][j] - b, RealType(0.0));
+  return {fineH, hu[i][j] / h[i][j] * fineH, hv[i][j] / h[i][j] * fineH};
+}
+
+template <class SolverPolicy>
+void Blocks::NestedGrid<SolverPolicy>::sampleGhostLayers() {
+  for (auto& nest : nests_) {
+    const Region&                   region = nest->region_;
+    const Tools::Float2D<RealType>& b      = nest->block_->getBathymetry();
+    const int                       nx     = nest->block_->getNx();
+    const int                       ny     = nest->block_->getNy();
+
+    for (int edge = BoundaryEdge::Left; edge <= BoundaryEdge::Top; edge++) {
+      typename Nest::GhostLayer& ghost = nest->ghostLayers_[edge];
+      if (!ghost.layer_) {
+        continue;
+      }
+      const bool vertical = edge == BoundaryEdge::Left || edge == BoundaryEdge::Right;
+      const int  size     = vertical ? ny + 2 : nx + 2;
+      for (int k = 0; k < size; k++) {
+        int i = k;
+        int j = k;
+        if (vertical) {
+          i = (edge == BoundaryEdge::Left) ? 0 : nx + 1;
+        } else {
+          j = (edge == BoundaryEdge::Bottom) ? 0 : ny + 1;
+        }
+        const auto state = prolongate(getCoarseIndex(region.firstX, i), getCoarseIndex(region.firstY, j), b[i][j]);
+        for (int q = 0; q < 3; q++) {
+          ghost.end_[q][k] = state[q];
+        }
+      }
+    }
+  }
+}
+
+template <class SolverPolicy>
+RealType Blocks::NestedGrid<SolverPolicy>::advanceCoarse(RealType dt) {
+  coarse_.setGhostLayer();
+  if (dt > RealType(0.0)) {
+    coarse_.simulateTimeStep(dt);
+    return dt;
+  }
+  return coarse_.simulateTimeStep();
+}
+
+template <class SolverPolicy>
+void Blocks::NestedGrid<SolverPolicy>::advanceNests() {
+  if (fineTime_ >= time_) {
+    return;
+  }
+  const RealType stepWidth = time_ - startTime_;
+  for (auto& nest : nests_) {
+    auto&     block = *nest->block_;
+    RealType  t     = fineTime_;
+    const int cells = block.getNx() * block.getNy();
+    while (t < time_) {
+      const RealType fraction = (t - startTime_) / stepWidth;
+      for (auto& ghost : nest->ghostLayers_) {
+        if (!ghost.layer_) {
+          continue;
+        }
+        Tools::Float1D<RealType>* values[3]{&ghost.layer_->h, &ghost.layer_->hu, &ghost.layer_->hv};
+        for (int q = 0; q < 3; q++) {
+          for (std::size_t k = 0; k < ghost.end_[q].size(); k++) {
+            (*values[q])[int(k)] = ghost.start_[q][k] + fraction * (ghost.end_[q][k] - ghost.start_[q][k]);
+          }
+        }
+      }
+      block.setGhostLayer();
+      block.computeNumericalFluxes();
+
+      // The last step ends exactly at the time of the coarse block
+      const RealType remaining = time_ - t;
+      if (block.getMaxTimeStep() < remaining) {
+        block.updateUnknowns(block.getMaxTimeStep());
+        t += block.getMaxTimeStep();
+      } else {
+        block.updateUnknowns(remaining);
+        t = time_;
+      }
+      fineCellUpdates_ += cells;
+    }
+  }
+  fineTime_ = time_;
+}
+
+template <class SolverPolicy>
+RealType Blocks::NestedGrid<SolverPolicy>::simulateTimeStep() {
+  return advance(RealType(0.0));
+}
+
+template <class SolverPolicy>
+void Blocks::NestedGrid<SolverPolicy>::simulateTimeStep(RealType dt) {
+  advance(dt);
+}
+
+template <class SolverPolicy>
+RealType Blocks::NestedGrid<SolverPolicy>::advance(RealType dt) {
+#if defined(ENABLE_OPENMP)
+  if (coarseThreads_ > 0) {
+    // One section per team, the blocks open their parallel regions nested inside with the size of their team
+    const int activeLevels = omp_get_max_active_levels();
+    omp_set_max_active_levels(std::max(activeLevels, 2));
+#pragma omp parallel sections num_threads(2) proc_bind(spread)
+    {
+#pragma omp section
+      {
+        omp_set_num_threads(coarseThreads_);
+        dt = advanceCoarse(dt);
+      }
+#pragma omp section
+      {
+        omp_set_num_threads(fineThreads_);
+        advanceNests();
+      }
+    }
+    omp_set_max_active_levels(activeLevels);
+  } else
+#endif
+  {
+    advanceNests();
+    dt = advanceCoarse(dt);
+  }
+
+  startTime_ = time_;
+  time_ += dt;
+  for (auto& nest : nests_) {
+    for (auto& ghost : nest->ghostLayers_) {
+      std::swap(ghost.start_, ghost.end_);
+    }
+  }
+  sampleGhostLayers();
+  return dt;
+}
+
+template <class SolverPolicy>
+void Blocks::NestedGrid<SolverPolicy>::synchronise() {
+  advanceNests();
+}
+
+template class Blocks::NestedGrid<Solvers::FWaveKernel>;
+template class Blocks::NestedGrid<Solvers::RusanovKernel>;
@@ -0,0 +1,177 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "DimensionalSplitting.h"
+#include "Scenarios/Scenario.hpp"
+
+namespace Blocks {
+  /**
+   * One-way nesting of fine regional blocks in a coarse block.
+   *
+   * Every region is a rectangle of cells of the coarse block that is covered by a Blocks::DimensionalSplitting block
+   * with ratio times as many cells in both directions and the bathymetry of the scenario at this resolution. The
+   * edges of a region inside the domain are grabbed as BoundaryType::Passive ghost layers and filled from the coarse
+   * cells around the region, linear in time between the start and the end of the coarse time step. The edges on the
+   * boundary of the domain get the boundary type of the scenario. Nothing flows back from the regions into the coarse
+   * block, the coarse run is exactly the same with and without nesting.
+   *
+   * The regions take as many time steps of their own as their CFL condition needs for every coarse time step. Since
+   * they only read the coarse boundary values, they run one coarse time step behind: simulateTimeStep advances the
+   * coarse block on one team of threads while the regions catch up with the previous coarse step on a second team.
+   * synchronise lets the regions catch up with the coarse block, e.g. before writing output.
+   *
+   * Transfers from the coarse block keep the surface elevation h + b and the velocity, such that a lake at rest stays
+   * at rest in the regions although their bathymetry is finer.
+   *
+   * @tparam SolverPolicy the edge solver used in the sweeps, see Blocks::DimensionalSplitting.
+   */
+  template <class SolverPolicy = Solvers::FWaveKernel>
+  class NestedGrid {
+  public:
+    /**
+     * Cells firstX..lastX and firstY..lastY of the coarse block, inclusive.
+     */
+    struct Region {
+      int firstX;
+      int firstY;
+      int lastX;
+      int lastY;
+    };
+
+    /**
+     * A refined region: a block together with its position in the domain.
+     */
+    class Nest {
+    public:
+      const std::string&                 getName() const { return name_; }
+      const Region&                      getRegion() const { return region_; }
+      RealType                           getOffsetX() const { return offsetX_; }
+      RealType                           getOffsetY() const { return offsetY_; }
+      RealType                           getDx() const { return dx_; }
+      RealType                           getDy() const { return dy_; }
+      DimensionalSplitting<SolverPolicy>& getBlock() const { return *block_; }
+
+    private:
+      friend class NestedGrid;
+
+      /**
+       * Values of a ghost layer at the start and the end of the coarse time step, layer_ points to the ghost layer of
+       * the block. Edges on the boundary of the domain have no layer.
+       */
+      struct GhostLayer {
+        std::array<std::vector<RealType>, 3> start_;
+        std::array<std::vector<RealType>, 3> end_;
+        std::unique_ptr<Block1D>             layer_;
+      };
+
+      std::string name_;
+      Region      region_;
+      RealType    offsetX_;
+      RealType    offsetY_;
+      RealType    dx_;
+      RealType    dy_;
+
+      std::unique_ptr<DimensionalSplitting<SolverPolicy>> block_;
+      std::array<GhostLayer, 4>                            ghostLayers_;
+    };
+
+    /**
+     * @param coarse the coarse block, already initialised.
+     * @param scenario provides the bathymetry of the regions and the boundary types of the domain.
+     * @param offsetX, offsetY, dx, dy origin and mesh size of the coarse block.
+     * @param ratio refinement ratio of the regions.
+     * @param regions the regions to refine, they have to lie in the coarse block.
+     * @param fromScenario initialise the regions with the scenario instead of the current state of the coarse block.
+     * @param executionMode execution mode of the region blocks.
+     */
+    NestedGrid(
+      DimensionalSplitting<SolverPolicy>& coarse,
+      Scenarios::Scenario&                scenario,
+      RealType                            offsetX,
+      RealType                            offsetY,
+      RealType                            dx,
+      RealType                            dy,
+      int                                 ratio,
+      const std::vector<Region>&          regions,
+      bool                                fromScenario  = true,
+      ExecutionMode                       executionMode = ExecutionMode::Buffered
+    );
+
+    /**
+     * @brief Advances the coarse block by one time step and the regions up to the start of this step.
+     * @return the time step of the coarse block
+     */
+    RealType simulateTimeStep();
+
+    /**
+     * @brief Advances the coarse block by the time step dt, which has to satisfy its CFL condition, and the regions up
+     * to the start of this step.
+     */
+    void simulateTimeStep(RealType dt);
+
+    /**
+     * @brief Advances the regions up to the time of the coarse block.
+     */
+    void synchronise();
+
+    /**
+     * @brief Sizes of the thread teams of the coarse block and the regions. By default, the threads are split by the
+     * number of cell updates per coarse time step. With less than one thread per team, both run one after the other
+     * on all threads.
+     */
+    void setTeamSizes(int coarseThreads, int fineThreads);
+    int  getCoarseThreads() const { return coarseThreads_; }
+    int  getFineThreads() const { return fineThreads_; }
+
+    int                      getRatio() const { return ratio_; }
+    RealType                 getTime() const { return time_; }
+    RealType                 getFineTime() const { return fineTime_; }
+    std::vector<const Nest*> getNests() const;
+    std::uint64_t            getFineCellUpdates() const { return fineCellUpdates_; }
+
+  private:
+    DimensionalSplitting<SolverPolicy>& coarse_;
+    Scenarios::Scenario&                scenario_;
+    const int                           ratio_;
+
+    std::vector<std::unique_ptr<Nest>> nests_;
+
+    int coarseThreads_{0};
+    int fineThreads_{0};
+
+    //! time of the coarse block, of the start of its last time step and of the regions
+    RealType time_{0.0};
+    RealType startTime_{0.0};
+    RealType fineTime_{0.0};
+
+    std::uint64_t fineCellUpdates_{0};
+
+    /**
+     * @brief Values in a fine cell with bathymetry b that lies in cell (i, j) of the coarse block: the same surface
+     * elevation and velocity.
+     */
+    std::array<RealType, 3> prolongate(int i, int j, RealType b) const;
+
+    //! Index of the coarse cell that contains cell index of a region starting at coarse cell first.
+    int getCoarseIndex(int first, int index) const;
+
+    //! Samples the ghost layers of all regions from the coarse block into end_.
+    void sampleGhostLayers();
+
+    //! Advances the coarse block by dt, or by its maximum time step if dt is 0.
+    RealType advanceCoarse(RealType dt);
+
+    //! Advances the coarse block and concurrently the regions up to the start of the coarse step.
+    RealType advance(RealType dt);
+
+    //! Advances the regions from fineTime_ to time_.
+    void advanceNests();
+  };
+
+  extern template class NestedGrid<Solvers::FWaveKernel>;
+  extern template class NestedGrid<Solvers::RusanovKernel>;
+} // namespace Blocks
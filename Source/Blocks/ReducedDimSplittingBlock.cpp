@@ -1,353 +1,336 @@
 #include "ReducedDimSplittingBlock.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cfloat>
-#include <chrono>
-#include <csignal>
+#include <cmath>
+#include <cstdint>
+#include <functional>
 #include <iostream>
-#include <queue>
-#include <unordered_set>
-Blocks::ReducedDimSplittingBlock::ReducedDimSplittingBlock(int nx, int ny, RealType dx, RealType dy):
-  DimensionalSplitting(nx, ny, dx, dy) {}
+#include <vector>
+template <class SolverPolicy>
+Blocks::ReducedDimSplittingBlock<SolverPolicy>::ReducedDimSplittingBlock(int nx, int ny, RealType dx, RealType dy, ExecutionMode executionMode):
+  DimensionalSplitting<SolverPolicy>(nx, ny, dx, dy, executionMode) {}
 
 
-struct Cell {
-  static std::pair<int, int> goal;
-  int                        x, y;
-  double                     cost; // g(n) - cost from start to this node
-
-  Cell(int x, int y, float cost):
-    x(x),
-    y(y),
-    cost(cost) {}
-
-  double TotalCost() const {
-    // Heuristic: straight-line distance to goal
-    return cost * 0.1 + std::sqrt(std::pow(x - goal.first, 2) + std::pow(y - goal.second, 2));
-  }
-};
-
-struct CompareCell {
-  bool operator()(const Cell* a, const Cell* b) const { return a->TotalCost() > b->TotalCost(); }
-};
-std::pair<int, int> Cell::goal;
-#ifdef ENABLE_GUI
-void Blocks::ReducedDimSplittingBlock::findSearchArea(Gui::Gui& gui) {
-  // if the x-distance between start and end cell is bigger than nx/2, shift the data and get a pacific focused map
-  if (abs(startCell_.first - endCell_.first) > nx_ / 2) {
-    shiftData();
-    startCell_.first = (startCell_.first + nx_ / 2) % nx_;
-    endCell_.first   = (endCell_.first + nx_ / 2) % nx_;
-    gui.setBathymetry(b_);
-    gui.update(h_, 0.0);
-  }
-
-  Tools::Float2D<RealType> heightView(h_, false);
-  Cell::goal = endCell_;
-
-  // change region around start and end cell to -FLT_MAX
-  for (int i = startCell_.first - 3; i <= startCell_.first + 3; i++) {
-    for (int j = startCell_.second - 3; j <= startCell_.second + 3; j++) {
-      heightView[i][j] = -FLT_MAX;
-    }
-  }
-
-  for (int i = endCell_.first - 3; i <= endCell_.first + 3; i++) {
-    for (int j = endCell_.second - 3; j <= endCell_.second + 3; j++) {
-      heightView[i][j] = -FLT_MAX;
-    }
-  }
-  std::priority_queue<Cell*, std::vector<Cell*>, CompareCell> openSet;
-
-  // Initialize bounds
-  int minX = startCell_.first, maxX = startCell_.first;
-  int minY = startCell_.second, maxY = startCell_.second;
-
-  openSet.push(new Cell(startCell_.first, startCell_.second, 0));
-  size_t iterations = 0;
-  while (!openSet.empty()) {
-    Cell* current = openSet.top();
-    openSet.pop();
-
-    // Update bounds
-    minX = std::min(minX, current->x);
-    maxX = std::max(maxX, current->x);
-    minY = std::min(minY, current->y);
-    maxY = std::max(maxY, current->y);
-
-    // Mark as visited
-    heightView[current->x][current->y] = FLT_MAX;
-    // update gui every 20 iterations
-    if (iterations % 20 == 0) {
-      gui.update(heightView, 0.0);
-    }
-
-    // Check if we have reached the goal
-    if (current->x == endCell_.first && current->y == endCell_.second) {
-      break;
-    }
-
-    // Explore neighbors
-    for (int dx = -1; dx <= 1; ++dx) {
-      for (int dy = -1; dy <= 1; ++dy) {
-        if (dx == 0 && dy == 0)
-          continue; // Skip the current cell
-
-        int newX = current->x + dx;
-        int newY = current->y + dy;
-        if (newX < 0 || newX >= nx_ || newY < 0 || newY >= ny_)
-          continue; // Skip out of bounds cells
-
-        // Check for valid cell, no obstacle, and not visited
-        if (b_[newX][newY] < 0 && heightView[newX][newY] != FLT_MAX) {
-
-          float newCost = current->cost + 1; // Assuming uniform cost
-          openSet.push(new Cell(newX, newY, newCost));
-        }
+namespace {
+  /**
+   * Entry of the open set of the corridor search, stored by value in a heap that is allocated once.
+   */
+  struct SearchNode {
+    // g(n) * 0.1 + straight-line distance to the goal
+    float priority;
+    // g(n), the number of steps from the start
+    float cost;
+    int   x;
+    int   y;
+
+    bool operator>(const SearchNode& other) const { return priority > other.priority; }
+  };
+
+  /**
+   * One bit per cell of a block including the ghost layer.
+   */
+  class VisitedSet {
+  public:
+    VisitedSet(int nx, int ny):
+      rows_(ny + 2),
+      words_((std::size_t(nx + 2) * (ny + 2) + 63) / 64, 0) {}
+
+    /**
+     * @brief Marks cell (x, y), returns false if it was marked before. Safe to call from several threads.
+     */
+    bool insert(int x, int y) {
+      const std::size_t   bit  = std::size_t(x) * rows_ + y;
+      const std::uint64_t mask = std::uint64_t(1) << (bit % 64);
+#if defined(ENABLE_OPENMP)
+      std::atomic_ref<std::uint64_t> word(words_[bit / 64]);
+      if (word.load(std::memory_order_relaxed) & mask) {
+        return false;
       }
-    }
-  }
-
-  // calculate offset depending on the size of the search area (the bigger the search area, the smaller the offset)
-  int offset = 40 - std::log(std::max(maxX - minX, maxY - minY));
-  std::cout << "offset: " << offset << std::endl;
-
-  // Set search area
-  bottomCorner_.first  = std::max(1, minX - offset);
-  bottomCorner_.second = std::max(1, minY - offset);
-  topCorner_.first     = std::min(nx_ - 1, maxX + offset);
-  topCorner_.second    = std::min(ny_ - 1, maxY + offset);
-}
+      return (word.fetch_or(mask, std::memory_order_relaxed) & mask) == 0;
+#else
+      std::uint64_t& word = words_[bit / 64];
+      if (word & mask) {
+        return false;
+      }
+      word |= mask;
+      return true;
 #endif
-void Blocks::ReducedDimSplittingBlock::findSearchArea() {
-  // if the x-distance between start and end cell is bigger than nx/2, shift the data and get a pacific focused map
-  if (abs(startCell_.first - endCell_.first) > nx_ / 2) {
-    shiftData();
-    startCell_.first = (startCell_.first + nx_ / 2) % nx_;
-    endCell_.first   = (endCell_.first + nx_ / 2) % nx_;
-  }
-
-  Tools::Float2D<RealType> heightView(h_, false);
-  Cell::goal = endCell_;
-
-  // change region around start and end cell to -FLT_MAX
-  for (int i = startCell_.first - 3; i <= startCell_.first + 3; i++) {
-    for (int j = startCell_.second - 3; j <= startCell_.second + 3; j++) {
-      heightView[i][j] = -FLT_MAX;
     }
-  }
 
-  for (int i = endCell_.first - 3; i <= endCell_.first + 3; i++) {
-    for (int j = endCell_.second - 3; j <= endCell_.second + 3; j++) {
-      heightView[i][j] = -FLT_MAX;
-    }
-  }
-  std::priority_queue<Cell*, std::vector<Cell*>, CompareCell> openSet;
+  private:
+    std::size_t                rows_;
+    std::vector<std::uint64_t> words_;
+  };
+} // namespace
 
-  // Initialize bounds
-  int minX = startCell_.first, maxX = startCell_.first;
-  int minY = startCell_.second, maxY = startCell_.second;
+template <class SolverPolicy>
+bool Blocks::ReducedDimSplittingBlock<SolverPolicy>::isPassable(int x, int y) const {
+  if (x < 1 || x > nx_ || y < 1 || y > ny_) {
+    return false;
+  }
+  // The epicenter and the destination may be on land, the cells around them are always passable
+  const auto near = [&](const std::pair<int, int>& cell) {
+    const int distanceX = std::abs(x - cell.first);
+    return std::min(distanceX, isPeriodicX() ? nx_ - distanceX : distanceX) <= 3 && std::abs(y - cell.second) <= 3;
+  };
+  return b_[x][y] < 0 || near(startCell_) || near(endCell_);
+}
 
-  openSet.push(new Cell(startCell_.first, startCell_.second, 0));
-  size_t iterations = 0;
+template <class SolverPolicy>
+template <class Visit>
+typename Blocks::ReducedDimSplittingBlock<SolverPolicy>::SearchBounds Blocks::ReducedDimSplittingBlock<SolverPolicy>::searchCorridor(Visit&& visit) const {
+  const auto [goalX, goalY] = endCell_;
+  const auto heuristic      = [&](int x, int y) {
+    // Across a periodic boundary the goal may be closer the other way round
+    const int distanceX = std::abs(wrapX(x) - goalX);
+    const int shortestX = std::min(distanceX, isPeriodicX() ? nx_ - distanceX : distanceX);
+    return std::sqrt(float(shortestX * shortestX + (y - goalY) * (y - goalY)));
+  };
+
+  // Cells are marked when they are pushed, so every cell enters the open set at most once
+  VisitedSet              visited(nx_, ny_);
+  std::vector<SearchNode> openSet;
+  openSet.reserve(std::size_t(4) * (nx_ + ny_));
+
+  SearchBounds bounds{startCell_.first, startCell_.first, startCell_.second, startCell_.second};
+  visited.insert(startCell_.first, startCell_.second);
+  openSet.push_back({heuristic(startCell_.first, startCell_.second), 0.0f, startCell_.first, startCell_.second});
   while (!openSet.empty()) {
-    Cell* current = openSet.top();
-    openSet.pop();
+    std::pop_heap(openSet.begin(), openSet.end(), std::greater<>());
+    const SearchNode current = openSet.back();
+    openSet.pop_back();
 
-    // Update bounds
-    minX = std::min(minX, current->x);
-    maxX = std::max(maxX, current->x);
-    minY = std::min(minY, current->y);
-    maxY = std::max(maxY, current->y);
+    bounds.minX = std::min(bounds.minX, current.x);
+    bounds.maxX = std::max(bounds.maxX, current.x);
+    bounds.minY = std::min(bounds.minY, current.y);
+    bounds.maxY = std::max(bounds.maxY, current.y);
+    visit(wrapX(current.x), current.y);
 
-    // Mark as visited
-    heightView[current->x][current->y] = FLT_MAX;
-
-    // Check if we have reached the goal
-    if (current->x == endCell_.first && current->y == endCell_.second) {
+    if (wrapX(current.x) == goalX && current.y == goalY) {
       break;
     }
 
-    // Explore neighbors
     for (int dx = -1; dx <= 1; ++dx) {
       for (int dy = -1; dy <= 1; ++dy) {
-        if (dx == 0 && dy == 0)
-          continue; // Skip the current cell
-
-        int newX = current->x + dx;
-        int newY = current->y + dy;
-
-        // Check for valid cell, no obstacle, and not visited
-        if (b_[newX][newY] < 0 && heightView[newX][newY] != FLT_MAX) {
-
-          float newCost = current->cost + 1; // Assuming uniform cost
-          openSet.push(new Cell(newX, newY, newCost));
+        const int x = current.x + dx;
+        const int y = current.y + dy;
+        if ((dx == 0 && dy == 0) || !isPassable(wrapX(x), y) || !visited.insert(wrapX(x), y)) {
+          continue;
         }
+        const float cost = current.cost + 1; // Assuming uniform cost
+        openSet.push_back({cost * 0.1f + heuristic(x, y), cost, x, y});
+        std::push_heap(openSet.begin(), openSet.end(), std::greater<>());
       }
     }
   }
-
-  // calculate offset depending on the size of the search area (the bigger the search area, the smaller the offset)
-  int offset = 40 - std::log(std::max(maxX - minX, maxY - minY));
-  std::cout << "offset: " << offset << std::endl;
-
-  // Set search area
-  bottomCorner_.first  = std::max(1, minX - offset);
-  bottomCorner_.second = std::max(1, minY - offset);
-  topCorner_.first     = std::min(nx_ - 1, maxX + offset);
-  topCorner_.second    = std::min(ny_ - 1, maxY + offset);
+  return bounds;
 }
-void Blocks::ReducedDimSplittingBlock::computeNumericalFluxes() {
-  RealType maxWaveSpeedX{0.0};
-  RealType maxWaveSpeedY{0.0};
 
-  /** Calculate the net-updates for the x-stride by iterating over the cells on the x-stride
-   * Cells on the boundary are ghost cells and are not updated, but one net update is needed for the neighbouring cell.
-   * Layout
-   * Q0,4   Q1,4   Q2,4   Q3,4   Q4,4
-   * Q0,3 | Q1,3 | Q2,3 | Q3,3 | Q4,3
-   * Q0,2 | Q1,2 | Q2,2 | Q3,2 | Q4,2
-   * Q0,1 | Q1,1 | Q2,1 | Q3,1 | Q4,1  Qi,j
-   * Q0,0   Q1,0   Q2,0   Q3,0   Q4,0  updates = |
-   */
+template <class SolverPolicy>
+typename Blocks::ReducedDimSplittingBlock<SolverPolicy>::SearchBounds Blocks::ReducedDimSplittingBlock<SolverPolicy>::searchCorridorParallel() const {
+  // Breadth-first search level by level until the level that contains the destination, the cells of a level are
+  // expanded in parallel and appended to the next level in chunks per thread
+  VisitedSet                       visited(nx_, ny_);
+  std::vector<std::pair<int, int>> frontier{startCell_};
+  std::vector<std::pair<int, int>> next;
+  std::atomic<bool>                found{false};
+  bool                             done = false;
+  SearchBounds                     bounds{startCell_.first, startCell_.first, startCell_.second, startCell_.second};
+  visited.insert(startCell_.first, startCell_.second);
 
 #if defined(ENABLE_OPENMP)
-#pragma omp parallel for reduction(max : maxWaveSpeedX), schedule(dynamic)
+#pragma omp parallel
 #endif
-  for (int i = bottomCorner_.first; i <= topCorner_.first; ++i) {
-    for (int j = bottomCorner_.second; j <= topCorner_.second; ++j) {
-      RealType maxEdgeSpeed{0.0};
-
-      fWaveSolver_.computeNetUpdates(
-        h_[i][j],
-        h_[i + 1][j],
-        hu_[i][j],
-        hu_[i + 1][j],
-        b_[i][j],
-        b_[i + 1][j],
-        hNetUpdatesXLeft_[i][j],
-        hNetUpdatesXRight_[i][j],
-        huNetUpdatesXLeft_[i][j],
-        huNetUpdatesXRight_[i][j],
-        maxEdgeSpeed
-      );
-
+  {
+    std::vector<std::pair<int, int>> local;
+    SearchBounds                     localBounds = bounds;
+    // A thread may find the destination while another one has not checked the condition yet, so the threads only
+    // look at done, which changes in the single block
+    while (!done) {
 #if defined(ENABLE_OPENMP)
-      maxWaveSpeedX = std::max(maxWaveSpeedX, maxEdgeSpeed);
-#else
-      // Update the maximum wave speed
-      maxWaveSpeedX = std::max(maxWaveSpeedX, maxEdgeSpeed);
+#pragma omp for schedule(dynamic, 64)
 #endif
-    }
-  }
-
-  /** Calculate the net-updates for the y-stride by iterating over the cells on the y-stride
-   * Cells on the boundary are ghost cells and are not updated, but one net update is needed for the neighbouring cell.
-   * Layout
-   * Q0,4 Q1,4 Q2,4 Q3,4 Q4,4
-   *      --------------
-   * Q0,3 Q1,3 Q2,3 Q3,3 Q4,3
-   *      --------------
-   * Q0,2 Q1,2 Q2,2 Q3,2 Q4,2
-   *      --------------
-   * Q0,1 Q1,1 Q2,1 Q3,1 Q4,1
-   *      --------------       Qi,j
-   * Q0,0 Q1,0 Q2,0 Q3,0 Q4,0  updates = --------------
-   */
-
+      for (std::size_t k = 0; k < frontier.size(); k++) {
+        const auto [currentX, currentY] = frontier[k];
+        for (int dx = -1; dx <= 1; ++dx) {
+          for (int dy = -1; dy <= 1; ++dy) {
+            const int x = currentX + dx;
+            const int y = currentY + dy;
+            if ((dx == 0 && dy == 0) || !isPassable(wrapX(x), y) || !visited.insert(wrapX(x), y)) {
+              continue;
+            }
+            local.emplace_back(x, y);
+            localBounds.minX = std::min(localBounds.minX, x);
+            localBounds.maxX = std::max(localBounds.maxX, x);
+            localBounds.minY = std::min(localBounds.minY, y);
+            localBounds.maxY = std::max(localBounds.maxY, y);
+            if (wrapX(x) == endCell_.first && y == endCell_.second) {
+              found.store(true, std::memory_order_relaxed);
+            }
+          }
+        }
+      }
 #if defined(ENABLE_OPENMP)
-#pragma omp parallel for reduction(max : maxWaveSpeedY), schedule(dynamic)
+#pragma omp critical
 #endif
-  for (int i = bottomCorner_.first; i < topCorner_.first; ++i) {
-    for (int j = bottomCorner_.second; j <= topCorner_.second; ++j) {
-      RealType maxEdgeSpeed{0.0};
-
-      fWaveSolver_.computeNetUpdates(
-        h_[i][j],
-        h_[i][j + 1],
-        hv_[i][j],
-        hv_[i][j + 1],
-        b_[i][j],
-        b_[i][j + 1],
-        hNetUpdatesYLeft_[i][j],
-        hNetUpdatesYRight_[i][j],
-        hvNetUpdatesYLeft_[i][j],
-        hvNetUpdatesYRight_[i][j],
-        maxEdgeSpeed
-      );
-
+      next.insert(next.end(), local.begin(), local.end());
+      local.clear();
 #if defined(ENABLE_OPENMP)
-      maxWaveSpeedY = std::max(maxWaveSpeedY, maxEdgeSpeed);
-#else
-      // Update the maximum wave speed
-      maxWaveSpeedY = std::max(maxWaveSpeedY, maxEdgeSpeed);
+#pragma omp barrier
+#pragma omp single
 #endif
+      {
+        frontier.swap(next);
+        next.clear();
+        done = frontier.empty() || found.load(std::memory_order_relaxed);
+      }
     }
-  }
-
-
-  // Compute the time step width
-  maxTimeStep_ = dx_ / maxWaveSpeedX;
-  maxTimeStep_ = std::min(maxTimeStep_, dy_ / maxWaveSpeedY);
-
-  // Reduce maximum time step size by "safety factor"
-  maxTimeStep_ *= RealType(0.4); // CFL-number = 0.5
-
-  // Debug only check if CFL condition is satisfied for the y-sweep (dt < dy /  (2* maxWaveSpeed))
-#ifndef NDEBUG
-  if (maxTimeStep_ >= ((dy_ / maxWaveSpeedY) * 0.5)) {
-    std::fprintf(stderr, "Warning: CFL condition not satisfied for y-sweep! dt = %f >= %f\n", maxTimeStep_, 0.5 * (dy_ / maxWaveSpeedY));
-  }
-#endif
-}
-void Blocks::ReducedDimSplittingBlock::updateUnknowns(RealType dt) {
 #if defined(ENABLE_OPENMP)
-#pragma omp parallel for schedule(dynamic)
+#pragma omp critical
 #endif
-  for (int i = bottomCorner_.first; i <= topCorner_.first; ++i) {
-    for (int j = bottomCorner_.second; j < topCorner_.second; ++j) {
-      h_[i][j] -= dt / dx_ * (hNetUpdatesXRight_[i - 1][j] + hNetUpdatesXLeft_[i][j]);
-      hu_[i][j] -= dt / dx_ * (huNetUpdatesXRight_[i - 1][j] + huNetUpdatesXLeft_[i][j]);
+    {
+      bounds.minX = std::min(bounds.minX, localBounds.minX);
+      bounds.maxX = std::max(bounds.maxX, localBounds.maxX);
+      bounds.minY = std::min(bounds.minY, localBounds.minY);
+      bounds.maxY = std::max(bounds.maxY, localBounds.maxY);
     }
   }
+  return bounds;
+}
 
-#if defined(ENABLE_OPENMP)
-#pragma omp parallel for schedule(dynamic)
+#ifdef ENABLE_GUI
+template <class SolverPolicy>
+void Blocks::ReducedDimSplittingBlock<SolverPolicy>::findSearchArea(Gui::Gui& gui) {
+  computeArrivalTimes();
+
+  // The GUI shows the visited cells on top of the water height
+  Tools::Float2D<RealType> heightView(h_);
+  std::size_t              iterations = 0;
+  const SearchBounds       bounds     = searchCorridor([&](int x, int y) {
+    heightView[x][y] = FLT_MAX;
+    // update gui every 20 iterations
+    if (iterations++ % 20 == 0) {
+      gui.update(heightView, 0.0);
+    }
+  });
+  setSearchArea(bounds);
+}
 #endif
-  for (int i = bottomCorner_.first; i < topCorner_.first; ++i) {
-    for (int j = bottomCorner_.second; j <= topCorner_.second; ++j) {
-      h_[i][j] -= dt / dy_ * (hNetUpdatesYRight_[i][j - 1] + hNetUpdatesYLeft_[i][j]);
-      hv_[i][j] -= dt / dy_ * (hvNetUpdatesYRight_[i][j - 1] + hvNetUpdatesYLeft_[i][j]);
+template <class SolverPolicy>
+void Blocks::ReducedDimSplittingBlock<SolverPolicy>::findSearchArea() {
+  computeArrivalTimes();
+
+  setSearchArea(parallelSearch_ ? searchCorridorParallel() : searchCorridor([](int, int) {}));
+}
+template <class SolverPolicy>
+void Blocks::ReducedDimSplittingBlock<SolverPolicy>::computeArrivalTimes() {
+  // The initial displacement of the surface is the source of the wave
+  std::vector<std::pair<int, int>> sources;
+  for (int i = 1; i <= nx_; i++) {
+    for (int j = 1; j <= ny_; j++) {
+      if (h_[i][j] > 0 && std::abs(h_[i][j] + b_[i][j]) > SourceDisplacement) {
+        sources.emplace_back(i, j);
+      }
+    }
+  }
+  if (sources.empty()) {
+    for (int i = startCell_.first - 3; i <= startCell_.first + 3; i++) {
+      for (int j = startCell_.second - 3; j <= startCell_.second + 3; j++) {
+        sources.emplace_back(i, j);
+      }
     }
   }
+  arrivalTimes_.compute(b_, nx_, ny_, dx_, dy_, sources, isPeriodicX());
 }
-void Blocks::ReducedDimSplittingBlock::setStartCell(std::pair<int, int> startCell) { startCell_ = startCell; }
 
-void Blocks::ReducedDimSplittingBlock::setEndCell(std::pair<int, int> endCell) { endCell_ = endCell; }
-void Blocks::ReducedDimSplittingBlock::shiftData() {
-  // shift bathymetry half of nx to the right and roll the rest to the left
-  for (int j = 0; j < ny_; ++j) {
-    b_[0][j] = b_[nx_ / 2][j];
-    b_[nx_ / 2][j] = -1000;
-  }
-  for (int i = 1; i < nx_ / 2; i++) {
-    for (int j = 0; j < ny_; ++j) {
-      double tmp         = b_[i][j];
-      b_[i][j]           = b_[i + nx_ / 2][j];
-      b_[i + nx_ / 2][j] = tmp;
+template <class SolverPolicy>
+RealType Blocks::ReducedDimSplittingBlock<SolverPolicy>::getDestinationArrivalTime() const {
+  // The destination itself is usually on land, like the search the time is taken from the cells around it
+  const auto [x, y] = endCell_;
+  return arrivalTimes_.getMinimum(x - 3, x + 3, y - 3, y + 3);
+}
+
+template <class SolverPolicy>
+void Blocks::ReducedDimSplittingBlock<SolverPolicy>::setSearchArea(const SearchBounds& bounds) {
+  // Columns of the search area, a periodic block can have them on both sides of the boundary
+  std::vector<bool> columns(nx_ + 1, false);
+  int               minY = bounds.minY;
+  int               maxY = bounds.maxY;
+
+  const RealType arrivalTime = getDestinationArrivalTime();
+  if (std::isinf(arrivalTime)) {
+    std::cout << "The wave does not reach the destination over water, searching the whole domain" << std::endl;
+    std::fill(columns.begin() + 1, columns.end(), true);
+    minY = 1;
+    maxY = ny_;
+  } else {
+    for (int x = bounds.minX; x <= std::min(bounds.maxX, bounds.minX + nx_ - 1); x++) {
+      columns[wrapX(x)] = true;
     }
+    // Every cell the wave reaches before it arrives at the destination (plus the margin) can influence the destination
+    const RealType limit = arrivalTime * (1 + arrivalMargin_);
+    for (int i = 1; i <= nx_; i++) {
+      for (int j = 1; j <= ny_; j++) {
+        if (arrivalTimes_.get(i, j) <= limit) {
+          columns[i] = true;
+          minY       = std::min(minY, j);
+          maxY       = std::max(maxY, j);
+        }
+      }
+    }
+    std::cout << "Estimated arrival at the destination after " << arrivalTime << " s" << std::endl;
   }
 
-  // shift h_ half of nx to the right and roll the rest to the left
-  for (int j = 0; j < ny_; ++j) {
-    h_[0][j] = h_[nx_ / 2][j];
-    h_[nx_ / 2][j] = 1000;
+  int minX = nx_;
+  int maxX = 1;
+  for (int i = 1; i <= nx_; i++) {
+    if (columns[i]) {
+      minX = std::min(minX, i);
+      maxX = std::max(maxX, i);
+    }
   }
-  for (int i = 1; i < nx_ / 2; i++) {
-    for (int j = 0; j < ny_; ++j) {
-      double tmp         = h_[i][j];
-      h_[i][j]           = h_[i + nx_ / 2][j];
-      h_[i + nx_ / 2][j] = tmp;
+  wrapsAround_ = false;
+  if (isPeriodicX()) {
+    // The search area is the complement of the longest run of columns outside of it, which can go around the block
+    int gapLength = 0;
+    int gapEnd    = 0;
+    for (int k = 1, run = 0; k <= 2 * nx_; k++) {
+      run = columns[wrapX(k)] ? 0 : std::min(run + 1, nx_);
+      if (run > gapLength) {
+        gapLength = run;
+        gapEnd    = wrapX(k);
+      }
     }
+    minX = wrapX(gapEnd + 1);
+    maxX = wrapX(gapEnd - gapLength);
+    // At the first or last column the cell beyond the search area is on the other side of the boundary
+    wrapsAround_ = gapLength == 0 || minX > maxX || minX == 1 || maxX == nx_;
+  }
+
+  // The sweeps read one cell beyond the corridor
+  bottomCorner_.first  = wrapsAround_ ? 1 : std::max(1, minX - 1);
+  bottomCorner_.second = std::max(1, minY - 1);
+  topCorner_.first     = wrapsAround_ ? nx_ : std::min(nx_ - 1, maxX + 1);
+  topCorner_.second    = std::min(ny_ - 1, maxY + 1);
+}
+
+template <class SolverPolicy>
+typename Blocks::ReducedDimSplittingBlock<SolverPolicy>::SweepRanges Blocks::ReducedDimSplittingBlock<SolverPolicy>::getSweepRanges() const {
+  const auto [left, bottom] = bottomCorner_;
+  const auto [right, top]   = topCorner_;
+  if (wrapsAround_) {
+    // All columns including the edge between the ghost layer and the first column
+    return {{0, nx_, bottom, top}, {1, nx_, bottom, top}, {1, nx_, bottom, top - 1}, {1, nx_, bottom, top}};
   }
+  return {{left, right, bottom, top}, {left, right - 1, bottom, top}, {left, right, bottom, top - 1}, {left, right - 1, bottom, top}};
 }
+template <class SolverPolicy>
+void Blocks::ReducedDimSplittingBlock<SolverPolicy>::setStartCell(std::pair<int, int> startCell) { startCell_ = startCell; }
+
+template <class SolverPolicy>
+void Blocks::ReducedDimSplittingBlock<SolverPolicy>::setEndCell(std::pair<int, int> endCell) { endCell_ = endCell; }
 
+template class Blocks::ReducedDimSplittingBlock<Solvers::FWaveKernel>;
+template class Blocks::ReducedDimSplittingBlock<Solvers::RusanovKernel>;
@@ -1,14 +1,38 @@
 #pragma once
 #include "DimensionalSplitting.h"
-#include "Solvers/FWaveSolver.h"
+#include "Tools/ArrivalTimes.h"
 #if defined(ENABLE_GUI)
 #include "Gui/Gui.h"
 #endif
 
 namespace Blocks {
-  class ReducedDimSplittingBlock : public DimensionalSplitting {
+  /**
+   * Dimensional splitting block that only updates the area around the path from the epicenter to the destination.
+   *
+   * @tparam SolverPolicy the edge solver used in the sweeps, see Blocks::DimensionalSplitting.
+   */
+  template <class SolverPolicy = Solvers::FWaveKernel>
+  class ReducedDimSplittingBlock : public DimensionalSplitting<SolverPolicy> {
+  protected:
+    // members of the dependent base classes
+    using Block::b_;
+    using Block::dx_;
+    using Block::dy_;
+    using Block::h_;
+    using Block::isPeriodicX;
+    using Block::nx_;
+    using Block::ny_;
+    using typename DimensionalSplitting<SolverPolicy>::SweepRanges;
+
+    /**
+     * @brief Only the search area is swept. The inactive tiles cover the whole block, so the time step can only get
+     * smaller than needed for the search area. A search area across a periodic left/right boundary is swept in all
+     * columns of its rows.
+     */
+    SweepRanges getSweepRanges() const override;
+
   public:
-    ReducedDimSplittingBlock(int nx, int ny, RealType dx, RealType dy);
+    ReducedDimSplittingBlock(int nx, int ny, RealType dx, RealType dy, ExecutionMode executionMode = ExecutionMode::Buffered);
     ~ReducedDimSplittingBlock() override = default;
 #if defined(ENABLE_GUI)
     /**
@@ -21,18 +45,33 @@ namespace Blocks {
      */
     void findSearchArea();
 
-    void setStartCell(std::pair<int, int> startCell);
-    void setEndCell(std::pair<int, int> endCell);
+    /**
+     * @brief Computes the first arrival times of the wave from the cells displaced by the initial condition (or the
+     * start cell if nothing is displaced), see Tools::ArrivalTimes. findSearchArea calls it before the search.
+     */
+    void computeArrivalTimes();
+    const Tools::ArrivalTimes& getArrivalTimes() const { return arrivalTimes_; }
 
-    void computeNumericalFluxes() override;
+    /**
+     * @brief Estimated arrival time of the wave at the destination: the earliest one in the cells around the end cell,
+     * infinite if the wave cannot reach it over water.
+     */
+    RealType getDestinationArrivalTime() const;
 
-    void updateUnknowns(RealType dt) override;
+    /**
+     * @brief The search area covers every cell the wave reaches up to (1 + margin) times the arrival time at the
+     * destination (default 0.25).
+     */
+    void setArrivalMargin(RealType margin) { arrivalMargin_ = margin; }
 
     /**
-     * @brief Shifts the data-arrays b and h by half of their lengths to the right. The right half of the arrays is then wrapped around to the left half.
+     * @brief Search the corridor with a parallel breadth-first search instead of A*. It visits more cells, but all
+     * threads share the work, which pays off on large grids.
      */
-    void shiftData();
+    void setParallelSearch(bool parallelSearch) { parallelSearch_ = parallelSearch; }
 
+    void setStartCell(std::pair<int, int> startCell);
+    void setEndCell(std::pair<int, int> endCell);
 
   private:
     // pair of coordinates of the startcell for the search (epicenter)
@@ -43,8 +82,51 @@ namespace Blocks {
     std::pair<int, int> bottomCorner_;
     // pair of coordinates of the top right corner of the resulting search area
     std::pair<int, int> topCorner_;
+    // the search area crosses the periodic left/right boundary
+    bool wrapsAround_{false};
 
+    //! surface displacement in m above which a cell is a source of the wave
+    static constexpr RealType SourceDisplacement = 1e-3;
+
+    Tools::ArrivalTimes arrivalTimes_;
+    RealType            arrivalMargin_{0.25};
+    bool                parallelSearch_{false};
+
+    //! bounding box of the cells visited by a corridor search, on a block that is periodic in x the columns are counted
+    //! across the boundary, so minX can be below 1 and maxX above nx.
+    struct SearchBounds {
+      int minX;
+      int maxX;
+      int minY;
+      int maxY;
+    };
+
+    //! Whether the search may enter cell (x, y): wet cells and the cells around the start and end cell.
+    bool isPassable(int x, int y) const;
+
+    //! column x moved into [1, nx] across a periodic left/right boundary, unchanged otherwise
+    int wrapX(int x) const { return isPeriodicX() ? ((x - 1) % nx_ + nx_) % nx_ + 1 : x; }
+
+    /**
+     * @brief A* search from the start to the end cell, calls visit(x, y) for every expanded cell.
+     */
+    template <class Visit>
+    SearchBounds searchCorridor(Visit&& visit) const;
+
+    /**
+     * @brief Parallel breadth-first search from the start cell until the end cell is reached.
+     */
+    SearchBounds searchCorridorParallel() const;
+
+    /**
+     * @brief Sets the search area to the bounding box of the cells within the arrival time margin and the cells
+     * visited by the search.
+     */
+    void setSearchArea(const SearchBounds& bounds);
 
   };
 
+  extern template class ReducedDimSplittingBlock<Solvers::FWaveKernel>;
+  extern template class ReducedDimSplittingBlock<Solvers::RusanovKernel>;
+
 } // namespace Block
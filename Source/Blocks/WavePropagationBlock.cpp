@@ -30,7 +30,9 @@
 
 #include "WavePropagationBlock.hpp"
 
+#include <algorithm>
 #include <iostream>
+#include <limits>
 
 Blocks::WavePropagationBlock::WavePropagationBlock(int nx, int ny, RealType dx, RealType dy):
   Block(nx, ny, dx, dy),
@@ -60,12 +62,35 @@ Blocks::WavePropagationBlock::WavePropagationBlock(
   hvNetUpdatesAbove_(nx, ny + 1) {}
 
 void Blocks::WavePropagationBlock::computeNumericalFluxes() {
+  // Compute the net-updates for the vertical and the horizontal edges
+  const RealType maxWaveSpeedVertical   = computeNetUpdatesVertical(1, nx_ + 1, 1, ny_);
+  const RealType maxWaveSpeedHorizontal = computeNetUpdatesHorizontal(1, nx_, 1, ny_ + 1);
+
+  setMaxTimeStep(std::max(maxWaveSpeedVertical, maxWaveSpeedHorizontal));
+}
+
+void Blocks::WavePropagationBlock::computeNumericalFluxesInterior() {
+  // The edges to the ghost columns and rows are left for computeNumericalFluxesBoundary
+  interiorMaxWaveSpeed_ = std::max(computeNetUpdatesVertical(2, nx_, 1, ny_), computeNetUpdatesHorizontal(1, nx_, 2, ny_));
+}
+
+void Blocks::WavePropagationBlock::computeNumericalFluxesBoundary() {
+  RealType maxWaveSpeed = interiorMaxWaveSpeed_;
+
+  maxWaveSpeed = std::max(maxWaveSpeed, computeNetUpdatesVertical(1, 1, 1, ny_));
+  maxWaveSpeed = std::max(maxWaveSpeed, computeNetUpdatesVertical(nx_ + 1, nx_ + 1, 1, ny_));
+  maxWaveSpeed = std::max(maxWaveSpeed, computeNetUpdatesHorizontal(1, nx_, 1, 1));
+  maxWaveSpeed = std::max(maxWaveSpeed, computeNetUpdatesHorizontal(1, nx_, ny_ + 1, ny_ + 1));
+
+  setMaxTimeStep(maxWaveSpeed);
+}
+
+RealType Blocks::WavePropagationBlock::computeNetUpdatesVertical(int iBegin, int iEnd, int jBegin, int jEnd) {
   // Maximum (linearized) wave speed within one iteration
   RealType maxWaveSpeed = RealType(0.0);
 
-  // Compute the net-updates for the vertical edges
-  for (int i = 1; i < nx_ + 2; i++) {
-    for (int j = 1; j < ny_ + 1; ++j) {
+  for (int i = iBegin; i <= iEnd; i++) {
+    for (int j = jBegin; j <= jEnd; ++j) {
       RealType maxEdgeSpeed = RealType(0.0);
 
       wavePropagationSolver_.computeNetUpdates(
@@ -87,9 +112,14 @@ void Blocks::WavePropagationBlock::computeNumericalFluxes() {
     }
   }
 
-  // Compute the net-updates for the horizontal edges
-  for (int i = 1; i < nx_ + 1; i++) {
-    for (int j = 1; j < ny_ + 2; j++) {
+  return maxWaveSpeed;
+}
+
+RealType Blocks::WavePropagationBlock::computeNetUpdatesHorizontal(int iBegin, int iEnd, int jBegin, int jEnd) {
+  RealType maxWaveSpeed = RealType(0.0);
+
+  for (int i = iBegin; i <= iEnd; i++) {
+    for (int j = jBegin; j <= jEnd; j++) {
       RealType maxEdgeSpeed = RealType(0.0);
 
       wavePropagationSolver_.computeNetUpdates(
@@ -111,6 +141,10 @@ void Blocks::WavePropagationBlock::computeNumericalFluxes() {
     }
   }
 
+  return maxWaveSpeed;
+}
+
+void Blocks::WavePropagationBlock::setMaxTimeStep(RealType maxWaveSpeed) {
   if (maxWaveSpeed > 0.00001) {
     // Compute the time step width
     maxTimeStep_ = std::min(dx_ / maxWaveSpeed, dy_ / maxWaveSpeed);
@@ -85,6 +85,30 @@ namespace Blocks {
     //! net-updates for the y-momentums of the cells above the horizontal edges.
     Tools::Float2D<RealType> hvNetUpdatesAbove_;
 
+    //! maximum wave speed of the edges computed by computeNumericalFluxesInterior.
+    RealType interiorMaxWaveSpeed_{0.0};
+
+    /**
+     * Computes the net-updates of the vertical edges between column i - 1 and i for i in [iBegin, iEnd] and rows
+     * [jBegin, jEnd].
+     *
+     * @return maximum wave speed of these edges.
+     */
+    RealType computeNetUpdatesVertical(int iBegin, int iEnd, int jBegin, int jEnd);
+
+    /**
+     * Computes the net-updates of the horizontal edges between row j - 1 and j for j in [jBegin, jEnd] and columns
+     * [iBegin, iEnd].
+     *
+     * @return maximum wave speed of these edges.
+     */
+    RealType computeNetUpdatesHorizontal(int iBegin, int iEnd, int jBegin, int jEnd);
+
+    /**
+     * Sets the member variable #maxTimestep from the maximum wave speed of all edges.
+     */
+    void setMaxTimeStep(RealType maxWaveSpeed);
+
   public:
     /**
      * Constructor of a Blocks::WavePropagationBlock.
@@ -146,6 +170,16 @@ namespace Blocks {
      */
     void computeNumericalFluxes() override;
 
+    /**
+     * Compute the net updates of the edges between two cells of the block, no ghost cell is read.
+     */
+    void computeNumericalFluxesInterior() override;
+
+    /**
+     * Compute the net updates of the edges to the ghost layer and the maximum time step of all edges.
+     */
+    void computeNumericalFluxesBoundary() override;
+
     /**
      * Updates the unknowns with the already computed net-updates.
      *
@@ -3,4 +3,4 @@
 /**
  * Available types of boundary conditions
  */
-enum BoundaryType { Outflow, Wall, Inflow, Connect, Passive };
+enum BoundaryType { Outflow, Wall, Inflow, Connect, Passive, Periodic };
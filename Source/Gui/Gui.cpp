@@ -12,7 +12,7 @@ Gui::Gui::Gui(const Tools::Float2D<RealType>& b, int width, int height) :
   colorMax(new float[4]{1.0f, 0.0f, 0.0f, 1.0f}),
   clipMin(0.0f),
   clipMax(4.0f),
-  b_{b, false}
+  b_{b}
 {
   if (!glfwInit()) {
     std::cout << "Failed to initialize GLFW" << std::endl;
@@ -369,7 +369,7 @@ std::pair<std::pair<int, int>, std::pair<int, int>> Gui::Gui::getStartEnd(const
   return std::make_pair(start, end);
 }
 
-void Gui::Gui::setBathymetry(Tools::Float2D<RealType>& b) {
+void Gui::Gui::setBathymetry(const Tools::Float2D<RealType>& b) {
   b_ = b;
 }
 
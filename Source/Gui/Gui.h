@@ -19,7 +19,7 @@ namespace Gui {
   public:
     /**
      * @brief Construct a new Gui object
-     * @param b bathymetry to display
+     * @param b bathymetry to display, it is not copied and has to outlive the Gui
      */
     explicit Gui(const Tools::Float2D<RealType>& b, int width, int height);
     /**
@@ -32,7 +32,10 @@ namespace Gui {
     std::pair<std::pair<int, int>, std::pair<int, int>> getStartEnd(const Tools::Float2D<RealType>& h);
     ~Gui();
 
-    void setBathymetry(Tools::Float2D<RealType>& b);
+    /**
+     * @brief Displays b from now on, b has to outlive the Gui
+     */
+    void setBathymetry(const Tools::Float2D<RealType>& b);
 
 
   private:
@@ -45,7 +48,7 @@ namespace Gui {
     float *                   colorMin, *colorMax;
     float                     clipMin, clipMax;
     GLint                     clipMaxLoc, clipMinLoc;
-    Tools::Float2D<RealType> b_;
+    Tools::Float2DView<const RealType> b_;
     GLfloat*                  data;
     void                      setupShaders();
   };
@@ -50,3 +50,14 @@ double Readers::NetCDFUnbufferedReader::readUnbuffered(int x, int y) const {
   assert(retval == NC_NOERR);
   return data;
 }
+
+void Readers::NetCDFUnbufferedReader::readHyperslab(size_t firstX, size_t countX, size_t firstY, size_t countY, double* data) const {
+  size_t start[2] = {firstX, firstY};
+  size_t count[2] = {countX, countY};
+  int retval = nc_get_vara_double(fileID_, zVarID_, start, count, data);
+  if(retval != NC_NOERR){
+    std::cout << "Error reading data" << nc_strerror(retval) <<std::endl;
+    std::cout << "x: " << firstX << " - " << firstX + countX << " y: " << firstY << " - " << firstY + countY << std::endl;
+    exit(EXIT_FAILURE);
+  }
+}
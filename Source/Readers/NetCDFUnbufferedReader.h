@@ -10,6 +10,13 @@ namespace Readers{
 
       [[nodiscard]] double readUnbuffered(int x, int y) const;
 
+      /**
+       * @brief Reads the countX x countY values starting at (firstX, firstY) with one call, y is the contiguous index
+       *
+       * @param [out] data: Room for countX * countY values
+       */
+      void readHyperslab(size_t firstX, size_t countX, size_t firstY, size_t countY, double* data) const;
+
       size_t getXDim() const { return xDim; }
       size_t getYDim() const { return yDim; }
 
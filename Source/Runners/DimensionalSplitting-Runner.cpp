@@ -1,8 +1,13 @@
 
 // #include <format>
+#include <memory>
+#include <sstream>
 #include <string>
+#include <vector>
 
+#include "Blocks/AdaptiveMesh.h"
 #include "Blocks/DimensionalSplitting.h"
+#include "Blocks/NestedGrid.h"
 #include "Blocks/ReducedDimSplittingBlock.h"
 #include "BoundaryEdge.hpp"
 #ifdef ENABLE_GUI
@@ -97,48 +102,13 @@ RealType convertEnteredYtoMappedY(RealType maxY, RealType enteredY) {
 }
 
 /**
- * @brief This method can be used to convert an array of sizes nx / ny to a coarsed version with the averaged values according to Sheet 4 Task 5
+ * @brief Runs the simulation with the given solver policy, see Blocks::DimensionalSplitting
  *
- * @param array [in] The array to be coarsed
- * @param coarse [in] The parameter that defines how many cells should be added into one
- * @param nx [in] The dimension in X direction of the origin array
- * @param ny [in] The dimension in Y direction of the origin array
- * @param groupsX [in] The amount of full groups that can be formed in X direction -> nx / coarse as full integer rounded down
- * @param restX [in] The amount of leftover cells in X direction that don't form a full group
- * @param groupsY [in] The amount of full groups that can be formed in Y direction -> ny / coarse as full integer rounded down
- * @param restY [in] The amount of leftover cells in Y direction that don't form a full group
- * @return [out] The array of coarsed values which can then be printed
+ * @param args [in] The parsed command line arguments
+ * @return [out] The exit code of the runner
  */
-int main(int argc, char** argv) {
-  Tools::Args args;
-  args.addOption("grid-size", 'x', "Number of cells in x and y direction");
-  args.addOption("output-basepath", 'o', "Output base file name");
-  args.addOption("number-of-checkpoints", 'n', "Number of checkpoints to write output files");
-  args.addOption("simulation-time", 't', "Simulation time in seconds");
-  args.addOption(
-    "boundary-conditions", 'y',
-    "Set Boundary Conditions represented by an 4 digit Integer of 1s and 2s. (1: Outflow, 2: Wall).\n First Digit: Left Boundary\n Second Digit: Right Boundary\n Third Digit: Bottom Boundary\n Fourth Digit: Top Boundary"
-  );
-  args.addOption("checkpoint-file", 'c', "Checkpoint file to read initial values from");
-  args.addOption("coarse", 'k', "Parameter for the coarse output, averaging the next <param> cells");
-  args.addOption("magnitude", 'm', "The moment-megnitude of the eartquake");
-  args.addOption("richter-scale", 'r', "The magnitude on the richter scale, this should not be used as it will be subject to many approximation errors");
-  args.addOption("destinationLongitude", 'a', "The longitude coordinate of the destination city");
-  args.addOption("destinationLatitude", 'b', " The latitude coordinate of the destination city");
-  args.addOption("epicenterLongitude", 'e', "The longitude coordinate of the epicenter");
-  args.addOption("epicenterLatitude", 'f', "The latitude coordinate of the epicenter");
-  args.addOption("limit", 'l', "The limit variable represents the critical water level change that, when surpassed, triggers a warning in the tsunami detection system");
-  args.addOption("scenarios", 's', "The user can use a pre-chosen scenario. The given scenarios have ids 1 to 3. These should be used with grid-sizes >= 1000.");
-  args.addOption("GUICoordinates", 'g', "The user can use the GUI to enter the coordinates of the epicenter and the destination city. 0: No, 1: Yes");
-
-  Tools::Args::Result ret = args.parse(argc, argv);
-  if (ret == Tools::Args::Result::Help) {
-    return 0;
-  }
-  if (ret == Tools::Args::Result::Error) {
-    return 1;
-  }
-
+template <class SolverPolicy>
+int runSimulation(Tools::Args& args) {
   // Create the scenario
 
 
@@ -249,7 +219,14 @@ int main(int argc, char** argv) {
 
 
   if (checkpointFile.empty()) {
-    if (boundaryConditions == 1111 || boundaryConditions == 1112 || boundaryConditions == 1121 || boundaryConditions == 1122 || boundaryConditions == 1211 || boundaryConditions == 1212 || boundaryConditions == 1221 || boundaryConditions == 1222 || boundaryConditions == 2111 || boundaryConditions == 2112 || boundaryConditions == 2121 || boundaryConditions == 2122 || boundaryConditions == 2211 || boundaryConditions == 2212 || boundaryConditions == 2221 || boundaryConditions == 2222) {
+    // Every digit is 1, 2 or 3, and a periodic boundary needs a periodic boundary on the opposite edge
+    const int  left     = boundaryConditions / 1000;
+    const int  right    = (boundaryConditions / 100) % 10;
+    const int  bottom   = (boundaryConditions / 10) % 10;
+    const int  top      = boundaryConditions % 10;
+    const auto isDigit  = [](int digit) { return digit >= 1 && digit <= 3; };
+    const bool periodic = (left == 3) == (right == 3) && (bottom == 3) == (top == 3);
+    if (boundaryConditions >= 1111 && boundaryConditions <= 3333 && isDigit(left) && isDigit(right) && isDigit(bottom) && isDigit(top) && periodic) {
       scenario->setBoundaryType(boundaryConditions);
     } else {
       std::cout << "Boundary conditions invalid!" << std::endl;
@@ -273,9 +250,42 @@ int main(int argc, char** argv) {
   std::pair<RealType, RealType> epicenter{epicenterX, epicenterY};
   std::pair<RealType, RealType> destination{destinationX, destinationY};
 
-  auto waveBlock = new Blocks::ReducedDimSplittingBlock(numberOfGridCellsX, numberOfGridCellsY, cellSizeX, cellSizeY);
+#ifdef ENABLE_OPENMP
+  // The block places its pages on the NUMA node of the thread that sweeps them, which only pays off if the threads stay there
+  if (omp_get_proc_bind() == omp_proc_bind_false) {
+    Tools::Logger::logger.getDefaultOutputStream(
+    ) << "OpenMP threads are not pinned, set OMP_PROC_BIND=close (or spread) and OMP_PLACES=cores to keep them next to their memory"
+      << std::endl;
+  }
+#endif
+
+  // The layout applies to all arrays allocated from here on, in particular to the arrays of the block
+  Tools::MemoryLayout::getDefault().padColumns = args.isSet("padded-arrays");
+  const std::string hugePages                  = args.getArgument<std::string>("huge-pages", "none");
+  if (hugePages == "transparent") {
+    Tools::MemoryLayout::getDefault().hugePages = Tools::HugePages::Transparent;
+  } else if (hugePages == "explicit") {
+    Tools::MemoryLayout::getDefault().hugePages = Tools::HugePages::Explicit;
+  } else if (hugePages != "none") {
+    std::cout << "Unknown huge page mode " << hugePages << "! Use none, transparent or explicit." << std::endl;
+    return 1;
+  }
+
+  Blocks::ExecutionMode executionMode = Blocks::ExecutionMode::Buffered;
+  if (args.isSet("fused")) {
+    executionMode = Blocks::ExecutionMode::Fused;
+  } else if (args.isSet("tiled")) {
+    executionMode = Blocks::ExecutionMode::Tiled;
+  } else if (args.isSet("task-graph")) {
+    executionMode = Blocks::ExecutionMode::TaskGraph;
+  } else if (args.isSet("local-time-stepping")) {
+    executionMode = Blocks::ExecutionMode::LocalTimeStepping;
+  }
+
+  auto waveBlock = new Blocks::ReducedDimSplittingBlock<SolverPolicy>(numberOfGridCellsX, numberOfGridCellsY, cellSizeX, cellSizeY, executionMode);
   Tools::Logger::logger.printString("Init Waveblock");
   waveBlock->initialiseScenario(0, 0, *scenario);
+  waveBlock->setActiveTileSize(args.getArgument<int>("active-tiles", 0));
   Tools::Logger::logger.printString("Init finished");
 
 #if defined(ENABLE_GUI)
@@ -305,6 +315,76 @@ int main(int argc, char** argv) {
   waveBlock->setEndCell(destination);
 #endif
 
+  // Refined patches around the wave front near the destination and along steep bathymetry
+  std::unique_ptr<Blocks::AdaptiveMesh<SolverPolicy>> adaptiveMesh;
+  const int                                           refinementLevels = args.getArgument<int>("refinement-levels", 1);
+  if (refinementLevels > 1) {
+    if (executionMode == Blocks::ExecutionMode::LocalTimeStepping) {
+      std::cout << "Local time stepping cannot be combined with adaptive mesh refinement!" << std::endl;
+      return 1;
+    }
+    typename Blocks::AdaptiveMesh<SolverPolicy>::Parameters parameters;
+    parameters.levels = refinementLevels;
+    if (threshold != -1) {
+      parameters.destinationX      = (destinationX - RealType(0.5)) * cellSizeX;
+      parameters.destinationY      = (destinationY - RealType(0.5)) * cellSizeY;
+      parameters.destinationRadius = 4 * parameters.patchSize * std::max(cellSizeX, cellSizeY);
+    }
+    adaptiveMesh = std::make_unique<Blocks::AdaptiveMesh<SolverPolicy>>(*waveBlock, *scenario, 0, 0, cellSizeX, cellSizeY, parameters);
+    Tools::Logger::logger.getDefaultOutputStream() << "Refinement levels: " << refinementLevels << ", initial patches: " << adaptiveMesh->getPatches().size() << std::endl;
+  }
+
+  // Fine regions driven by the ghost layers of the coarse block, by default around the destination
+  std::unique_ptr<Blocks::NestedGrid<SolverPolicy>> nestedGrid;
+  const int                                         nestingRatio = args.getArgument<int>("nesting-ratio", 1);
+  if (nestingRatio > 1) {
+    if (adaptiveMesh) {
+      std::cout << "Nested regions cannot be combined with adaptive mesh refinement!" << std::endl;
+      return 1;
+    }
+    std::vector<typename Blocks::NestedGrid<SolverPolicy>::Region> regions;
+    std::istringstream                                             regionList(args.getArgument<std::string>("nested-regions", ""));
+    std::string                                                    region;
+    while (std::getline(regionList, region, ',')) {
+      typename Blocks::NestedGrid<SolverPolicy>::Region cells{0, 0, 0, 0};
+      char                                              separator = 0;
+      std::istringstream(region) >> cells.firstX >> separator >> cells.firstY >> separator >> cells.lastX >> separator >> cells.lastY;
+      if (cells.firstX < 1 || cells.firstY < 1 || cells.lastX > numberOfGridCellsX || cells.lastY > numberOfGridCellsY || cells.firstX > cells.lastX || cells.firstY > cells.lastY) {
+        std::cout << "Invalid nested region " << region << "! Use firstX:firstY:lastX:lastY with cells of the grid." << std::endl;
+        return 1;
+      }
+      regions.push_back(cells);
+    }
+    if (regions.empty()) {
+      if (threshold == -1) {
+        std::cout << "Nesting needs --nested-regions or a destination!" << std::endl;
+        return 1;
+      }
+      const int halfWidth = 32;
+      regions.push_back(
+        {std::max(destinationX - halfWidth, 1),
+         std::max(destinationY - halfWidth, 1),
+         std::min(destinationX + halfWidth - 1, numberOfGridCellsX),
+         std::min(destinationY + halfWidth - 1, numberOfGridCellsY)}
+      );
+    }
+    nestedGrid = std::make_unique<Blocks::NestedGrid<SolverPolicy>>(
+      *waveBlock,
+      *scenario,
+      0,
+      0,
+      cellSizeX,
+      cellSizeY,
+      nestingRatio,
+      regions,
+      checkpointFile.empty(),
+      executionMode == Blocks::ExecutionMode::LocalTimeStepping ? Blocks::ExecutionMode::Buffered : executionMode
+    );
+    Tools::Logger::logger.getDefaultOutputStream(
+    ) << "Nested regions: " << regions.size() << " with ratio " << nestingRatio << ", threads: " << nestedGrid->getCoarseThreads()
+      << " for the coarse grid and " << nestedGrid->getFineThreads() << " for the regions" << std::endl;
+  }
+
   double* checkPoints = new double[numberOfCheckPoints + 1];
 
   for (int cp = 0; cp <= numberOfCheckPoints; cp++) {
@@ -326,24 +406,20 @@ int main(int argc, char** argv) {
     addX    = (restX != 0) ? 1 : 0;
     addY    = (restY != 0) ? 1 : 0;
   }
-  // bathymetry copy
-  auto* bathymetry = new RealType[(waveBlock->getNx() + 2) * (waveBlock->getNy() + 2)];
-  if (coarse <= 0) {
-
-    for (int i = 0; i < (waveBlock->getNx() + 2) * (waveBlock->getNy() + 2); i++) {
-      int x         = i / (waveBlock->getNx() + 2);
-      int y         = i % (waveBlock->getNx() + 2);
-      bathymetry[i] = waveBlock->getBathymetry()[x][y];
-    }
+  // Reused for every coarse output, the writer keeps a view of the bathymetry instead of a copy
+  Tools::Float2D<RealType> coarseBathymetry(groupsX + addX + 2, groupsY + addY + 2, coarse > 0);
+  Tools::Float2D<RealType> coarseWaterHeight(groupsX + addX + 2, groupsY + addY + 2, coarse > 0);
+  Tools::Float2D<RealType> coarseDischargeHu(groupsX + addX + 2, groupsY + addY + 2, coarse > 0);
+  Tools::Float2D<RealType> coarseDischargeHv(groupsX + addX + 2, groupsY + addY + 2, coarse > 0);
+  if (coarse > 0) {
+    Tools::Coarse::coarseArray(waveBlock->getBathymetry(), coarse, waveBlock->getNx(), waveBlock->getNy(), groupsX, restX, groupsY, restY, coarseBathymetry);
   }
-  Tools::Float2D<RealType> coarseArr(Tools::Coarse::coarseArray(waveBlock->getBathymetry(), coarse, waveBlock->getNx(), waveBlock->getNy(), groupsX, restX, groupsY, restY));
 
-  Tools::Float2D<RealType> bathyCopy(waveBlock->getNx() + 2, waveBlock->getNy() + 2, bathymetry);
   Writers::NetCDFWriter    writer
     = checkpointFile.empty()
         ? Writers::NetCDFWriter(
           baseName,
-          ((coarse <= 0) ? bathyCopy : coarseArr),
+          ((coarse <= 0) ? waveBlock->getBathymetry() : coarseBathymetry),
           boundarySize,
           boundaryConditions,
           ((coarse <= 0) ? numberOfGridCellsX : (groupsX + addX)),
@@ -355,6 +431,48 @@ int main(int argc, char** argv) {
           1
         )
         : Writers::NetCDFWriter(checkpointFile, ((coarse <= 0) ? numberOfGridCellsX : (groupsX + addX)), ((coarse <= 0) ? numberOfGridCellsY : (groupsY + addY)), boundarySize, 1);
+  // Every patch of the adaptive mesh goes into a group of its own next to the base block
+  auto writePatches = [&](double time) {
+    if (nestedGrid) {
+      // The regions run one coarse time step behind
+      nestedGrid->synchronise();
+      for (const auto* nest : nestedGrid->getNests()) {
+        auto& block = nest->getBlock();
+        writer.writePatch(
+          nest->getName(),
+          1,
+          block.getWaterHeight(),
+          block.getDischargeHu(),
+          block.getDischargeHv(),
+          block.getBathymetry(),
+          nest->getOffsetX(),
+          nest->getOffsetY(),
+          nest->getDx(),
+          nest->getDy(),
+          time
+        );
+      }
+    }
+    if (!adaptiveMesh) {
+      return;
+    }
+    for (const auto* patch : adaptiveMesh->getPatches()) {
+      auto& block = patch->getBlock();
+      writer.writePatch(
+        patch->getName(),
+        patch->getLevel(),
+        block.getWaterHeight(),
+        block.getDischargeHu(),
+        block.getDischargeHv(),
+        block.getBathymetry(),
+        patch->getOffsetX(),
+        patch->getOffsetY(),
+        patch->getDx(),
+        patch->getDy(),
+        time
+      );
+    }
+  };
   Tools::ProgressBar progressBar(endSimulationTime);
   progressBar.update(0.0);
   if (checkpointFile.empty()) {
@@ -362,13 +480,14 @@ int main(int argc, char** argv) {
     // Coarse output here
     if (coarse > 0) {
       // average the values in the arrays
-      Tools::Float2D<RealType> waterHeight(Tools::Coarse::coarseArray(waveBlock->getWaterHeight(), coarse, waveBlock->getNx(), waveBlock->getNy(), groupsX, restX, groupsY, restY));
-      Tools::Float2D<RealType> dischargeHu(Tools::Coarse::coarseArray(waveBlock->getDischargeHu(), coarse, waveBlock->getNx(), waveBlock->getNy(), groupsX, restX, groupsY, restY));
-      Tools::Float2D<RealType> dischargeHv(Tools::Coarse::coarseArray(waveBlock->getDischargeHv(), coarse, waveBlock->getNx(), waveBlock->getNy(), groupsX, restX, groupsY, restY));
-      writer.writeTimeStep(waterHeight, dischargeHu, dischargeHv, 0.0);
+      Tools::Coarse::coarseArray(waveBlock->getWaterHeight(), coarse, waveBlock->getNx(), waveBlock->getNy(), groupsX, restX, groupsY, restY, coarseWaterHeight);
+      Tools::Coarse::coarseArray(waveBlock->getDischargeHu(), coarse, waveBlock->getNx(), waveBlock->getNy(), groupsX, restX, groupsY, restY, coarseDischargeHu);
+      Tools::Coarse::coarseArray(waveBlock->getDischargeHv(), coarse, waveBlock->getNx(), waveBlock->getNy(), groupsX, restX, groupsY, restY, coarseDischargeHv);
+      writer.writeTimeStep(coarseWaterHeight, coarseDischargeHu, coarseDischargeHv, 0.0);
     } else {
       writer.writeTimeStep(waveBlock->getWaterHeight(), waveBlock->getDischargeHu(), waveBlock->getDischargeHv(), 0.0);
     }
+    writePatches(0.0);
   }
   double simulationTime = scenario->getStartTime();
   progressBar.update(simulationTime);
@@ -383,12 +502,31 @@ int main(int argc, char** argv) {
   Tools::Logger::logger.initWallClockTime(wallClockTime);
 
 
+  waveBlock->setParallelSearch(args.isSet("parallel-search"));
 #if defined(ENABLE_GUI)
   waveBlock->findSearchArea(gui);
 #else
   waveBlock->findSearchArea();
 #endif
 
+  if (executionMode == Blocks::ExecutionMode::Tiled || executionMode == Blocks::ExecutionMode::TaskGraph) {
+    const int tileColumns = args.getArgument<int>("tile-columns", 0);
+    const int tileRows    = args.getArgument<int>("tile-rows", 0);
+    if (tileColumns > 0 && tileRows > 0) {
+      waveBlock->setTileSize(tileColumns, tileRows);
+    } else {
+      waveBlock->autotuneTileSize();
+    }
+    Tools::Logger::logger.getDefaultOutputStream() << "Tile size: " << waveBlock->getTileColumns() << " x " << waveBlock->getTileRows() << std::endl;
+  } else if (executionMode == Blocks::ExecutionMode::LocalTimeStepping) {
+    // The tiles are the unit of the clustering, small square tiles follow the coast line more closely
+    const int tileColumns = args.getArgument<int>("tile-columns", 32);
+    const int tileRows    = args.getArgument<int>("tile-rows", 32);
+    waveBlock->setTileSize(tileColumns, tileRows);
+    waveBlock->setTimeStepLevels(args.getArgument<int>("local-time-stepping", 4));
+    Tools::Logger::logger.getDefaultOutputStream() << "Tile size: " << tileColumns << " x " << tileRows << ", time step levels: " << waveBlock->getTimeStepLevels() << std::endl;
+  }
+
   Tools::WarningSystem warningSystem{destinationX, destinationY};
   if (threshold == -1) {
     warningSystem.setThreshold(threshold);
@@ -400,6 +538,7 @@ int main(int argc, char** argv) {
     warningSystem.setThreshold(threshold);
     warningSystem.setOriginalLevel(waveBlock->getWaterHeight()[destinationX][destinationY]);
     warningSystem.setUsed(true);
+    warningSystem.setExpectedArrival(waveBlock->getDestinationArrivalTime());
   }
 
 
@@ -418,14 +557,12 @@ int main(int argc, char** argv) {
       double start_time = omp_get_wtime();
 #endif
 
-      // Set values in ghost cells
-      // waveBlock->setGhostLayer();
-      // Compute numerical flux on each edge
-      waveBlock->computeNumericalFluxes();
-      RealType maxTimeStepWidth = waveBlock->getMaxTimeStep();
-      // std::cout << "GetMaxTimestep called Value: " << maxTimeStepWidth << std::endl;
-      //  Update the cell values
-      waveBlock->updateUnknowns(maxTimeStepWidth);
+      // Set values in ghost cells, the refined and nested grids set the ghost layers of their blocks themselves
+      if (!adaptiveMesh && !nestedGrid) {
+        waveBlock->setGhostLayer();
+      }
+      // Compute numerical flux on each edge and update the cell values with the maximum time step, in one parallel region
+      RealType maxTimeStepWidth = adaptiveMesh ? adaptiveMesh->simulateTimeStep() : nestedGrid ? nestedGrid->simulateTimeStep() : waveBlock->simulateTimeStep();
 
 #if defined(ENABLE_OPENMP)
       double end_time = omp_get_wtime();
@@ -465,13 +602,14 @@ int main(int argc, char** argv) {
     // Coarse output
     if (coarse > 0) {
       // average the values in the arrays
-      Tools::Float2D<RealType> waterHeight(Tools::Coarse::coarseArray(waveBlock->getWaterHeight(), coarse, waveBlock->getNx(), waveBlock->getNy(), groupsX, restX, groupsY, restY));
-      Tools::Float2D<RealType> dischargeHu(Tools::Coarse::coarseArray(waveBlock->getDischargeHu(), coarse, waveBlock->getNx(), waveBlock->getNy(), groupsX, restX, groupsY, restY));
-      Tools::Float2D<RealType> dischargeHv(Tools::Coarse::coarseArray(waveBlock->getDischargeHv(), coarse, waveBlock->getNx(), waveBlock->getNy(), groupsX, restX, groupsY, restY));
-      writer.writeTimeStep(waterHeight, dischargeHu, dischargeHv, simulationTime);
+      Tools::Coarse::coarseArray(waveBlock->getWaterHeight(), coarse, waveBlock->getNx(), waveBlock->getNy(), groupsX, restX, groupsY, restY, coarseWaterHeight);
+      Tools::Coarse::coarseArray(waveBlock->getDischargeHu(), coarse, waveBlock->getNx(), waveBlock->getNy(), groupsX, restX, groupsY, restY, coarseDischargeHu);
+      Tools::Coarse::coarseArray(waveBlock->getDischargeHv(), coarse, waveBlock->getNx(), waveBlock->getNy(), groupsX, restX, groupsY, restY, coarseDischargeHv);
+      writer.writeTimeStep(coarseWaterHeight, coarseDischargeHu, coarseDischargeHv, simulationTime);
     } else {
       writer.writeTimeStep(waveBlock->getWaterHeight(), waveBlock->getDischargeHu(), waveBlock->getDischargeHv(), simulationTime);
     }
+    writePatches(simulationTime);
   }
 endSimulation:
   progressBar.clear();
@@ -481,11 +619,27 @@ endSimulation:
   Tools::Logger::logger.getDefaultOutputStream(
   ) << "Average time per Cell: "
     << Tools::Logger::logger.getTime("CPU") / (numberOfGridCellsX * numberOfGridCellsY) << " seconds" << std::endl;
+  Tools::Logger::logger.getDefaultOutputStream(
+  ) << "Average time per Cell update: "
+    << Tools::Logger::logger.getTime("CPU") / (static_cast<double>(numberOfGridCellsX) * numberOfGridCellsY * iterations) << " seconds" << std::endl;
   Tools::Logger::logger.getDefaultOutputStream() << "Average time per Iteration: " << Tools::Logger::logger.getTime("CPU") / iterations << " seconds" << std::endl;
   Tools::Logger::logger.printWallClockTime(wallClockTime);
 
 
   Tools::Logger::logger.printIterationsDone(iterations);
+  if (executionMode == Blocks::ExecutionMode::LocalTimeStepping && waveBlock->getLocalCellUpdates() > 0) {
+    Tools::Logger::logger.getDefaultOutputStream(
+    ) << "Cell updates: " << waveBlock->getLocalCellUpdates() << " instead of " << waveBlock->getGlobalCellUpdates() << " with global time stepping ("
+      << static_cast<double>(waveBlock->getGlobalCellUpdates()) / waveBlock->getLocalCellUpdates() << " times fewer)" << std::endl;
+  }
+  if (adaptiveMesh) {
+    Tools::Logger::logger.getDefaultOutputStream(
+    ) << "Cell updates: " << adaptiveMesh->getCellUpdates() << " instead of " << adaptiveMesh->getUniformCellUpdates()
+      << " on a uniform grid at the finest resolution, patches: " << adaptiveMesh->getPatches().size() << std::endl;
+  }
+  if (nestedGrid) {
+    Tools::Logger::logger.getDefaultOutputStream() << "Cell updates in the nested regions: " << nestedGrid->getFineCellUpdates() << std::endl;
+  }
   // print number of threads
 #ifdef ENABLE_OPENMP
   Tools::Logger::logger.getDefaultOutputStream() << "Number of threads: " << omp_get_max_threads() << std::endl;
@@ -498,3 +652,71 @@ endSimulation:
 
   return EXIT_SUCCESS;
 }
+
+
+int main(int argc, char** argv) {
+  Tools::Args args;
+  args.addOption("grid-size", 'x', "Number of cells in x and y direction");
+  args.addOption("output-basepath", 'o', "Output base file name");
+  args.addOption("number-of-checkpoints", 'n', "Number of checkpoints to write output files");
+  args.addOption("simulation-time", 't', "Simulation time in seconds");
+  args.addOption(
+    "boundary-conditions", 'y',
+    "Set Boundary Conditions represented by an 4 digit Integer of 1s, 2s and 3s. (1: Outflow, 2: Wall, 3: Periodic, only together with the opposite edge).\n First Digit: Left Boundary\n Second Digit: Right Boundary\n Third Digit: Bottom Boundary\n Fourth Digit: Top Boundary"
+  );
+  args.addOption("checkpoint-file", 'c', "Checkpoint file to read initial values from");
+  args.addOption("coarse", 'k', "Parameter for the coarse output, averaging the next <param> cells");
+  args.addOption("magnitude", 'm', "The moment-megnitude of the eartquake");
+  args.addOption("richter-scale", 'r', "The magnitude on the richter scale, this should not be used as it will be subject to many approximation errors");
+  args.addOption("destinationLongitude", 'a', "The longitude coordinate of the destination city");
+  args.addOption("destinationLatitude", 'b', " The latitude coordinate of the destination city");
+  args.addOption("epicenterLongitude", 'e', "The longitude coordinate of the epicenter");
+  args.addOption("epicenterLatitude", 'f', "The latitude coordinate of the epicenter");
+  args.addOption("limit", 'l', "The limit variable represents the critical water level change that, when surpassed, triggers a warning in the tsunami detection system");
+  args.addOption("scenarios", 's', "The user can use a pre-chosen scenario. The given scenarios have ids 1 to 3. These should be used with grid-sizes >= 1000.");
+  args.addOption("GUICoordinates", 'g', "The user can use the GUI to enter the coordinates of the epicenter and the destination city. 0: No, 1: Yes");
+  args.addOption("solver", 'v', "Riemann solver used in the sweeps: fwave (default) or rusanov (cheaper, more diffusive)");
+  args.addOption("fused", 'u', "Apply the net updates directly in the sweeps instead of storing them in arrays (saves about two thirds of the memory)", Tools::Args::Argument::No);
+  args.addOption("tiled", 'p', "Compute the net updates in cache-sized tiles and apply both sweeps in one pass", Tools::Args::Argument::No);
+  args.addOption("task-graph", 'd', "Like --tiled, but the tiles are OpenMP tasks that start as soon as their neighbours are done", Tools::Args::Argument::No);
+  args.addOption(
+    "local-time-stepping",
+    'L',
+    "Advance every tile with a power-of-two multiple of the global time step, using up to <param> levels (e.g. 4: up to 8 times larger steps)"
+  );
+  args.addOption(
+    "refinement-levels",
+    'R',
+    "Refine the wave front near the destination and along steep bathymetry with patches on up to <param> levels (1: no refinement)"
+  );
+  args.addOption("nesting-ratio", 'N', "Refine the nested regions by <param> in both directions (1: no nesting)");
+  args.addOption(
+    "nested-regions",
+    'G',
+    "Comma-separated regions firstX:firstY:lastX:lastY of grid cells for the nesting (default: 64 x 64 cells around the destination)"
+  );
+  args.addOption("parallel-search", 'S', "Find the search area with a parallel breadth-first search instead of A*", Tools::Args::Argument::No);
+  args.addOption("tile-columns", 'i', "Number of columns of a tile in tiled and task graph mode (default: autotune, 32 with local time stepping)");
+  args.addOption("tile-rows", 'j', "Number of rows of a tile in tiled and task graph mode (default: autotune, 32 with local time stepping)");
+  args.addOption("padded-arrays", 'q', "Pad the columns of the arrays to avoid cache-set conflicts between neighbouring columns", Tools::Args::Argument::No);
+  args.addOption("huge-pages", 'z', "Back the arrays with huge pages: none (default), transparent (madvise) or explicit (MAP_HUGETLB)");
+  args.addOption("active-tiles", 'w', "Only sweep tiles of <param> * <param> cells that the wave has reached (0: sweep all cells)");
+
+  Tools::Args::Result ret = args.parse(argc, argv);
+  if (ret == Tools::Args::Result::Help) {
+    return 0;
+  }
+  if (ret == Tools::Args::Result::Error) {
+    return 1;
+  }
+
+  const std::string solver = args.getArgument<std::string>("solver", "fwave");
+  if (solver == "fwave") {
+    return runSimulation<Solvers::FWaveKernel>(args);
+  }
+  if (solver == "rusanov") {
+    return runSimulation<Solvers::RusanovKernel>(args);
+  }
+  std::cout << "Unknown solver " << solver << "! Use fwave or rusanov." << std::endl;
+  return 1;
+}
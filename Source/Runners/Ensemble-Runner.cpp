@@ -0,0 +1,252 @@
+
+#include <fstream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Blocks/Ensemble.h"
+#include "Blocks/InterleavedEnsemble.h"
+#include "BoundaryEdge.hpp"
+#include "Scenarios/FileScenario.h"
+#include "Tools/Args.hpp"
+#include "Tools/Logger.hpp"
+#include "Tools/ProgressBar.hpp"
+#include "Writers/NetCDFWriter.hpp"
+#ifdef ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+
+/**
+ * @brief Maps a longitude (-180° to 180°) or a latitude (-90° to 90°) to a cell of the grid, like the dimensional splitting runner
+ *
+ * @param cells [in] The number of cells in that direction
+ * @param degrees [in] The entered coordinate
+ * @param range [in] 360 for a longitude, 180 for a latitude
+ * @return The cell
+ */
+RealType convertEnteredToMapped(int cells, RealType degrees, RealType range) { return cells / RealType(2.0) + cells / range * degrees; }
+
+//! Writes the current state of a member of independent blocks.
+template <class SolverPolicy>
+void writeMember(Writers::NetCDFWriter& writer, Blocks::Ensemble<SolverPolicy>& ensemble, int member, RealType time) {
+  auto& block = ensemble.getMember(member);
+  writer.writeTimeStep(block.getWaterHeight(), block.getDischargeHu(), block.getDischargeHv(), time);
+}
+
+//! Writes the current state of a member, copied out of the interleaved arrays.
+template <class SolverPolicy>
+void writeMember(Writers::NetCDFWriter& writer, Blocks::InterleavedEnsemble<SolverPolicy>& ensemble, int member, RealType time) {
+  writer.writeTimeStep(ensemble.getWaterHeight(member), ensemble.getDischargeHu(member), ensemble.getDischargeHv(member), time);
+}
+
+/**
+ * @brief Runs an ensemble of earthquakes around the entered epicenter, see Blocks::Ensemble and Blocks::InterleavedEnsemble
+ *
+ * @param args [in] The parsed command line arguments
+ * @return [out] The exit code of the runner
+ */
+template <class EnsembleType>
+int runEnsemble(Tools::Args& args) {
+  const int         numberOfGridCellsX  = args.getArgument<int>("grid-size", 100);
+  const int         numberOfGridCellsY  = numberOfGridCellsX;
+  const std::string baseName            = args.getArgument<std::string>("output-basepath", "SWE");
+  const int         numberOfCheckPoints = args.getArgument<int>("number-of-checkpoints", 20);
+  const double      endSimulationTime   = args.getArgument<double>("simulation-time", 1000);
+  const int         boundaryConditions  = args.getArgument<int>("boundary-conditions", 1111);
+  const RealType    magnitude           = args.getArgument<RealType>("magnitude", 9);
+  const RealType    epicenterLongitude  = args.getArgument<RealType>("epicenterLongitude", 0);
+  const RealType    epicenterLatitude   = args.getArgument<RealType>("epicenterLatitude", 0);
+  const RealType    destinationLong     = args.getArgument<RealType>("destinationLongitude", 0);
+  const RealType    destinationLat      = args.getArgument<RealType>("destinationLatitude", 0);
+  const RealType    threshold           = args.getArgument<RealType>("limit", 0.1);
+  const int         members             = args.getArgument<int>("members", 8);
+  const RealType    epicenterSpread     = args.getArgument<RealType>("epicenter-spread", 2);
+  const RealType    magnitudeSpread     = args.getArgument<RealType>("magnitude-spread", 0.2);
+  const unsigned    seed                = args.getArgument<unsigned>("seed", 1);
+
+  if (members < 1 || endSimulationTime < 0 || numberOfCheckPoints < 1) {
+    std::cout << "The ensemble needs at least one member, a positive simulation time and at least one checkpoint" << std::endl;
+    return 1;
+  }
+  if (magnitude - magnitudeSpread < 6.51) {
+    std::cout << "Magnitude too small, can't compute Tsunami wave" << std::endl;
+    return 5;
+  }
+  if (std::abs(destinationLat) > 90 || std::abs(epicenterLatitude) > 90 || std::abs(destinationLong) > 180 || std::abs(epicenterLongitude) > 180) {
+    std::cout << "Error, the latitude or longitude coordinates were false chosen";
+    return 5;
+  }
+  const RealType epicenterX   = convertEnteredToMapped(numberOfGridCellsX, epicenterLongitude, 360);
+  const RealType epicenterY   = convertEnteredToMapped(numberOfGridCellsY, epicenterLatitude, 180);
+  const int      destinationX = int(convertEnteredToMapped(numberOfGridCellsX, destinationLong, 360));
+  const int      destinationY = int(convertEnteredToMapped(numberOfGridCellsY, destinationLat, 180));
+
+  Tools::Logger::logger.printWelcomeMessage();
+  Tools::Logger::logger.printNumberOfCells(numberOfGridCellsX, numberOfGridCellsY);
+
+  Scenarios::FileScenario scenario("GEBCO_2023_sub_ice_topo.nc", numberOfGridCellsX, numberOfGridCellsY, 0, epicenterX, epicenterY, magnitude);
+  const int               left     = boundaryConditions / 1000;
+  const int               right    = (boundaryConditions / 100) % 10;
+  const int               bottom   = (boundaryConditions / 10) % 10;
+  const int               top      = boundaryConditions % 10;
+  const auto              isDigit  = [](int digit) { return digit >= 1 && digit <= 3; };
+  const bool              periodic = (left == 3) == (right == 3) && (bottom == 3) == (top == 3);
+  if (boundaryConditions >= 1111 && boundaryConditions <= 3333 && isDigit(left) && isDigit(right) && isDigit(bottom) && isDigit(top) && periodic) {
+    scenario.setBoundaryType(boundaryConditions);
+  } else {
+    std::cout << "Boundary conditions invalid!" << std::endl;
+    return 1;
+  }
+
+  const RealType cellSizeX = (scenario.getBoundaryPos(BoundaryEdge::Right) - scenario.getBoundaryPos(BoundaryEdge::Left)) / numberOfGridCellsX;
+  const RealType cellSizeY = (scenario.getBoundaryPos(BoundaryEdge::Top) - scenario.getBoundaryPos(BoundaryEdge::Bottom)) / numberOfGridCellsY;
+
+  // Reads the bathymetry once, every member has only h, hu and hv of its own
+  Tools::Logger::logger.printString("Init Ensemble");
+  EnsembleType ensemble(numberOfGridCellsX, numberOfGridCellsY, cellSizeX, cellSizeY, 0, 0, scenario, members);
+  ensemble.setDestination({destinationX, destinationY});
+  // The interleaved members are advanced together by all threads
+  int teams = 1;
+  if constexpr (requires { ensemble.setTeams(1); }) {
+    if (args.isSet("teams")) {
+      ensemble.setTeams(args.getArgument<int>("teams", 1));
+    }
+    teams = ensemble.getTeams();
+  }
+
+  // The first member is the entered earthquake, the others are perturbed around it
+  std::mt19937                             generator(seed);
+  std::uniform_real_distribution<RealType> epicenterOffset(-epicenterSpread, epicenterSpread);
+  std::uniform_real_distribution<RealType> magnitudeOffset(-magnitudeSpread, magnitudeSpread);
+  std::ofstream                            parameters(baseName + "_members.csv");
+  parameters << "member,epicenterX,epicenterY,magnitude" << std::endl;
+  for (int member = 0; member < members; member++) {
+    const RealType x = member == 0 ? epicenterX : epicenterX + epicenterOffset(generator);
+    const RealType y = member == 0 ? epicenterY : epicenterY + epicenterOffset(generator);
+    const RealType m = member == 0 ? magnitude : magnitude + magnitudeOffset(generator);
+    scenario.setEpicenter(x, y);
+    scenario.setMagnitude(m);
+    ensemble.initialiseMember(member, [&](RealType cellX, RealType cellY) { return scenario.getDisplacement(cellX, cellY); });
+    parameters << member << "," << x << "," << y << "," << m << std::endl;
+  }
+  Tools::Logger::logger.printString("Init finished");
+  Tools::Logger::logger.getDefaultOutputStream() << "Members: " << members << ", teams: " << teams << std::endl;
+
+  // One file per member, all with the shared bathymetry
+  Writers::BoundarySize                               boundarySize = {{1, 1, 1, 1}};
+  std::vector<std::unique_ptr<Writers::NetCDFWriter>> writers;
+  for (int member = 0; member < members; member++) {
+    writers.push_back(std::make_unique<Writers::NetCDFWriter>(
+      baseName + "_member" + std::to_string(member),
+      ensemble.getBathymetry(),
+      boundarySize,
+      boundaryConditions,
+      numberOfGridCellsX,
+      numberOfGridCellsY,
+      cellSizeX,
+      cellSizeY,
+      scenario.getBoundaryPos(BoundaryEdge::Left),
+      scenario.getBoundaryPos(BoundaryEdge::Bottom),
+      1
+    ));
+    writeMember(*writers.back(), ensemble, member, 0.0);
+  }
+
+  std::ofstream statistics(baseName + "_statistics.csv");
+  statistics << "time,mean,max,exceedance" << std::endl;
+
+  Tools::ProgressBar progressBar(endSimulationTime);
+  progressBar.update(0.0);
+  Tools::Logger::logger.printStartMessage();
+  double wallClockTime = 1;
+  Tools::Logger::logger.initWallClockTime(wallClockTime);
+
+  for (int cp = 1; cp <= numberOfCheckPoints; cp++) {
+    const RealType checkPoint = RealType(cp * (endSimulationTime / numberOfCheckPoints));
+    Tools::Logger::logger.resetClockToCurrentTime("CPU");
+#if defined(ENABLE_OPENMP)
+    double start_time = omp_get_wtime();
+#endif
+
+    ensemble.simulateUntil(checkPoint);
+
+#if defined(ENABLE_OPENMP)
+    wallClockTime += omp_get_wtime() - start_time;
+#endif
+    Tools::Logger::logger.updateTime("CPU");
+
+    progressBar.clear();
+    Tools::Logger::logger.printOutputTime(checkPoint);
+    progressBar.update(checkPoint);
+    for (int member = 0; member < members; member++) {
+      writeMember(*writers[member], ensemble, member, checkPoint);
+    }
+    const auto current = ensemble.getStatistics(threshold);
+    statistics << checkPoint << "," << current.mean << "," << current.max << "," << current.exceedance << std::endl;
+  }
+
+  progressBar.clear();
+  const auto result = ensemble.getStatistics(threshold);
+  Tools::Logger::logger.printStatisticsMessage();
+  Tools::Logger::logger.getDefaultOutputStream(
+  ) << "Highest elevation at the destination: mean " << result.mean << " m, max " << result.max << " m, " << result.exceedance * 100
+    << "% of the members exceed " << threshold << " m" << std::endl;
+  Tools::Logger::logger.printTime("CPU", "CPU Time");
+  Tools::Logger::logger.getDefaultOutputStream(
+  ) << "Average time per Cell update: "
+    << Tools::Logger::logger.getTime("CPU") / static_cast<double>(std::max(ensemble.getCellUpdates(), std::uint64_t(1))) << " seconds" << std::endl;
+  Tools::Logger::logger.printWallClockTime(wallClockTime);
+#ifdef ENABLE_OPENMP
+  Tools::Logger::logger.getDefaultOutputStream() << "Number of threads: " << omp_get_max_threads() << std::endl;
+#endif
+  Tools::Logger::logger.printFinishMessage();
+
+  return EXIT_SUCCESS;
+}
+
+
+int main(int argc, char** argv) {
+  Tools::Args args;
+  args.addOption("grid-size", 'x', "Number of cells in x and y direction");
+  args.addOption("output-basepath", 'o', "Output base file name, every member writes <param>_member<k>");
+  args.addOption("number-of-checkpoints", 'n', "Number of checkpoints to write output files");
+  args.addOption("simulation-time", 't', "Simulation time in seconds");
+  args.addOption(
+    "boundary-conditions", 'y',
+    "Set Boundary Conditions represented by an 4 digit Integer of 1s, 2s and 3s. (1: Outflow, 2: Wall, 3: Periodic, only together with the opposite edge).\n First Digit: Left Boundary\n Second Digit: Right Boundary\n Third Digit: Bottom Boundary\n Fourth Digit: Top Boundary"
+  );
+  args.addOption("magnitude", 'm', "The moment-megnitude of the eartquake");
+  args.addOption("destinationLongitude", 'a', "The longitude coordinate of the destination city");
+  args.addOption("destinationLatitude", 'b', " The latitude coordinate of the destination city");
+  args.addOption("epicenterLongitude", 'e', "The longitude coordinate of the epicenter");
+  args.addOption("epicenterLatitude", 'f', "The latitude coordinate of the epicenter");
+  args.addOption("limit", 'l', "The water level at the destination whose exceedance probability is reported");
+  args.addOption("solver", 'v', "Riemann solver used in the sweeps: fwave (default) or rusanov (cheaper, more diffusive)");
+  args.addOption("members", 'M', "Number of members of the ensemble (default: 8)");
+  args.addOption("epicenter-spread", 'E', "The epicenters of the members are up to <param> cells away from the entered one (default: 2)");
+  args.addOption("magnitude-spread", 'D', "The magnitudes of the members differ by up to <param> from the entered one (default: 0.2)");
+  args.addOption("seed", 's', "Seed of the perturbations (default: 1)");
+  args.addOption("teams", 'T', "Number of thread teams that advance members at the same time (default: one member per thread)");
+  args.addOption("interleaved", 'I', "Interleave the members in the innermost dimension and vectorise across them (ignores --teams)", Tools::Args::Argument::No);
+
+  Tools::Args::Result ret = args.parse(argc, argv);
+  if (ret == Tools::Args::Result::Help) {
+    return 0;
+  }
+  if (ret == Tools::Args::Result::Error) {
+    return 1;
+  }
+
+  const std::string solver      = args.getArgument<std::string>("solver", "fwave");
+  const bool        interleaved = args.isSet("interleaved");
+  if (solver == "fwave") {
+    return interleaved ? runEnsemble<Blocks::InterleavedEnsemble<Solvers::FWaveKernel>>(args) : runEnsemble<Blocks::Ensemble<Solvers::FWaveKernel>>(args);
+  }
+  if (solver == "rusanov") {
+    return interleaved ? runEnsemble<Blocks::InterleavedEnsemble<Solvers::RusanovKernel>>(args) : runEnsemble<Blocks::Ensemble<Solvers::RusanovKernel>>(args);
+  }
+  std::cout << "Unknown solver " << solver << "! Use fwave or rusanov." << std::endl;
+  return 1;
+}
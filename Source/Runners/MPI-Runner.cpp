@@ -28,15 +28,20 @@
  * Setting of SWE, which uses a wave propagation solver and an artificial or ASAGI scenario on multiple blocks.
  */
 
+#include <algorithm>
 #include <cmath>
 #include <csignal>
 #include <fenv.h>
+#include <memory>
 #include <mpi.h>
 
 #include "Blocks/Block.hpp"
 #include "Blocks/DimensionalSplitting.h"
+#include "Blocks/HaloExchange.h"
 #include "Blocks/WavePropagationBlock.hpp"
 #include "Scenarios/BathymetryDamBreakScenario.hpp"
+#include "Scenarios/CheckpointScenario.h"
+#include "Scenarios/FileScenario.h"
 #include "Scenarios/RadialDamBreakScenario.hpp"
 #include "Scenarios/SeaAtRestScenario.hpp"
 #include "Scenarios/SplashingConeScenario.hpp"
@@ -66,25 +71,25 @@ void fpExceptionHandler(const int signal, const int nSubCode);
  * @param numberOfProcesses number of processes
  * @return number of block rows
  */
-int  computeNumberOfBlockRows(int numberOfProcesses);
-void exchangeLeftRightGhostLayers(
-  const int              leftNeighborRank,
-  Blocks::Block1D*       o_leftInflow,
-  const Blocks::Block1D* leftOutflow,
-  const int              rightNeighborRank,
-  Blocks::Block1D*       o_rightInflow,
-  const Blocks::Block1D* rightOutflow,
-  MPI_Datatype           mpiCol
-);
-void exchangeBottomTopGhostLayers(
-  const int              bottomNeighborRank,
-  Blocks::Block1D*       o_bottomNeighborInflow,
-  const Blocks::Block1D* bottomNeighborOutflow,
-  const int              topNeighborRank,
-  Blocks::Block1D*       o_topNeighborInflow,
-  const Blocks::Block1D* topNeighborOutflow,
-  MPI_Datatype           mpiRow
-);
+int computeNumberOfBlockRows(int numberOfProcesses);
+
+/**
+ * Converts a magnitude on the richter scale to the moment magnitude, like the dimensional splitting runner.
+ */
+RealType richterToMagnitude(RealType richter) { return (11.8 + 1.5 * richter - 5.24) / 1.44; }
+
+/**
+ * Maps a longitude (-180° to 180°) or a latitude (-90° to 90°) to a cell of the grid, like the dimensional splitting
+ * runner.
+ *
+ * @param cells number of cells in that direction
+ * @param degrees entered coordinate
+ * @param range 360 for a longitude, 180 for a latitude
+ * @return the cell
+ */
+RealType convertEnteredToMapped(int cells, RealType degrees, RealType range) {
+  return cells / RealType(2.0) + cells / range * degrees;
+}
 
 int main(int argc, char** argv) {
   //! MPI Rank of a process.
@@ -124,6 +129,27 @@ int main(int argc, char** argv) {
   args.addOption("grid-size-y", 'y', "Number of cells in y direction");
   args.addOption("output-basepath", 'o', "Output base file name");
   args.addOption("number-of-checkpoints", 'n', "Number of checkpoints to write output files");
+  args.addOption(
+    "blocking-exchange", 'b', "Exchange the ghost layers before computing any flux instead of overlapping the exchange with the interior", Tools::Args::Argument::No
+  );
+  args.addOption(
+    "time-step-reduction", 'r', "Reduction of the global time step: blocking (default), or predictive, which updates with the last global time step times the safety factor while the reduction checks it"
+  );
+  args.addOption("safety-factor", 'f', "Factor on the last global time step that the predictive reduction uses (default 0.9)");
+  args.addOption("simulation-time", 't', "Simulation time in seconds (default: 30 for the radial dam break, 1000 otherwise)");
+  args.addOption(
+    "boundary-conditions",
+    'B',
+    "Boundary conditions at the edges of the domain as 4 digits of 1 (outflow) and 2 (wall) for left, right, bottom and top (default 1111)"
+  );
+  args.addOption("checkpoint-file", 'c', "Checkpoint file to read initial values from");
+  args.addOption("magnitude", 'm', "The moment-magnitude of an earthquake on the GEBCO bathymetry, instead of the radial dam break");
+  args.addOption("richter-scale", 'R', "The magnitude of the earthquake on the richter scale, instead of --magnitude");
+  args.addOption("epicenterLongitude", 'e', "The longitude coordinate of the epicenter");
+  args.addOption("epicenterLatitude", 'a', "The latitude coordinate of the epicenter");
+  args.addOption(
+    "halo-width", 'k', "Width of the halo, which lasts several time steps (default 1, a width > 1 implies --blocking-exchange)"
+  );
 
   Tools::Args::Result ret = args.parse(argc, argv, mpiRank == 0);
 
@@ -144,6 +170,17 @@ int main(int argc, char** argv) {
   int         numberOfCheckPoints = args.getArgument<int>(
     "number-of-checkpoints", 20
   ); //! Number of checkpoints for visualization (at each checkpoint in time, an output file is written).
+  std::string timeStepReduction   = args.getArgument<std::string>("time-step-reduction", "blocking");
+  RealType    safetyFactor        = args.getArgument<RealType>("safety-factor", RealType(0.9));
+  int         haloWidth           = args.getArgument<int>("halo-width", 1);
+  bool        blockingExchange    = args.isSet("blocking-exchange") || haloWidth > 1;
+  int         boundaryConditions  = args.getArgument<int>("boundary-conditions", 1111);
+  std::string checkpointFile      = args.getArgument<std::string>("checkpoint-file", "");
+  bool        useFileScenario     = checkpointFile.empty() && (args.isSet("magnitude") || args.isSet("richter-scale"));
+  RealType    magnitude           = args.isSet("richter-scale") ? richterToMagnitude(args.getArgument<RealType>("richter-scale", 0))
+                                                                : args.getArgument<RealType>("magnitude", 0);
+  RealType    epicenterLongitude  = args.getArgument<RealType>("epicenterLongitude", 0);
+  RealType    epicenterLatitude   = args.getArgument<RealType>("epicenterLatitude", 0);
 
   // Print information about the grid
   Tools::Logger::logger.printNumberOfCells(numberOfGridCellsX, numberOfGridCellsY);
@@ -170,27 +207,117 @@ int main(int argc, char** argv) {
 
   Tools::Logger::logger.printNumberOfCellsPerProcess(nXLocal, nYLocal);
 
-  // Create a simple artificial scenario
-  Scenarios::RadialDamBreakScenario scenario;
+  if (timeStepReduction != "blocking" && timeStepReduction != "predictive") {
+    Tools::Logger::logger.printString("Unknown time step reduction " + timeStepReduction + "! Use blocking or predictive.");
+    MPI_Abort(MPI_COMM_WORLD, -1);
+    return EXIT_FAILURE;
+  }
+  if (safetyFactor <= 0 || safetyFactor > 1) {
+    Tools::Logger::logger.printString("The safety factor has to be in (0, 1].");
+    MPI_Abort(MPI_COMM_WORLD, -1);
+    return EXIT_FAILURE;
+  }
+  if (haloWidth < 1 || haloWidth > std::min(nXLocal, nYLocal)) {
+    Tools::Logger::logger.printString("The halo width has to be between 1 and the number of cells per process.");
+    MPI_Abort(MPI_COMM_WORLD, -1);
+    return EXIT_FAILURE;
+  }
+  if (useFileScenario && magnitude < 6.51) {
+    Tools::Logger::logger.printString("Magnitude too small, can't compute Tsunami wave");
+    MPI_Abort(MPI_COMM_WORLD, -1);
+    return EXIT_FAILURE;
+  }
+  if (std::abs(epicenterLongitude) > 180 || std::abs(epicenterLatitude) > 90) {
+    Tools::Logger::logger.printString("Error, the latitude or longitude coordinates were false chosen");
+    MPI_Abort(MPI_COMM_WORLD, -1);
+    return EXIT_FAILURE;
+  }
+
+  // Every digit is 1 or 2, periodic boundaries would connect ranks that the halo exchange does not connect
+  const int  left    = boundaryConditions / 1000;
+  const int  right   = (boundaryConditions / 100) % 10;
+  const int  bottom  = (boundaryConditions / 10) % 10;
+  const int  top     = boundaryConditions % 10;
+  const auto isDigit = [](int digit) { return digit == 1 || digit == 2; };
+  if (boundaryConditions < 1111 || boundaryConditions > 2222 || !isDigit(left) || !isDigit(right) || !isDigit(bottom) || !isDigit(top)) {
+    Tools::Logger::logger.printString("Boundary conditions invalid! Use 1 (outflow) or 2 (wall) for every edge.");
+    MPI_Abort(MPI_COMM_WORLD, -1);
+    return EXIT_FAILURE;
+  }
+
+  // Compute MPI ranks of the neighbour processes
+  int leftNeighborRank   = (blockPositionX > 0) ? mpiRank - numberOfBlocksY : MPI_PROC_NULL;
+  int rightNeighborRank  = (blockPositionX < numberOfBlocksX - 1) ? mpiRank + numberOfBlocksY : MPI_PROC_NULL;
+  int bottomNeighborRank = (blockPositionY > 0) ? mpiRank - 1 : MPI_PROC_NULL;
+  int topNeighborRank    = (blockPositionY < numberOfBlocksY - 1) ? mpiRank + 1 : MPI_PROC_NULL;
+  const int neighbours[4] = {leftNeighborRank, rightNeighborRank, bottomNeighborRank, topNeighborRank};
+
+  // A wider halo extends the block by the cells that overlap with a neighbour
+  Writers::BoundarySize boundarySize = {{1, 1, 1, 1}};
+  for (int edge = 0; edge < 4; edge++) {
+    if (neighbours[edge] != MPI_PROC_NULL) {
+      boundarySize[edge] += haloWidth - 1;
+    }
+  }
+
+  // Create an earthquake on the GEBCO bathymetry, restart from a checkpoint, or a simple artificial scenario
+  std::unique_ptr<Scenarios::Scenario> scenario;
+  Scenarios::FileScenario*             fileScenario = nullptr;
+  if (!checkpointFile.empty()) {
+    scenario = std::make_unique<Scenarios::CheckpointScenario>(checkpointFile);
+  } else if (useFileScenario) {
+    const RealType epicenterX = convertEnteredToMapped(numberOfGridCellsX, epicenterLongitude, 360);
+    const RealType epicenterY = convertEnteredToMapped(numberOfGridCellsY, epicenterLatitude, 180);
+    auto           file       = std::make_unique<Scenarios::FileScenario>(
+      "GEBCO_2023_sub_ice_topo.nc", numberOfGridCellsX, numberOfGridCellsY, 0, epicenterX, epicenterY, magnitude
+    );
+    fileScenario = file.get();
+    scenario     = std::move(file);
+  } else {
+    scenario = std::make_unique<Scenarios::RadialDamBreakScenario>();
+  }
+  if (checkpointFile.empty()) {
+    scenario->setBoundaryType(boundaryConditions);
+  }
+  // The boundaries of a checkpoint can be periodic
+  for (const BoundaryEdge edge : {BoundaryEdge::Left, BoundaryEdge::Right, BoundaryEdge::Bottom, BoundaryEdge::Top}) {
+    if (scenario->getBoundaryType(edge) == BoundaryType::Periodic) {
+      Tools::Logger::logger.printString("Periodic boundaries are not supported with multiple processes.");
+      MPI_Abort(MPI_COMM_WORLD, -1);
+      return EXIT_FAILURE;
+    }
+  }
 
   // Compute the size of a single cell
-  RealType cellSizeX = (scenario.getBoundaryPos(BoundaryEdge::Right) - scenario.getBoundaryPos(BoundaryEdge::Left))
+  RealType cellSizeX = (scenario->getBoundaryPos(BoundaryEdge::Right) - scenario->getBoundaryPos(BoundaryEdge::Left))
                        / numberOfGridCellsX;
-  RealType cellSizeY = (scenario.getBoundaryPos(BoundaryEdge::Top) - scenario.getBoundaryPos(BoundaryEdge::Bottom))
+  RealType cellSizeY = (scenario->getBoundaryPos(BoundaryEdge::Top) - scenario->getBoundaryPos(BoundaryEdge::Bottom))
                        / numberOfGridCellsY;
   Tools::Logger::logger.printCellSize(cellSizeX, cellSizeY);
 
-  auto waveBlock = Blocks::Block::getBlockInstance(nXLocal, nYLocal, cellSizeX, cellSizeY);
+  auto waveBlock = Blocks::Block::getBlockInstance(
+    nXLocal + boundarySize[0] + boundarySize[1] - 2, nYLocal + boundarySize[2] + boundarySize[3] - 2, cellSizeX, cellSizeY
+  );
 
   // Get the origin from the scenario
-  RealType originX = scenario.getBoundaryPos(BoundaryEdge::Left) + blockPositionX * nXNormal * cellSizeX;
-  RealType originY = scenario.getBoundaryPos(BoundaryEdge::Bottom) + blockPositionY * nYNormal * cellSizeY;
+  RealType originX = scenario->getBoundaryPos(BoundaryEdge::Left) + blockPositionX * nXNormal * cellSizeX;
+  RealType originY = scenario->getBoundaryPos(BoundaryEdge::Bottom) + blockPositionY * nYNormal * cellSizeY;
+  RealType offsetX = originX - (boundarySize[0] - 1) * cellSizeX;
+  RealType offsetY = originY - (boundarySize[2] - 1) * cellSizeY;
+
+  // Every rank reads only the part of the bathymetry file its block samples
+  if (fileScenario != nullptr) {
+    Tools::Logger::logger.printString("Reading the bathymetry of the block.");
+    fileScenario->readRegion(offsetX, offsetY, waveBlock->getNx(), waveBlock->getNy(), cellSizeX, cellSizeY);
+  }
 
-  // Initialise the wave propagation block
-  waveBlock->initialiseScenario(originX, originY, scenario, true);
+  // Initialise the wave propagation block, including the overlap
+  waveBlock->initialiseScenario(offsetX, offsetY, *scenario, true);
 
-  // Get the final simulation time from the scenario
-  double endSimulationTime = scenario.getEndSimulationTime();
+  // Get the final simulation time from the scenario, the file scenarios run 1000 s like the dimensional splitting runner
+  double endSimulationTime = args.getArgument<double>(
+    "simulation-time", checkpointFile.empty() && !useFileScenario ? scenario->getEndSimulationTime() : 1000
+  );
 
   // Checkpoints when output files are written
   double* checkPoints = new double[numberOfCheckPoints + 1];
@@ -203,84 +330,14 @@ int main(int argc, char** argv) {
   /*
    * Connect blocks at boundaries
    */
-  // Left and right boundaries
-  Tools::Logger::logger.printString("Connecting SWE blocks at left boundaries.");
-  Blocks::Block1D* leftInflow  = waveBlock->grabGhostLayer(BoundaryEdge::Left);
-  Blocks::Block1D* leftOutflow = waveBlock->registerCopyLayer(BoundaryEdge::Left);
-  if (blockPositionX == 0) {
-    waveBlock->setBoundaryType(BoundaryEdge::Left, BoundaryType::Outflow);
-  }
-
-  Tools::Logger::logger.printString("Connecting SWE blocks at right boundaries.");
-  Blocks::Block1D* rightInflow  = waveBlock->grabGhostLayer(BoundaryEdge::Right);
-  Blocks::Block1D* rightOutflow = waveBlock->registerCopyLayer(BoundaryEdge::Right);
-  if (blockPositionX == numberOfBlocksX - 1) {
-    waveBlock->setBoundaryType(BoundaryEdge::Right, BoundaryType::Outflow);
-  }
-
-  // Bottom and top boundaries
-  Tools::Logger::logger.printString("Connecting SWE blocks at bottom boundaries.");
-  Blocks::Block1D* bottomInflow  = waveBlock->grabGhostLayer(BoundaryEdge::Bottom);
-  Blocks::Block1D* bottomOutflow = waveBlock->registerCopyLayer(BoundaryEdge::Bottom);
-  if (blockPositionY == 0) {
-    waveBlock->setBoundaryType(BoundaryEdge::Bottom, BoundaryType::Outflow);
-  }
-
-  Tools::Logger::logger.printString("Connecting SWE blocks at top boundaries.");
-  Blocks::Block1D* topInflow  = waveBlock->grabGhostLayer(BoundaryEdge::Top);
-  Blocks::Block1D* topOutflow = waveBlock->registerCopyLayer(BoundaryEdge::Top);
-  if (blockPositionY == numberOfBlocksY - 1) {
-    waveBlock->setBoundaryType(BoundaryEdge::Top, BoundaryType::Outflow);
+  Tools::Logger::logger.printString("Connecting SWE blocks at the boundaries.");
+  for (const BoundaryEdge edge : {BoundaryEdge::Left, BoundaryEdge::Right, BoundaryEdge::Bottom, BoundaryEdge::Top}) {
+    if (neighbours[edge] == MPI_PROC_NULL) {
+      waveBlock->setBoundaryType(edge, scenario->getBoundaryType(edge));
+    }
   }
-
-  /*
-   * The grid is stored column wise in memory:
-   *
-   *        ************************** . . . **********
-   *        *       *  ny+2 *2(ny+2)*         * (ny+1)*
-   *        *  ny+1 * +ny+1 * +ny+1 *         * (ny+2)*
-   *        *       *       *       *         * +ny+1 *
-   *        ************************** . . . **********
-   *        *       *       *       *         *       *
-   *        .       .       .       .         .       .
-   *        .       .       .       .         .       .
-   *        .       .       .       .         .       .
-   *        *       *       *       *         *       *
-   *        ************************** . . . **********
-   *        *       *  ny+2 *2(ny+2)*         * (ny+1)*
-   *        *   1   *   +1  *   +1  *         * (ny+2)*
-   *        *       *       *       *         *   +1  *
-   *        ************************** . . . **********
-   *        *       *  ny+2 *2(ny+2)*         * (ny+1)*
-   *        *   0   *   +0  *   +0  *         * (ny+2)*
-   *        *       *       *       *         *   +0  *
-   *        ************************** . . . ***********
-   *
-   *  -> The stride for a row is ny+2, because we have to jump over a whole column
-   *     for every row-element. This holds only in the CPU-version, in CUDA a buffer is implemented.
-   *     See Blocks/CUDA/CUDABlock.hpp/.cu for details.
-   *  -> The stride for a column is 1, because we can access the elements linear in memory.
-   */
-
-  //! MPI row-vector: nXLocal+2 blocks, 1 element per block, stride of nYLocal+2
-  MPI_Datatype mpiRow;
-#ifndef ENABLE_CUDA
-  MPI_Type_vector(nXLocal + 2, 1, nYLocal + 2, MY_MPI_FLOAT, &mpiRow);
-#else
-  MPI_Type_vector(1, nXLocal + 2, 1, MY_MPI_FLOAT, &mpiRow);
-#endif
-  MPI_Type_commit(&mpiRow);
-
-  //! MPI column-vector: 1 block, nYLocal+2 elements per block, stride of 1
-  MPI_Datatype mpiCol;
-  MPI_Type_vector(1, nYLocal + 2, 1, MY_MPI_FLOAT, &mpiCol);
-  MPI_Type_commit(&mpiCol);
-
-  // Compute MPI ranks of the neighbour processes
-  int leftNeighborRank   = (blockPositionX > 0) ? mpiRank - numberOfBlocksY : MPI_PROC_NULL;
-  int rightNeighborRank  = (blockPositionX < numberOfBlocksX - 1) ? mpiRank + numberOfBlocksY : MPI_PROC_NULL;
-  int bottomNeighborRank = (blockPositionY > 0) ? mpiRank - 1 : MPI_PROC_NULL;
-  int topNeighborRank    = (blockPositionY < numberOfBlocksY - 1) ? mpiRank + 1 : MPI_PROC_NULL;
+  auto      haloExchange     = std::make_unique<Blocks::HaloExchange>(*waveBlock, neighbours, haloWidth);
+  const int exchangeInterval = waveBlock->getHaloTimeSteps(haloWidth);
 
   // Print the MPI grid
   Tools::Logger::logger.getDefaultOutputStream()
@@ -288,21 +345,19 @@ int main(int argc, char** argv) {
     << " (bottom), " << topNeighborRank << " (top)" << std::endl;
 
   // Intially exchange ghost and copy layers
-  exchangeLeftRightGhostLayers(
-    leftNeighborRank, leftInflow, leftOutflow, rightNeighborRank, rightInflow, rightOutflow, mpiCol
-  );
-
-  exchangeBottomTopGhostLayers(
-    bottomNeighborRank, bottomInflow, bottomOutflow, topNeighborRank, topInflow, topOutflow, mpiRow
-  );
+  haloExchange->exchange();
 
   Tools::ProgressBar progressBar(endSimulationTime, mpiRank);
 
-  Tools::Logger::logger.printOutputTime(0.0);
-  progressBar.update(0.0);
+  // A checkpoint continues at its time, the checkpoints before are skipped
+  double simulationTime  = scenario->getStartTime();
+  int    firstCheckPoint = 1;
+  while (firstCheckPoint < numberOfCheckPoints && checkPoints[firstCheckPoint] <= simulationTime) {
+    firstCheckPoint++;
+  }
 
-  // Boundary size of the ghost layers
-  Writers::BoundarySize boundarySize = {{1, 1, 1, 1}};
+  Tools::Logger::logger.printOutputTime(simulationTime);
+  progressBar.update(simulationTime);
 
   std::string fileName = Writers::generateBaseFileName(baseName, blockPositionX, blockPositionY);
   auto        writer   = Writers::Writer::createWriterInstance(
@@ -321,42 +376,59 @@ int main(int argc, char** argv) {
   );
 
   // Write zero time step
-  writer->writeTimeStep(waveBlock->getWaterHeight(), waveBlock->getDischargeHu(), waveBlock->getDischargeHv(), 0.0);
+  writer->writeTimeStep(
+    waveBlock->getWaterHeight(), waveBlock->getDischargeHu(), waveBlock->getDischargeHv(), simulationTime
+  );
 
   // Print the start message and reset the wall clock time
   progressBar.clear();
   Tools::Logger::logger.printStartMessage();
   Tools::Logger::logger.initWallClockTime(time(NULL)); // MPI_Wtime()
 
-  double simulationTime = 0.0;
   progressBar.update(simulationTime);
 
   unsigned int iterations = 0;
 
+  // The predictive reduction updates with the last global time step times the safety factor, 0 before the first one
+  RealType     predictedTimeStepWidth = RealType(0.0);
+  unsigned int blockingReductions     = 0;
+  unsigned int hiddenReductions       = 0;
+  unsigned int repeatedTimeSteps      = 0;
+
   // Loop over checkpoints
-  for (int cp = 1; cp <= numberOfCheckPoints; cp++) {
+  for (int cp = firstCheckPoint; cp <= numberOfCheckPoints; cp++) {
     // Do time steps until next checkpoint is reached
     while (simulationTime < checkPoints[cp]) {
       // Reset CPU-Communication clock
       Tools::Logger::logger.resetClockToCurrentTime("CPU-Communication");
 
-      // Exchange ghost and copy layers
-      exchangeLeftRightGhostLayers(
-        leftNeighborRank, leftInflow, leftOutflow, rightNeighborRank, rightInflow, rightOutflow, mpiCol
-      );
+      if (blockingExchange) {
+        // Exchange ghost and copy layers, a wider halo lasts for several time steps
+        if (iterations % exchangeInterval == 0) {
+          haloExchange->exchange();
+        }
 
-      exchangeBottomTopGhostLayers(
-        bottomNeighborRank, bottomInflow, bottomOutflow, topNeighborRank, topInflow, topOutflow, mpiRow
-      );
+        // Reset the cpu clock
+        Tools::Logger::logger.resetClockToCurrentTime("CPU");
+
+        // Set values in ghost cells
+        waveBlock->setGhostLayer();
 
-      // Reset the cpu clock
-      Tools::Logger::logger.resetClockToCurrentTime("CPU");
+        // Compute numerical flux on each edge
+        waveBlock->computeNumericalFluxes();
+      } else {
+        // The CPU time includes the time the messages are not hidden behind the interior
+        Tools::Logger::logger.resetClockToCurrentTime("CPU");
 
-      // Set values in ghost cells
-      waveBlock->setGhostLayer();
+        // Compute the edges that do not need the ghost cells while the ghost and copy layers are exchanged
+        haloExchange->start();
+        waveBlock->computeNumericalFluxesInterior();
+        haloExchange->wait();
 
-      // Compute numerical flux on each edge
-      waveBlock->computeNumericalFluxes();
+        // Set values in ghost cells and compute the edges to the ghost layer
+        waveBlock->setGhostLayer();
+        waveBlock->computeNumericalFluxesBoundary();
+      }
 
       // Approximate the maximum time step
       // waveBlock->computeMaxTimeStep();
@@ -366,11 +438,39 @@ int main(int argc, char** argv) {
       //! Maximum allowed time steps of all blocks
       RealType maxTimeStepWidthGlobal = RealType(0.0);
 
-      // Determine smallest time step of all blocks
-      MPI_Allreduce(&maxTimeStepWidth, &maxTimeStepWidthGlobal, 1, MY_MPI_FLOAT, MPI_MIN, MPI_COMM_WORLD);
-
-      // Update the cell values
-      waveBlock->updateUnknowns(maxTimeStepWidthGlobal);
+      //! Time step width the cell values are updated with
+      RealType timeStepWidth = RealType(0.0);
+
+      if (timeStepReduction == "predictive" && predictedTimeStepWidth > 0) {
+        // Update with the predicted time step while the reduction checks it
+        MPI_Request request;
+        MPI_Iallreduce(&maxTimeStepWidth, &maxTimeStepWidthGlobal, 1, MY_MPI_FLOAT, MPI_MIN, MPI_COMM_WORLD, &request);
+        waveBlock->saveUnknowns();
+        waveBlock->updateUnknowns(predictedTimeStepWidth);
+        MPI_Wait(&request, MPI_STATUS_IGNORE);
+
+        if (predictedTimeStepWidth <= maxTimeStepWidthGlobal) {
+          timeStepWidth = predictedTimeStepWidth;
+          hiddenReductions++;
+        } else {
+          // The CFL condition is violated somewhere, repeat the time step with the allowed time step
+          waveBlock->restoreUnknowns();
+          waveBlock->computeNumericalFluxes();
+          waveBlock->updateUnknowns(maxTimeStepWidthGlobal);
+          timeStepWidth = maxTimeStepWidthGlobal;
+          blockingReductions++;
+          repeatedTimeSteps++;
+        }
+      } else {
+        // Determine smallest time step of all blocks
+        MPI_Allreduce(&maxTimeStepWidth, &maxTimeStepWidthGlobal, 1, MY_MPI_FLOAT, MPI_MIN, MPI_COMM_WORLD);
+        blockingReductions++;
+
+        // Update the cell values
+        timeStepWidth = maxTimeStepWidthGlobal;
+        waveBlock->updateUnknowns(timeStepWidth);
+      }
+      predictedTimeStepWidth = safetyFactor * maxTimeStepWidthGlobal;
 
       // Update the cpu time in the logger
       Tools::Logger::logger.updateTime("CPU");
@@ -380,12 +480,12 @@ int main(int argc, char** argv) {
       progressBar.clear();
       Tools::Logger::logger.printSimulationTime(
         simulationTime,
-        "[" + std::to_string(iterations) + "]: Simulation with max. global dt " + std::to_string(maxTimeStepWidthGlobal)
+        "[" + std::to_string(iterations) + "]: Simulation with max. global dt " + std::to_string(timeStepWidth)
           + " at time"
       );
 
       // Update simulation time with time step width
-      simulationTime += maxTimeStepWidthGlobal;
+      simulationTime += timeStepWidth;
       iterations++;
       progressBar.update(simulationTime);
     }
@@ -407,9 +507,13 @@ int main(int argc, char** argv) {
   Tools::Logger::logger.printTime("CPU-Communication", "CPU + Communication Time");
   Tools::Logger::logger.printWallClockTime(time(NULL));
   Tools::Logger::logger.printIterationsDone(iterations);
+  Tools::Logger::logger.printIterationsDone(blockingReductions, "time step reductions waited for before the update");
+  Tools::Logger::logger.printIterationsDone(hiddenReductions, "time step reductions hidden behind the update");
+  Tools::Logger::logger.printIterationsDone(repeatedTimeSteps, "time steps repeated with a smaller time step");
 
   Tools::Logger::logger.printFinishMessage();
 
+  haloExchange.reset();
   delete waveBlock;
   delete[] checkPoints;
 
@@ -457,211 +561,3 @@ int computeNumberOfBlockRows(int numberOfProcesses) {
     numberOfRows--;
   return numberOfRows;
 }
-
-void exchangeLeftRightGhostLayers(
-  const int              leftNeighborRank,
-  Blocks::Block1D*       o_leftInflow,
-  const Blocks::Block1D* leftOutflow,
-  const int              rightNeighborRank,
-  Blocks::Block1D*       o_rightInflow,
-  const Blocks::Block1D* rightOutflow,
-  MPI_Datatype           mpiCol
-) {
-  MPI_Status status;
-
-  // Send to left, receive from the right:
-  MPI_Sendrecv(
-    leftOutflow->h.getData(),
-    1,
-    mpiCol,
-    leftNeighborRank,
-    1,
-    o_rightInflow->h.getData(),
-    1,
-    mpiCol,
-    rightNeighborRank,
-    1,
-    MPI_COMM_WORLD,
-    &status
-  );
-
-  MPI_Sendrecv(
-    leftOutflow->hu.getData(),
-    1,
-    mpiCol,
-    leftNeighborRank,
-    2,
-    o_rightInflow->hu.getData(),
-    1,
-    mpiCol,
-    rightNeighborRank,
-    2,
-    MPI_COMM_WORLD,
-    &status
-  );
-
-  MPI_Sendrecv(
-    leftOutflow->hv.getData(),
-    1,
-    mpiCol,
-    leftNeighborRank,
-    3,
-    o_rightInflow->hv.getData(),
-    1,
-    mpiCol,
-    rightNeighborRank,
-    3,
-    MPI_COMM_WORLD,
-    &status
-  );
-
-  // Send to right, receive from the left:
-  MPI_Sendrecv(
-    rightOutflow->h.getData(),
-    1,
-    mpiCol,
-    rightNeighborRank,
-    4,
-    o_leftInflow->h.getData(),
-    1,
-    mpiCol,
-    leftNeighborRank,
-    4,
-    MPI_COMM_WORLD,
-    &status
-  );
-
-  MPI_Sendrecv(
-    rightOutflow->hu.getData(),
-    1,
-    mpiCol,
-    rightNeighborRank,
-    5,
-    o_leftInflow->hu.getData(),
-    1,
-    mpiCol,
-    leftNeighborRank,
-    5,
-    MPI_COMM_WORLD,
-    &status
-  );
-
-  MPI_Sendrecv(
-    rightOutflow->hv.getData(),
-    1,
-    mpiCol,
-    rightNeighborRank,
-    6,
-    o_leftInflow->hv.getData(),
-    1,
-    mpiCol,
-    leftNeighborRank,
-    6,
-    MPI_COMM_WORLD,
-    &status
-  );
-}
-
-void exchangeBottomTopGhostLayers(
-  const int              bottomNeighborRank,
-  Blocks::Block1D*       o_bottomNeighborInflow,
-  const Blocks::Block1D* bottomNeighborOutflow,
-  const int              topNeighborRank,
-  Blocks::Block1D*       o_topNeighborInflow,
-  const Blocks::Block1D* topNeighborOutflow,
-  MPI_Datatype           mpiRow
-) {
-  MPI_Status status;
-
-  // Send to bottom, receive from the top:
-  MPI_Sendrecv(
-    bottomNeighborOutflow->h.getData(),
-    1,
-    mpiRow,
-    bottomNeighborRank,
-    11,
-    o_topNeighborInflow->h.getData(),
-    1,
-    mpiRow,
-    topNeighborRank,
-    11,
-    MPI_COMM_WORLD,
-    &status
-  );
-
-  MPI_Sendrecv(
-    bottomNeighborOutflow->hu.getData(),
-    1,
-    mpiRow,
-    bottomNeighborRank,
-    12,
-    o_topNeighborInflow->hu.getData(),
-    1,
-    mpiRow,
-    topNeighborRank,
-    12,
-    MPI_COMM_WORLD,
-    &status
-  );
-
-  MPI_Sendrecv(
-    bottomNeighborOutflow->hv.getData(),
-    1,
-    mpiRow,
-    bottomNeighborRank,
-    13,
-    o_topNeighborInflow->hv.getData(),
-    1,
-    mpiRow,
-    topNeighborRank,
-    13,
-    MPI_COMM_WORLD,
-    &status
-  );
-
-  // Send to top, receive from the bottom:
-  MPI_Sendrecv(
-    topNeighborOutflow->h.getData(),
-    1,
-    mpiRow,
-    topNeighborRank,
-    14,
-    o_bottomNeighborInflow->h.getData(),
-    1,
-    mpiRow,
-    bottomNeighborRank,
-    14,
-    MPI_COMM_WORLD,
-    &status
-  );
-
-  MPI_Sendrecv(
-    topNeighborOutflow->hu.getData(),
-    1,
-    mpiRow,
-    topNeighborRank,
-    15,
-    o_bottomNeighborInflow->hu.getData(),
-    1,
-    mpiRow,
-    bottomNeighborRank,
-    15,
-    MPI_COMM_WORLD,
-    &status
-  );
-
-  MPI_Sendrecv(
-    topNeighborOutflow->hv.getData(),
-    1,
-    mpiRow,
-    topNeighborRank,
-    16,
-    o_bottomNeighborInflow->hv.getData(),
-    1,
-    mpiRow,
-    bottomNeighborRank,
-    16,
-    MPI_COMM_WORLD,
-    &status
-  );
-}
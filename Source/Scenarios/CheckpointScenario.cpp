@@ -60,6 +60,9 @@ BoundaryType Scenarios::CheckpointScenario::getBoundaryTypeForInteger(int value)
   if (value == 1) {
     return BoundaryType::Outflow;
   }
+  if (value == 3) {
+    return BoundaryType::Periodic;
+  }
   return BoundaryType::Wall;
 }
 
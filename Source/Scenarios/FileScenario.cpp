@@ -4,6 +4,7 @@
 
 #include "FileScenario.h"
 
+#include <algorithm>
 #include <cmath>
 Scenarios::FileScenario::FileScenario(const std::string& bathymetry, int numCellsX, int numCellsY, int offsetX, RealType epicenterX, RealType epicenterY, RealType magnitude):
   reader_(bathymetry),
@@ -40,14 +41,68 @@ RealType Scenarios::FileScenario::getMaxWaveHeight() const {
 
 int count_lines_skipped = 0;
 
-inline RealType Scenarios::FileScenario::getBathymetry(const RealType x, const RealType y) const {
+int Scenarios::FileScenario::getRow(const RealType y) const {
   RealType y_conv = (y / 12742000) * yDim;
+  return static_cast<int>(y_conv);
+}
+
+int Scenarios::FileScenario::getColumn(const RealType x) const {
   RealType x_conv = (x / 40075000) * xDim;
 
   int y_index = static_cast<int>(offsetX_ + x_conv);
-  y_index %= static_cast<int>(xDim);
-  int    x_index = static_cast<int>(y_conv);
-  double val     = reader_.readUnbuffered(x_index, y_index);
+  return y_index % static_cast<int>(xDim);
+}
+
+double Scenarios::FileScenario::readElevation(const RealType x, const RealType y) const {
+  const int  row    = getRow(y);
+  const int  column = getColumn(x);
+  const auto r      = std::lower_bound(regionRows_.begin(), regionRows_.end(), row);
+  const auto c      = std::lower_bound(regionColumns_.begin(), regionColumns_.end(), column);
+  if (r != regionRows_.end() && *r == row && c != regionColumns_.end() && *c == column) {
+    return region_[(r - regionRows_.begin()) * regionColumns_.size() + (c - regionColumns_.begin())];
+  }
+  return reader_.readUnbuffered(row, column);
+}
+
+void Scenarios::FileScenario::readRegion(const RealType offsetX, const RealType offsetY, const int nx, const int ny, const RealType dx, const RealType dy) {
+  // Only the ghost cells inside the domain are sampled, several cells can sample the same row or column
+  regionRows_.clear();
+  regionColumns_.clear();
+  for (int j = 0; j <= ny + 1; j++) {
+    const RealType y = offsetY + (j - RealType(0.5)) * dy;
+    if (y > getBoundaryPos(BoundaryEdge::Bottom) && y < getBoundaryPos(BoundaryEdge::Top)) {
+      regionRows_.push_back(getRow(y));
+    }
+  }
+  for (int i = 0; i <= nx + 1; i++) {
+    const RealType x = offsetX + (i - RealType(0.5)) * dx;
+    if (x > getBoundaryPos(BoundaryEdge::Left) && x < getBoundaryPos(BoundaryEdge::Right)) {
+      regionColumns_.push_back(getColumn(x));
+    }
+  }
+  for (std::vector<int>* indices : {&regionRows_, &regionColumns_}) {
+    std::sort(indices->begin(), indices->end());
+    indices->erase(std::unique(indices->begin(), indices->end()), indices->end());
+  }
+
+  region_.resize(regionRows_.size() * regionColumns_.size());
+  if (region_.empty()) {
+    return;
+  }
+
+  // A hyperslab of all rows would hold the file in its full resolution, which is much finer than the grid
+  const int           firstColumn = regionColumns_.front();
+  std::vector<double> row(regionColumns_.back() - firstColumn + 1);
+  for (size_t r = 0; r < regionRows_.size(); r++) {
+    reader_.readHyperslab(regionRows_[r], 1, firstColumn, row.size(), row.data());
+    for (size_t c = 0; c < regionColumns_.size(); c++) {
+      region_[r * regionColumns_.size() + c] = row[regionColumns_[c] - firstColumn];
+    }
+  }
+}
+
+inline RealType Scenarios::FileScenario::getBathymetry(const RealType x, const RealType y) const {
+  double val = readElevation(x, y);
   if (val < 20 && val >= 0) {
     return 20;
   } else if (val >= -20 && val < 0) {
@@ -59,16 +114,7 @@ inline RealType Scenarios::FileScenario::getBathymetry(const RealType x, const R
 
 inline RealType Scenarios::FileScenario::getWaterHeight(const RealType x, const RealType y) const {
 
-  RealType y_conv = (y / 12742000) * yDim;
-  RealType x_conv = (x / 40075000) * xDim;
-
-
-
-
-  int y_index = static_cast<int>(offsetX_ + x_conv);
-  y_index %= static_cast<int>(xDim);
-  int    x_index = static_cast<int>(y_conv);
-  double val     = reader_.readUnbuffered(x_index, y_index);
+  double val = readElevation(x, y);
 
   RealType result = 0;
   if (val < 20 && val >= 0) {
@@ -79,12 +125,18 @@ inline RealType Scenarios::FileScenario::getWaterHeight(const RealType x, const
     result = -fmin(val, 0);
   }
   //add tsunami wave
-  if (abs(x_conv/xDim * numCellsX  - epicenterX) < 5  && abs(y_conv /yDim * numCellsY - epicenterY ) < 5 )
-  {
-    result += getStartingWaveHeight() * 1/(1 + ((abs(x_conv/xDim * numCellsX - epicenterX)) * (abs(y_conv /yDim * numCellsY - epicenterY))));
+  return result + getDisplacement(x, y);
+}
+
+RealType Scenarios::FileScenario::getDisplacement(const RealType x, const RealType y) const {
+  RealType cellX = x / 40075000 * numCellsX;
+  RealType cellY = y / 12742000 * numCellsY;
+  if (abs(cellX - epicenterX) < 5 && abs(cellY - epicenterY) < 5) {
+    return getStartingWaveHeight() * 1 / (1 + ((abs(cellX - epicenterX)) * (abs(cellY - epicenterY))));
   }
-  return result;
+  return 0;
 }
+
 RealType Scenarios::FileScenario::getBoundaryPos(const BoundaryEdge edge) const {
   if (edge == BoundaryEdge::Left) {
     return 0;
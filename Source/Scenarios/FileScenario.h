@@ -1,4 +1,5 @@
 #include <string>
+#include <vector>
 
 #include "Readers/NetCDFUnbufferedReader.h"
 #include "Scenario.hpp"
@@ -12,6 +13,22 @@ namespace Scenarios {
 
       RealType getBoundaryPos(BoundaryEdge edge) const override;
 
+      /**
+      * @brief Reads the elevation of the cells offset + (i - 0.5) * d, 0 <= i <= n + 1, which Blocks::Block::initialiseScenario samples for a block
+      * of n cells including its ghost cells. Every row of the file the cells sample is read with one call between the outermost sampled columns,
+      * of which only the sampled values are kept. Then an MPI rank reads only its own part of the file, instead of one value per call and cell.
+      * Other positions are still read from the file one by one.
+      */
+      void readRegion(RealType offsetX, RealType offsetY, int nx, int ny, RealType dx, RealType dy);
+
+      /**
+      * @brief The raise of the sea surface by the earthquake at (x, y), which getWaterHeight adds to the sea at rest.
+      * With setEpicenter and setMagnitude an ensemble gets the initial condition of each member without reading the bathymetry again.
+      *
+      * @return RealType
+      */
+      RealType getDisplacement(RealType x, RealType y) const;
+
       /**
       * @brief This method takes the maxWaveHeight and uses Green's Law to estimate the starting wave height we need to start the process at the epicenter of the earthquake
       * We use a method that approximates the max wave height to be reached at a water height of 50m offshore, therefore the wave being close to land alredy.
@@ -41,6 +58,15 @@ namespace Scenarios {
       }
 
     private:
+      //! The row of the file a y coordinate samples
+      int getRow(RealType y) const;
+
+      //! The column of the file an x coordinate samples
+      int getColumn(RealType x) const;
+
+      //! The elevation at (x, y), from the region if it has been read
+      double readElevation(RealType x, RealType y) const;
+
       RealType epicenterX;
       RealType epicenterY;
       RealType magnitude;
@@ -51,5 +77,10 @@ namespace Scenarios {
       int dx_, dy_;
       int offsetX_;
       int numCellsX, numCellsY;
+
+      // Sorted rows and columns of the file in the region, and their elevations row by row
+      std::vector<int>    regionRows_;
+      std::vector<int>    regionColumns_;
+      std::vector<double> region_;
   };
 } // namespace Scenarios
@@ -77,18 +77,26 @@ void Scenarios::Scenario::setBoundaryType(int type) {
     boundaryTypeLeft = BoundaryType::Outflow;
   } else if(left == 2) {
     boundaryTypeLeft = BoundaryType::Wall;
+  } else if(left == 3) {
+    boundaryTypeLeft = BoundaryType::Periodic;
   }if(right == 1){
     boundaryTypeRight = BoundaryType::Outflow;
   } else if(right == 2) {
     boundaryTypeRight = BoundaryType::Wall;
+  } else if(right == 3) {
+    boundaryTypeRight = BoundaryType::Periodic;
   }if(bottom == 1) {
     boundaryTypeBottom = BoundaryType::Outflow;
   } else if(bottom == 2) {
     boundaryTypeBottom = BoundaryType::Wall;
+  } else if(bottom == 3) {
+    boundaryTypeBottom = BoundaryType::Periodic;
   }if(top == 1) {
     boundaryTypeTop = BoundaryType::Outflow;
   } else if(top == 2) {
     boundaryTypeTop = BoundaryType::Wall;
+  } else if(top == 3) {
+    boundaryTypeTop = BoundaryType::Periodic;
   }
 }
 
@@ -0,0 +1,223 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+
+#include "../Tools/RealType.hpp"
+
+namespace Solvers {
+
+  /**
+   * Allocation-free f-wave kernel operating on plain scalars.
+   *
+   * Computes exactly the same net updates as Solvers::FWaveSolver::computeNetUpdates, but without building
+   * intermediate std::pair objects and with the wet/dry case distinction expressed as selects instead of branches,
+   * such that the compiler can keep everything in registers and inline the kernel into the sweeps of the blocks.
+   * In double precision the results are bit-identical to Solvers::FWaveSolver.
+   */
+  struct FWaveKernel {
+    // Gravity constant
+    static constexpr RealType g = RealType(9.81);
+
+    /**
+     * Compute net updates for the cell on the left/right side of the edge.
+     *
+     * A dry cell (h <= 0) acts as a reflecting wall for its wet neighbour and does not receive any update;
+     * an edge between two dry cells produces no updates and no wave speed. An edge at rest (no momentum on both
+     * sides and the same surface elevation h + b) produces no updates, but still its wave speed.
+     *
+     * @param hLeft height on the left side of the edge.
+     * @param hRight height on the right side of the edge.
+     * @param huLeft momentum on the left side of the edge.
+     * @param huRight momentum on the right side of the edge.
+     * @param bLeft bathymetry on the left side of the edge.
+     * @param bRight bathymetry on the right side of the edge.
+     *
+     * @param o_hUpdateLeft return value for the left net-update for the height.
+     * @param o_hUpdateRight return value for the right net-update for the height.
+     * @param o_huUpdateLeft return value for the left net-update for the momentum.
+     * @param o_huUpdateRight return value for the right net-update for the momentum.
+     * @param o_maxWaveSpeed return value for the maximum wave speed.
+     */
+    static inline void computeNetUpdates(
+      const RealType hLeft,
+      const RealType hRight,
+      const RealType huLeft,
+      const RealType huRight,
+      const RealType bLeft,
+      const RealType bRight,
+      RealType&      o_hUpdateLeft,
+      RealType&      o_hUpdateRight,
+      RealType&      o_huUpdateLeft,
+      RealType&      o_huUpdateRight,
+      RealType&      o_maxWaveSpeed
+    ) {
+      const bool leftDry  = hLeft <= RealType(0.0);
+      const bool rightDry = hRight <= RealType(0.0);
+      const bool bothDry  = leftDry && rightDry;
+      const bool onlyRightDry = !leftDry && rightDry;
+
+      // Mirror the wet state into the dry cell. If both cells are dry, a dummy state at rest keeps the
+      // arithmetic finite; its result is discarded below.
+      const RealType hL  = bothDry ? RealType(1.0) : (leftDry ? hRight : hLeft);
+      const RealType huL = bothDry ? RealType(0.0) : (leftDry ? -huRight : huLeft);
+      const RealType bL  = bothDry ? RealType(0.0) : (leftDry ? bRight : bLeft);
+      const RealType hR  = bothDry ? RealType(1.0) : (onlyRightDry ? hLeft : hRight);
+      const RealType huR = bothDry ? RealType(0.0) : (onlyRightDry ? -huLeft : huRight);
+      const RealType bR  = bothDry ? RealType(0.0) : (onlyRightDry ? bLeft : bRight);
+
+      // Roe averages and eigenvalues
+      const RealType uL     = huL / hL;
+      const RealType uR     = huR / hR;
+      const RealType sqrtHL = std::sqrt(hL);
+      const RealType sqrtHR = std::sqrt(hR);
+      const RealType hRoe   = (hL + hR) / 2;
+      const RealType uRoe   = (uL * sqrtHL + uR * sqrtHR) / (sqrtHL + sqrtHR);
+      const RealType cRoe   = std::sqrt(g * hRoe);
+      const RealType lambda1 = uRoe - cRoe;
+      const RealType lambda2 = uRoe + cRoe;
+
+      // Jump in the flux function minus the effect of the bathymetry
+      const RealType effectOfBathymetry = -g * (bR - bL) * (hL + hR) / (2.0);
+      const RealType deltaFlux1         = huR - huL;
+      const RealType deltaFlux2 = (huR * uR + 0.5 * g * hR * hR) - (huL * uL + 0.5 * g * hL * hL) - effectOfBathymetry;
+
+      // Decompose the flux jump into the eigenvectors (1, lambda1) and (1, lambda2)
+      const RealType determinant = lambda2 - lambda1;
+      const RealType alpha1      = lambda2 / determinant * deltaFlux1 + -1 / determinant * deltaFlux2;
+      const RealType alpha2      = -lambda1 / determinant * deltaFlux1 + 1 / determinant * deltaFlux2;
+
+      // Left going waves update the left cell, right going waves the right cell
+      RealType hUpdateLeft   = lambda1 < 0 ? alpha1 : RealType(0.0);
+      RealType huUpdateLeft  = lambda1 < 0 ? alpha1 * lambda1 : RealType(0.0);
+      RealType hUpdateRight  = lambda1 > 0 ? alpha1 : RealType(0.0);
+      RealType huUpdateRight = lambda1 > 0 ? alpha1 * lambda1 : RealType(0.0);
+      hUpdateLeft            = lambda2 < 0 ? hUpdateLeft + alpha2 : hUpdateLeft;
+      huUpdateLeft           = lambda2 < 0 ? huUpdateLeft + alpha2 * lambda2 : huUpdateLeft;
+      hUpdateRight           = lambda2 > 0 ? hUpdateRight + alpha2 : hUpdateRight;
+      huUpdateRight          = lambda2 > 0 ? huUpdateRight + alpha2 * lambda2 : huUpdateRight;
+
+      // Supersonic flow: only the wave leaving the edge limits the time step
+      const RealType speed1       = (lambda1 < 0 && lambda2 < 0) ? RealType(0.0) : lambda1;
+      const RealType speed2       = (lambda1 > 0 && lambda2 > 0) ? RealType(0.0) : lambda2;
+      const RealType maxWaveSpeed = std::max(std::fabs(speed1), std::fabs(speed2));
+
+      // Lake at rest: the flux jump and the bathymetry source cancel exactly, skip the round-off
+      const bool atRest = huL == RealType(0.0) && huR == RealType(0.0) && hL + bL == hR + bR;
+
+      o_hUpdateLeft   = (leftDry || atRest) ? RealType(0.0) : hUpdateLeft;
+      o_huUpdateLeft  = (leftDry || atRest) ? RealType(0.0) : huUpdateLeft;
+      o_hUpdateRight  = (rightDry || atRest) ? RealType(0.0) : hUpdateRight;
+      o_huUpdateRight = (rightDry || atRest) ? RealType(0.0) : huUpdateRight;
+      o_maxWaveSpeed  = bothDry ? RealType(0.0) : maxWaveSpeed;
+    }
+
+    /**
+     * Compute only the maximum wave speed at the edge, exactly as computeNetUpdates does.
+     *
+     * @param hLeft height on the left side of the edge.
+     * @param hRight height on the right side of the edge.
+     * @param huLeft momentum on the left side of the edge.
+     * @param huRight momentum on the right side of the edge.
+     * @return maximum wave speed.
+     */
+    static inline RealType computeMaxWaveSpeed(const RealType hLeft, const RealType hRight, const RealType huLeft, const RealType huRight) {
+      const bool leftDry      = hLeft <= RealType(0.0);
+      const bool rightDry     = hRight <= RealType(0.0);
+      const bool bothDry      = leftDry && rightDry;
+      const bool onlyRightDry = !leftDry && rightDry;
+
+      const RealType hL  = bothDry ? RealType(1.0) : (leftDry ? hRight : hLeft);
+      const RealType huL = bothDry ? RealType(0.0) : (leftDry ? -huRight : huLeft);
+      const RealType hR  = bothDry ? RealType(1.0) : (onlyRightDry ? hLeft : hRight);
+      const RealType huR = bothDry ? RealType(0.0) : (onlyRightDry ? -huLeft : huRight);
+
+      const RealType uL      = huL / hL;
+      const RealType uR      = huR / hR;
+      const RealType sqrtHL  = std::sqrt(hL);
+      const RealType sqrtHR  = std::sqrt(hR);
+      const RealType hRoe    = (hL + hR) / 2;
+      const RealType uRoe    = (uL * sqrtHL + uR * sqrtHR) / (sqrtHL + sqrtHR);
+      const RealType cRoe    = std::sqrt(g * hRoe);
+      const RealType lambda1 = uRoe - cRoe;
+      const RealType lambda2 = uRoe + cRoe;
+
+      const RealType speed1 = (lambda1 < 0 && lambda2 < 0) ? RealType(0.0) : lambda1;
+      const RealType speed2 = (lambda1 > 0 && lambda2 > 0) ? RealType(0.0) : lambda2;
+      return bothDry ? RealType(0.0) : std::max(std::fabs(speed1), std::fabs(speed2));
+    }
+
+    /**
+     * Compute the net updates for n consecutive edges at once.
+     *
+     * Edge k lies between the states hLeft[k], huLeft[k], bLeft[k] and hRight[k], huRight[k], bRight[k].
+     * For a sweep over a block the arguments are contiguous column slices, e.g. h_[i] + 1 and h_[i + 1] + 1.
+     * The loop is vectorized with the wet/dry cases as lane masks; on x86-64 a clone for AVX-512, AVX2 and the
+     * baseline ISA is compiled and the widest one supported by the host is selected at program start.
+     * The output arrays must not overlap the input arrays.
+     *
+     * @param n number of edges.
+     * @return maximum wave speed over all n edges.
+     */
+    static RealType computeNetUpdatesBatch(
+      const RealType* hLeft,
+      const RealType* hRight,
+      const RealType* huLeft,
+      const RealType* huRight,
+      const RealType* bLeft,
+      const RealType* bRight,
+      RealType*       o_hUpdateLeft,
+      RealType*       o_hUpdateRight,
+      RealType*       o_huUpdateLeft,
+      RealType*       o_huUpdateRight,
+      int             n
+    );
+
+    /**
+     * Compute only the maximum wave speed over n consecutive edges, see computeNetUpdatesBatch.
+     *
+     * @param n number of edges.
+     * @return maximum wave speed over all n edges.
+     */
+    static RealType computeMaxWaveSpeedBatch(const RealType* hLeft, const RealType* hRight, const RealType* huLeft, const RealType* huRight, int n);
+
+    /**
+     * Compute the net updates for the edges of several ensemble members at once, stored interleaved.
+     *
+     * The members of edge k are the states hLeft[k * members + m], huLeft[k * members + m] (and right) for
+     * m = 0, ..., members - 1, they share the bathymetry bLeft[k] and bRight[k]. The inner loop runs over the members
+     * with the bathymetry broadcast to all lanes, so the vector lanes are always full, whatever the shape of the grid.
+     * The output arrays are indexed like the states and must not overlap the input arrays.
+     *
+     * @param rows number of edges.
+     * @param members number of members of every edge.
+     * @return maximum wave speed over all edges and members.
+     */
+    static RealType computeNetUpdatesInterleaved(
+      const RealType* hLeft,
+      const RealType* hRight,
+      const RealType* huLeft,
+      const RealType* huRight,
+      const RealType* bLeft,
+      const RealType* bRight,
+      RealType*       o_hUpdateLeft,
+      RealType*       o_hUpdateRight,
+      RealType*       o_huUpdateLeft,
+      RealType*       o_huUpdateRight,
+      int             rows,
+      int             members
+    );
+
+    /**
+     * Raise io_maxWaveSpeeds[m] to the maximum wave speed of member m over rows interleaved edges, see
+     * computeNetUpdatesInterleaved.
+     *
+     * @param rows number of edges.
+     * @param members number of members of every edge.
+     * @return maximum wave speed over all edges and members.
+     */
+    static RealType computeMaxWaveSpeedInterleaved(
+      const RealType* hLeft, const RealType* hRight, const RealType* huLeft, const RealType* huRight, RealType* io_maxWaveSpeeds, int rows, int members
+    );
+  };
+
+} // namespace Solvers
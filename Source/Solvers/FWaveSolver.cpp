@@ -1,6 +1,7 @@
 #include "FWaveSolver.h"
 
 #include <cassert>
+#include <cmath>
 #include <iostream>
 
 void Solvers::FWaveSolver::computeNetUpdates(
@@ -21,8 +22,17 @@ void Solvers::FWaveSolver::computeNetUpdates(
 
   RealType bLeft_ = bLeft;
   RealType bRight_ = bRight;
+  //Both cells dry
+  if (hLeft <= 0 && hRight <= 0) {
+    o_hUpdateLeft = 0;
+    o_huUpdateLeft = 0;
+    o_hUpdateRight = 0;
+    o_huUpdateRight = 0;
+    o_maxWaveSpeed = 0;
+    return;
+  }
   //Left cell dry, right cell wet
-  if (hLeft <= 0) {
+  else if (hLeft <= 0) {
     leftState.first = rightState.first;
     leftState.second = -rightState.second;
     bLeft_ = bRight;
@@ -32,13 +42,6 @@ void Solvers::FWaveSolver::computeNetUpdates(
     rightState.first = leftState.first;
     rightState.second = -leftState.second;
     bRight_ = bLeft;
-  } else if (hLeft <= 0 && hRight <= 0) {
-    o_hUpdateLeft = 0;
-    o_huUpdateLeft = 0;
-    o_hUpdateRight = 0;
-    o_huUpdateRight = 0;
-    o_maxWaveSpeed = 0;
-    return;
   }
 
   std::pair<RealType, RealType> eigenvalues = calculateEigenvalues(leftState, rightState);
@@ -55,6 +58,13 @@ void Solvers::FWaveSolver::computeNetUpdates(
   o_hUpdateRight = netUpdates.second.first;
   o_huUpdateRight = netUpdates.second.second;
   o_maxWaveSpeed = std::max(std::fabs(eigenvalues.first), std::fabs(eigenvalues.second));
+  //Lake at rest, the flux jump and the effect of the bathymetry cancel exactly
+  if (leftState.second == 0 && rightState.second == 0 && leftState.first + bLeft_ == rightState.first + bRight_) {
+    o_hUpdateLeft = 0;
+    o_huUpdateLeft = 0;
+    o_hUpdateRight = 0;
+    o_huUpdateRight = 0;
+  }
   //Left cell dry, right cell wet
   if (hLeft <= 0) {
     o_hUpdateLeft = 0;
@@ -1,11 +1,14 @@
 #pragma once
-#include <valarray>
-#include <vector>
+#include <utility>
 
 #include "../Tools/RealType.hpp"
 
 namespace Solvers {
 
+  /**
+   * Reference implementation of the f-wave solver following the worksheet step by step.
+   * The blocks use the allocation-free Solvers::FWaveKernel, which computes the same net updates.
+   */
   class FWaveSolver {
   public:
     /**
@@ -128,13 +131,5 @@ namespace Solvers {
      * @return The inverted matrix
      */
     std::pair<std::pair<RealType, RealType>, std::pair<RealType, RealType>> invert2x2Matrix(std::pair<std::pair<RealType, RealType>, std::pair<RealType, RealType>> matrix);
-
-    /**
-     * Multiplies the 2x2 Matrix M to the Vector v (also 2 values) using the order M*v
-     * @param matrix The matrix to be multiplied
-     * @param vector The vector the matrix gets multiplied with
-     * @return result: The 2x2 vector resulting from the multiplication
-     */
-    std::pair<RealType, RealType> matirxVectorMultiplication(std::vector<std::pair<RealType, RealType>> matrix, std::pair<RealType, RealType> vector);
   };
 } // namespace Solvers
\ No newline at end of file
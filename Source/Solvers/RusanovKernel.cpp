@@ -0,0 +1,125 @@
+#include "RusanovKernel.h"
+
+#include <cstddef>
+
+#include "TargetClones.h"
+
+SOLVERS_TARGET_CLONES RealType Solvers::RusanovKernel::computeNetUpdatesBatch(
+  const RealType* __restrict hLeft,
+  const RealType* __restrict hRight,
+  const RealType* __restrict huLeft,
+  const RealType* __restrict huRight,
+  const RealType* __restrict bLeft,
+  const RealType* __restrict bRight,
+  RealType* __restrict o_hUpdateLeft,
+  RealType* __restrict o_hUpdateRight,
+  RealType* __restrict o_huUpdateLeft,
+  RealType* __restrict o_huUpdateRight,
+  const int n
+) {
+  RealType maxWaveSpeed = RealType(0.0);
+
+#pragma omp simd reduction(max : maxWaveSpeed)
+  for (int k = 0; k < n; ++k) {
+    RealType edgeSpeed;
+    computeNetUpdates(
+      hLeft[k],
+      hRight[k],
+      huLeft[k],
+      huRight[k],
+      bLeft[k],
+      bRight[k],
+      o_hUpdateLeft[k],
+      o_hUpdateRight[k],
+      o_huUpdateLeft[k],
+      o_huUpdateRight[k],
+      edgeSpeed
+    );
+    maxWaveSpeed = std::max(maxWaveSpeed, edgeSpeed);
+  }
+
+  return maxWaveSpeed;
+}
+
+SOLVERS_TARGET_CLONES RealType Solvers::RusanovKernel::computeMaxWaveSpeedBatch(
+  const RealType* __restrict hLeft, const RealType* __restrict hRight, const RealType* __restrict huLeft, const RealType* __restrict huRight, const int n
+) {
+  RealType maxWaveSpeed = RealType(0.0);
+
+#pragma omp simd reduction(max : maxWaveSpeed)
+  for (int k = 0; k < n; ++k) {
+    maxWaveSpeed = std::max(maxWaveSpeed, computeMaxWaveSpeed(hLeft[k], hRight[k], huLeft[k], huRight[k]));
+  }
+
+  return maxWaveSpeed;
+}
+
+SOLVERS_TARGET_CLONES RealType Solvers::RusanovKernel::computeNetUpdatesInterleaved(
+  const RealType* __restrict hLeft,
+  const RealType* __restrict hRight,
+  const RealType* __restrict huLeft,
+  const RealType* __restrict huRight,
+  const RealType* __restrict bLeft,
+  const RealType* __restrict bRight,
+  RealType* __restrict o_hUpdateLeft,
+  RealType* __restrict o_hUpdateRight,
+  RealType* __restrict o_huUpdateLeft,
+  RealType* __restrict o_huUpdateRight,
+  const int rows,
+  const int members
+) {
+  RealType maxWaveSpeed = 0.0;
+
+  for (int k = 0; k < rows; ++k) {
+    const RealType    bL     = bLeft[k];
+    const RealType    bR     = bRight[k];
+    const std::size_t offset = std::size_t(k) * members;
+
+#pragma omp simd reduction(max : maxWaveSpeed)
+    for (int m = 0; m < members; ++m) {
+      RealType edgeSpeed;
+      computeNetUpdates(
+        hLeft[offset + m],
+        hRight[offset + m],
+        huLeft[offset + m],
+        huRight[offset + m],
+        bL,
+        bR,
+        o_hUpdateLeft[offset + m],
+        o_hUpdateRight[offset + m],
+        o_huUpdateLeft[offset + m],
+        o_huUpdateRight[offset + m],
+        edgeSpeed
+      );
+      maxWaveSpeed = std::max(maxWaveSpeed, edgeSpeed);
+    }
+  }
+
+  return maxWaveSpeed;
+}
+
+SOLVERS_TARGET_CLONES RealType Solvers::RusanovKernel::computeMaxWaveSpeedInterleaved(
+  const RealType* __restrict hLeft,
+  const RealType* __restrict hRight,
+  const RealType* __restrict huLeft,
+  const RealType* __restrict huRight,
+  RealType* __restrict io_maxWaveSpeeds,
+  const int rows,
+  const int members
+) {
+  RealType maxWaveSpeed = 0.0;
+
+  for (int k = 0; k < rows; ++k) {
+    const std::size_t offset = std::size_t(k) * members;
+
+    // The reduction keeps the loop free of control flow, GCC does not vectorise it with the stores alone
+#pragma omp simd reduction(max : maxWaveSpeed)
+    for (int m = 0; m < members; ++m) {
+      const RealType edgeSpeed = computeMaxWaveSpeed(hLeft[offset + m], hRight[offset + m], huLeft[offset + m], huRight[offset + m]);
+      io_maxWaveSpeeds[m]      = std::max(io_maxWaveSpeeds[m], edgeSpeed);
+      maxWaveSpeed             = std::max(maxWaveSpeed, edgeSpeed);
+    }
+  }
+
+  return maxWaveSpeed;
+}
@@ -0,0 +1,179 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+
+#include "../Tools/RealType.hpp"
+
+namespace Solvers {
+
+  /**
+   * Allocation-free Rusanov (local Lax-Friedrichs) kernel with the same interface as Solvers::FWaveKernel.
+   *
+   * The numerical flux is the average of both physical fluxes plus a diffusion proportional to the fastest local wave
+   * speed. The diffusion in the height acts on the jump of the surface elevation h + b instead of h and the
+   * bathymetry source term is split evenly between both cells, so a lake at rest stays at rest. It avoids the
+   * eigenvector decomposition of the f-wave solver and is therefore cheaper per edge, but more diffusive.
+   * Dry cells are treated as reflecting walls exactly like in Solvers::FWaveKernel.
+   */
+  struct RusanovKernel {
+    // Gravity constant
+    static constexpr RealType g = RealType(9.81);
+
+    /**
+     * Compute net updates for the cell on the left/right side of the edge.
+     *
+     * @param hLeft height on the left side of the edge.
+     * @param hRight height on the right side of the edge.
+     * @param huLeft momentum on the left side of the edge.
+     * @param huRight momentum on the right side of the edge.
+     * @param bLeft bathymetry on the left side of the edge.
+     * @param bRight bathymetry on the right side of the edge.
+     *
+     * @param o_hUpdateLeft return value for the left net-update for the height.
+     * @param o_hUpdateRight return value for the right net-update for the height.
+     * @param o_huUpdateLeft return value for the left net-update for the momentum.
+     * @param o_huUpdateRight return value for the right net-update for the momentum.
+     * @param o_maxWaveSpeed return value for the maximum wave speed.
+     */
+    static inline void computeNetUpdates(
+      const RealType hLeft,
+      const RealType hRight,
+      const RealType huLeft,
+      const RealType huRight,
+      const RealType bLeft,
+      const RealType bRight,
+      RealType&      o_hUpdateLeft,
+      RealType&      o_hUpdateRight,
+      RealType&      o_huUpdateLeft,
+      RealType&      o_huUpdateRight,
+      RealType&      o_maxWaveSpeed
+    ) {
+      const bool leftDry      = hLeft <= RealType(0.0);
+      const bool rightDry     = hRight <= RealType(0.0);
+      const bool bothDry      = leftDry && rightDry;
+      const bool onlyRightDry = !leftDry && rightDry;
+
+      // Mirror the wet state into the dry cell, see Solvers::FWaveKernel
+      const RealType hL  = bothDry ? RealType(1.0) : (leftDry ? hRight : hLeft);
+      const RealType huL = bothDry ? RealType(0.0) : (leftDry ? -huRight : huLeft);
+      const RealType bL  = bothDry ? RealType(0.0) : (leftDry ? bRight : bLeft);
+      const RealType hR  = bothDry ? RealType(1.0) : (onlyRightDry ? hLeft : hRight);
+      const RealType huR = bothDry ? RealType(0.0) : (onlyRightDry ? -huLeft : huRight);
+      const RealType bR  = bothDry ? RealType(0.0) : (onlyRightDry ? bLeft : bRight);
+
+      const RealType uL = huL / hL;
+      const RealType uR = huR / hR;
+
+      // Fastest local wave speed
+      const RealType speed = std::max(std::fabs(uL) + std::sqrt(g * hL), std::fabs(uR) + std::sqrt(g * hR));
+
+      // Physical fluxes of the momentum
+      const RealType fluxL = huL * uL + RealType(0.5) * g * hL * hL;
+      const RealType fluxR = huR * uR + RealType(0.5) * g * hR * hR;
+
+      // Rusanov fluxes at the edge
+      const RealType hFlux  = RealType(0.5) * (huL + huR) - RealType(0.5) * speed * ((hR + bR) - (hL + bL));
+      const RealType huFlux = RealType(0.5) * (fluxL + fluxR) - RealType(0.5) * speed * (huR - huL);
+
+      // Half of the bathymetry source term for each cell
+      const RealType halfSource = RealType(0.25) * g * (bR - bL) * (hL + hR);
+
+      // Lake at rest, see Solvers::FWaveKernel
+      const bool atRest = huL == RealType(0.0) && huR == RealType(0.0) && hL + bL == hR + bR;
+
+      o_hUpdateLeft   = (leftDry || atRest) ? RealType(0.0) : hFlux - huL;
+      o_huUpdateLeft  = (leftDry || atRest) ? RealType(0.0) : huFlux - fluxL + halfSource;
+      o_hUpdateRight  = (rightDry || atRest) ? RealType(0.0) : huR - hFlux;
+      o_huUpdateRight = (rightDry || atRest) ? RealType(0.0) : fluxR - huFlux + halfSource;
+      o_maxWaveSpeed  = bothDry ? RealType(0.0) : speed;
+    }
+
+    /**
+     * Compute only the maximum wave speed at the edge, exactly as computeNetUpdates does.
+     *
+     * @param hLeft height on the left side of the edge.
+     * @param hRight height on the right side of the edge.
+     * @param huLeft momentum on the left side of the edge.
+     * @param huRight momentum on the right side of the edge.
+     * @return maximum wave speed.
+     */
+    static inline RealType computeMaxWaveSpeed(const RealType hLeft, const RealType hRight, const RealType huLeft, const RealType huRight) {
+      const bool leftDry      = hLeft <= RealType(0.0);
+      const bool rightDry     = hRight <= RealType(0.0);
+      const bool bothDry      = leftDry && rightDry;
+      const bool onlyRightDry = !leftDry && rightDry;
+
+      const RealType hL  = bothDry ? RealType(1.0) : (leftDry ? hRight : hLeft);
+      const RealType huL = bothDry ? RealType(0.0) : (leftDry ? -huRight : huLeft);
+      const RealType hR  = bothDry ? RealType(1.0) : (onlyRightDry ? hLeft : hRight);
+      const RealType huR = bothDry ? RealType(0.0) : (onlyRightDry ? -huLeft : huRight);
+
+      const RealType speed = std::max(std::fabs(huL / hL) + std::sqrt(g * hL), std::fabs(huR / hR) + std::sqrt(g * hR));
+      return bothDry ? RealType(0.0) : speed;
+    }
+
+    /**
+     * Compute the net updates for n consecutive edges at once, see Solvers::FWaveKernel::computeNetUpdatesBatch.
+     *
+     * @param n number of edges.
+     * @return maximum wave speed over all n edges.
+     */
+    static RealType computeNetUpdatesBatch(
+      const RealType* hLeft,
+      const RealType* hRight,
+      const RealType* huLeft,
+      const RealType* huRight,
+      const RealType* bLeft,
+      const RealType* bRight,
+      RealType*       o_hUpdateLeft,
+      RealType*       o_hUpdateRight,
+      RealType*       o_huUpdateLeft,
+      RealType*       o_huUpdateRight,
+      int             n
+    );
+
+    /**
+     * Compute only the maximum wave speed over n consecutive edges, see computeNetUpdatesBatch.
+     *
+     * @param n number of edges.
+     * @return maximum wave speed over all n edges.
+     */
+    static RealType computeMaxWaveSpeedBatch(const RealType* hLeft, const RealType* hRight, const RealType* huLeft, const RealType* huRight, int n);
+
+    /**
+     * Compute the net updates for the edges of several ensemble members at once, see
+     * Solvers::FWaveKernel::computeNetUpdatesInterleaved.
+     *
+     * @param rows number of edges.
+     * @param members number of members of every edge.
+     * @return maximum wave speed over all edges and members.
+     */
+    static RealType computeNetUpdatesInterleaved(
+      const RealType* hLeft,
+      const RealType* hRight,
+      const RealType* huLeft,
+      const RealType* huRight,
+      const RealType* bLeft,
+      const RealType* bRight,
+      RealType*       o_hUpdateLeft,
+      RealType*       o_hUpdateRight,
+      RealType*       o_huUpdateLeft,
+      RealType*       o_huUpdateRight,
+      int             rows,
+      int             members
+    );
+
+    /**
+     * Raise io_maxWaveSpeeds[m] to the maximum wave speed of member m over rows interleaved edges, see
+     * computeNetUpdatesInterleaved.
+     *
+     * @param rows number of edges.
+     * @param members number of members of every edge.
+     * @return maximum wave speed over all edges and members.
+     */
+    static RealType computeMaxWaveSpeedInterleaved(
+      const RealType* hLeft, const RealType* hRight, const RealType* huLeft, const RealType* huRight, RealType* io_maxWaveSpeeds, int rows, int members
+    );
+  };
+
+} // namespace Solvers
@@ -0,0 +1,18 @@
+#pragma once
+
+/**
+ * Attributes for the batched edge kernels of the solvers.
+ *
+ * On x86-64 the kernel is compiled for AVX-512, AVX2 and the baseline ISA, and the widest version supported by the
+ * host is selected at program start (GCC/Clang function multi-versioning). Builds with ENABLE_VECTORIZATION already
+ * target the host with -march=native and need no clones. The scalar kernel is flattened into the loop, otherwise it
+ * is not inlined into the clones below -O3.
+ */
+#if defined(__x86_64__) && defined(__has_attribute) && !defined(ENABLE_VECTORIZATION)
+  #if __has_attribute(target_clones) && __has_attribute(flatten)
+    #define SOLVERS_TARGET_CLONES __attribute__((target_clones("avx512f", "avx2", "default"), flatten))
+  #endif
+#endif
+#ifndef SOLVERS_TARGET_CLONES
+  #define SOLVERS_TARGET_CLONES
+#endif
@@ -0,0 +1,81 @@
+#include "AlignedAllocator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace {
+  constexpr std::size_t HugePageSize = std::size_t(2) << 20;
+
+  // number of different start offsets of staggered allocations
+  constexpr std::size_t StaggerLines = 8;
+
+  std::size_t roundUp(std::size_t value, std::size_t multiple) { return (value + multiple - 1) / multiple * multiple; }
+} // namespace
+
+Tools::AlignedAllocator::Allocation Tools::AlignedAllocator::allocate(std::size_t bytes, HugePages hugePages, bool stagger) {
+  static std::atomic<std::size_t> allocationCount{0};
+
+  const std::size_t offset = stagger ? (allocationCount++ % StaggerLines) * Alignment : 0;
+  const std::size_t size   = bytes + offset;
+
+  Allocation allocation;
+#if defined(__linux__)
+  if (hugePages == HugePages::Explicit) {
+    allocation.bytes = roundUp(size, HugePageSize);
+    void* pointer    = mmap(nullptr, allocation.bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (pointer != MAP_FAILED) {
+      allocation.base   = pointer;
+      allocation.mapped = true;
+      allocation.data   = static_cast<char*>(pointer) + offset;
+      return allocation;
+    }
+    // No huge pages reserved in /proc/sys/vm/nr_hugepages
+    hugePages = HugePages::Transparent;
+  }
+#endif
+
+  const std::size_t alignment = hugePages == HugePages::None ? Alignment : HugePageSize;
+  allocation.bytes            = roundUp(std::max(size, std::size_t(1)), alignment);
+  allocation.base             = std::aligned_alloc(alignment, allocation.bytes);
+  if (allocation.base == nullptr) {
+    throw std::bad_alloc();
+  }
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  if (hugePages != HugePages::None) {
+    // Only a hint, the kernel ignores it if transparent huge pages are disabled
+    madvise(allocation.base, allocation.bytes, MADV_HUGEPAGE);
+  }
+#endif
+  allocation.data = static_cast<char*>(allocation.base) + offset;
+  return allocation;
+}
+
+void Tools::AlignedAllocator::deallocate(const Allocation& allocation) {
+  if (allocation.base == nullptr) {
+    return;
+  }
+#if defined(__linux__)
+  if (allocation.mapped) {
+    munmap(allocation.base, allocation.bytes);
+    return;
+  }
+#endif
+  std::free(allocation.base);
+}
+
+int Tools::AlignedAllocator::paddedStride(int rows, std::size_t elementSize) {
+  const std::size_t lineElements = Alignment / elementSize;
+  std::size_t       stride       = roundUp(std::size_t(rows), lineElements);
+
+  // Columns that are a multiple of 1 KiB apart map to the same cache sets
+  if ((stride * elementSize) % 1024 == 0) {
+    stride += lineElements;
+  }
+  return int(stride);
+}
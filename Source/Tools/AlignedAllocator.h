@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Tools {
+
+  /**
+   * How the memory of large arrays is backed by pages.
+   */
+  enum class HugePages {
+    //! Regular pages.
+    None,
+    //! Regular allocation aligned to 2 MiB and madvise(MADV_HUGEPAGE), the kernel backs it with transparent huge pages.
+    Transparent,
+    //! mmap(MAP_HUGETLB) from the preallocated huge page pool, falls back to Transparent if the pool is empty.
+    Explicit
+  };
+
+  /**
+   * Memory layout of the arrays of a Tools::Float2D.
+   */
+  struct MemoryLayout {
+    //! Pad the column stride to whole cache lines and away from multiples of 1 KiB, and stagger the array starts.
+    bool padColumns{false};
+
+    HugePages hugePages{HugePages::None};
+
+    /**
+     * @brief Layout of all arrays that are allocated without an explicit layout, has to be set before the blocks are created.
+     */
+    static MemoryLayout& getDefault() {
+      static MemoryLayout layout;
+      return layout;
+    }
+  };
+
+  /**
+   * Allocates cache-line aligned memory, optionally backed by huge pages.
+   */
+  class AlignedAllocator {
+  public:
+    static constexpr std::size_t Alignment = 64;
+
+    struct Allocation {
+      //! what has to be released
+      void*       base{nullptr};
+      std::size_t bytes{0};
+      bool        mapped{false};
+      //! first usable byte, aligned to Alignment
+      void* data{nullptr};
+    };
+
+    /**
+     * @brief Allocates at least bytes bytes. If stagger is set, the start is shifted by a few cache lines that change
+     * from call to call, such that arrays of the same size do not start in the same cache set.
+     */
+    static Allocation allocate(std::size_t bytes, HugePages hugePages, bool stagger);
+
+    static void deallocate(const Allocation& allocation);
+
+    /**
+     * @brief Column stride (in elements) for columns of rows elements of size elementSize.
+     */
+    static int paddedStride(int rows, std::size_t elementSize);
+  };
+
+} // namespace Tools
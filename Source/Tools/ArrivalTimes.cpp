@@ -0,0 +1,100 @@
+#include "ArrivalTimes.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <queue>
+
+static constexpr RealType GRAVITY = 9.81f;
+
+void Tools::ArrivalTimes::compute(
+  const Float2D<RealType>& b, int nx, int ny, RealType dx, RealType dy, const std::vector<std::pair<int, int>>& sources, bool periodicX
+) {
+  nx_        = nx;
+  ny_        = ny;
+  periodicX_ = periodicX;
+  times_.assign(std::size_t(nx + 2) * (ny + 2), std::numeric_limits<RealType>::infinity());
+  states_.assign(times_.size(), State::Far);
+
+  // The ghost layer is never reached, it stops the front at the boundary (a periodic front continues on the other side)
+  for (int i = 0; i <= nx + 1; i++) {
+    states_[index(i, 0)]      = State::Known;
+    states_[index(i, ny + 1)] = State::Known;
+  }
+  for (int j = 0; j <= ny + 1; j++) {
+    states_[index(0, j)]      = State::Known;
+    states_[index(nx + 1, j)] = State::Known;
+  }
+
+  // Trial cells by arrival time, a cell that got a smaller time is pushed again and the stale entry skipped
+  using Entry = std::pair<RealType, int>;
+  std::priority_queue<Entry, std::vector<Entry>, std::greater<>> trial;
+  for (const auto& [i, j] : sources) {
+    if (i < 1 || i > nx || j < 1 || j > ny || b[i][j] >= RealType(0.0)) {
+      continue;
+    }
+    times_[index(i, j)]  = RealType(0.0);
+    states_[index(i, j)] = State::Trial;
+    trial.emplace(RealType(0.0), index(i, j));
+  }
+
+  while (!trial.empty()) {
+    const auto [time, cell] = trial.top();
+    trial.pop();
+    if (states_[cell] == State::Known || time > times_[cell]) {
+      continue;
+    }
+    states_[cell] = State::Known;
+
+    const int i = cell / (ny + 2);
+    const int j = cell % (ny + 2);
+    for (auto [neighbourI, neighbourJ] : {std::pair{wrap(i - 1), j}, {wrap(i + 1), j}, {i, j - 1}, {i, j + 1}}) {
+      const int neighbour = index(neighbourI, neighbourJ);
+      if (states_[neighbour] == State::Known || b[neighbourI][neighbourJ] >= RealType(0.0)) {
+        continue;
+      }
+      const RealType speed         = std::sqrt(-GRAVITY * b[neighbourI][neighbourJ]);
+      const RealType neighbourTime = solve(neighbourI, neighbourJ, speed, dx, dy);
+      if (neighbourTime < times_[neighbour]) {
+        times_[neighbour]  = neighbourTime;
+        states_[neighbour] = State::Trial;
+        trial.emplace(neighbourTime, neighbour);
+      }
+    }
+  }
+}
+
+RealType Tools::ArrivalTimes::solve(int i, int j, RealType speed, RealType dx, RealType dy) const {
+  const auto known = [&](int k) { return states_[k] == State::Known ? times_[k] : std::numeric_limits<RealType>::infinity(); };
+  const RealType timeX = std::min(known(index(wrap(i - 1), j)), known(index(wrap(i + 1), j)));
+  const RealType timeY = std::min(known(index(i, j - 1)), known(index(i, j + 1)));
+
+  // One-sided update along the axis with the earlier neighbour
+  const RealType oneSided = std::min(timeX + dx / speed, timeY + dy / speed);
+  if (std::isinf(timeX) || std::isinf(timeY)) {
+    return oneSided;
+  }
+
+  // (T - timeX)^2 / dx^2 + (T - timeY)^2 / dy^2 = 1 / speed^2, the solution has to be upwind of both neighbours
+  const RealType weightX      = 1 / (dx * dx);
+  const RealType weightY      = 1 / (dy * dy);
+  const RealType weight       = weightX + weightY;
+  const RealType mean         = weightX * timeX + weightY * timeY;
+  const RealType discriminant = mean * mean - weight * (weightX * timeX * timeX + weightY * timeY * timeY - 1 / (speed * speed));
+  if (discriminant < RealType(0.0)) {
+    return oneSided;
+  }
+  const RealType time = (mean + std::sqrt(discriminant)) / weight;
+  return time >= std::max(timeX, timeY) ? std::min(time, oneSided) : oneSided;
+}
+
+RealType Tools::ArrivalTimes::getMinimum(int iBegin, int iEnd, int jBegin, int jEnd) const {
+  RealType minimum = std::numeric_limits<RealType>::infinity();
+  for (int i = periodicX_ ? iBegin : std::max(iBegin, 1); i <= (periodicX_ ? iEnd : std::min(iEnd, nx_)); i++) {
+    for (int j = std::max(jBegin, 1); j <= std::min(jEnd, ny_); j++) {
+      minimum = std::min(minimum, get(wrap(i), j));
+    }
+  }
+  return minimum;
+}
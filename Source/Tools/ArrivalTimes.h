@@ -0,0 +1,69 @@
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "Float2D.hpp"
+#include "RealType.hpp"
+
+namespace Tools {
+
+  /**
+   * @class ArrivalTimes
+   * @brief First arrival times of a long wave from a set of source cells, computed with the fast marching method.
+   *
+   * The times solve the eikonal equation |grad T| = 1 / c with the shallow water wave speed c = sqrt(g * max(-b, 0)),
+   * discretised with first-order upwind differences on the cells of a nx * ny block. Cells are accepted in the order
+   * of their arrival time, each one exactly once, so a map costs O(n log n) for n wet cells. Dry cells (b >= 0) are
+   * never reached and keep an infinite arrival time, which makes the waves go around the land.
+   *
+   * This is a cheap estimate: the times do not depend on the wave height and ignore dispersion and reflections, so
+   * they are a lower bound for the arrival of the first crest rather than a prediction of the run-up.
+   */
+  class ArrivalTimes {
+  public:
+    /**
+     * @brief Computes the arrival times of the cells (1..nx, 1..ny) with bathymetry b and cell size dx * dy from the
+     * given source cells, which start at time 0. With periodicX the first and last column are neighbours.
+     */
+    void compute(
+      const Float2D<RealType>& b, int nx, int ny, RealType dx, RealType dy, const std::vector<std::pair<int, int>>& sources, bool periodicX = false
+    );
+
+    /**
+     * @brief Arrival time of cell (i, j), infinite if it is not reached.
+     */
+    RealType get(int i, int j) const { return times_[index(i, j)]; }
+
+    /**
+     * @brief Earliest arrival time in the cells [iBegin, iEnd] x [jBegin, jEnd], clipped to the block (or wrapped
+     * around it in x if it is periodic).
+     */
+    RealType getMinimum(int iBegin, int iEnd, int jBegin, int jEnd) const;
+
+    int getNx() const { return nx_; }
+    int getNy() const { return ny_; }
+
+  private:
+    enum class State : char { Far, Trial, Known };
+
+    int  nx_        = 0;
+    int  ny_        = 0;
+    bool periodicX_ = false;
+
+    // arrival times and states of the cells including the ghost layer, column-major like Tools::Float2D
+    std::vector<RealType> times_;
+    std::vector<State>    states_;
+
+    int index(int i, int j) const { return i * (ny_ + 2) + j; }
+
+    //! column i moved into [1, nx] if the block is periodic in x
+    int wrap(int i) const { return periodicX_ ? ((i - 1) % nx_ + nx_) % nx_ + 1 : i; }
+
+    /**
+     * @brief Upwind solution of the eikonal equation in cell (i, j) from its accepted neighbours.
+     */
+    RealType solve(int i, int j, RealType speed, RealType dx, RealType dy) const;
+  };
+
+} // namespace Tools
@@ -3,65 +3,49 @@
 namespace Tools {
   class Coarse {
   public:
-    static Tools::Float2D<RealType> coarseArray(const Tools::Float2D<RealType>& array, int coarse, int nx, int ny, int groupsX, int restX, int groupsY, int restY) {
-      int addX = 0;
-      if (restX != 0) {
-        addX++;
-      }
-      int addY = 0;
-      if (restY != 0) {
-        addY++;
-      }
+    /**
+     * @brief Averages groups of coarse x coarse cells of array into one cell of result. The remaining restX columns and
+     * restY rows are collected into one additional column and row. result needs groupsX + (restX != 0) + 2 columns and
+     * groupsY + (restY != 0) + 2 rows and can be reused for every output, no temporary arrays are allocated.
+     */
+    static void coarseArray(
+      const Tools::Float2D<RealType>& array, int coarse, int nx, int ny, int groupsX, int restX, int groupsY, int restY, Tools::Float2D<RealType>& result
+    ) {
+      const int addX = (restX != 0) ? 1 : 0;
 
-      RealType averagedValue = 0;
+      // Every output column is done in a single pass over the rows of its group of input columns. The row averages are
+      // summed up per group of rows, which gives exactly the average of the averages in x direction.
+      for (int x = 1; x <= groupsX + addX; x++) {
+        const int firstColumn = (x - 1) * coarse;
+        const int columns     = (x <= groupsX) ? coarse : restX;
 
-      Tools::Float2D<RealType> tempStorageX(groupsX + addX + 2, ny + 2, true);
-      // Average the values in x Direction
-      for (int y = 1; y <= ny; y++) {
-        averagedValue = 0;
-        for (int x = 1; x <= groupsX; x++) {
-          averagedValue = 0;
-          for (int i = 1; i <= coarse; i++) {
-            averagedValue += array[(x - 1) * coarse + i][y];
+        RealType groupSum = 0;
+        for (int y = 1; y <= ny; y++) {
+          RealType averagedValue = 0;
+          for (int i = 1; i <= columns; i++) {
+            averagedValue += array[firstColumn + i][y];
           }
-          averagedValue = averagedValue / coarse;
-          tempStorageX[x][y] = averagedValue;
-        }
-        averagedValue = 0;
-        // Collect the remaining restX cells into one
-        if (addX != 0) {
-          averagedValue = 0;
-          for (int i = 1; i <= restX; i++) {
-            averagedValue += array[groupsX * coarse + i][y];
-          }
-          averagedValue = averagedValue / restX;
-          tempStorageX[(groupsX + addX)][y] = averagedValue;
-        }
-      }
+          groupSum += averagedValue / columns;
 
-      // Average the values in y direction
-      Tools::Float2D<RealType> tempStorageY(groupsX + addX + 2, groupsY + addY + 2, true);
-      for (int x = 1; x <= groupsX + addX; x++) {
-        averagedValue = 0;
-        for (int y = 1; y <= groupsY; y++) {
-          averagedValue = 0;
-          for (int i = 1; i <= coarse; i++) {
-            averagedValue += tempStorageX[x][(y - 1) * coarse + i];
-          }
-          averagedValue = averagedValue / coarse;
-          tempStorageY[x][y] = averagedValue;
-        }
-        // Collect the remaining restY rows below
-        if (addY != 0) {
-          averagedValue = 0;
-          for (int i = 1; i <= restY; i++) {
-            averagedValue += tempStorageX[x][groupsY * coarse + i];
+          if (y <= groupsY * coarse) {
+            if (y % coarse == 0) {
+              result[x][y / coarse] = groupSum / coarse;
+              groupSum              = 0;
+            }
+          } else if (y == ny) {
+            // Collect the remaining restY rows below
+            result[x][groupsY + 1] = groupSum / restY;
           }
-          averagedValue = averagedValue / restY;
-          tempStorageY[x][groupsY + addY] = averagedValue;
         }
       }
-      return tempStorageY;
+    }
+
+    static Tools::Float2D<RealType> coarseArray(const Tools::Float2D<RealType>& array, int coarse, int nx, int ny, int groupsX, int restX, int groupsY, int restY) {
+      const int                addX = (restX != 0) ? 1 : 0;
+      const int                addY = (restY != 0) ? 1 : 0;
+      Tools::Float2D<RealType> result(groupsX + addX + 2, groupsY + addY + 2, true);
+      coarseArray(array, coarse, nx, ny, groupsX, restX, groupsY, restY, result);
+      return result;
     }
   };
 } // namespace Tools
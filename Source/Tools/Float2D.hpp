@@ -28,8 +28,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdio>
+#include <type_traits>
 
+#include "AlignedAllocator.h"
 #include "Float1D.hpp"
 
 namespace Tools {
@@ -41,17 +44,54 @@ namespace Tools {
    * values are sequentially ordered in memory using "column major" order.
    * Besides constructor/deconstructor, the class provides overloading of
    * the []-operator, such that elements can be accessed as a[i][j].
+   *
+   * A Float2D owns its elements: copies are deep, moves hand the memory over, and assigning an array of the same
+   * size copies the values into the existing memory. Code that only needs to look at an array without owning it
+   * uses a Tools::Float2DView.
+   *
+   * Allocated arrays start at a 64-byte boundary. With a Tools::MemoryLayout that pads the columns, consecutive
+   * columns are getStride() >= getRows() elements apart, so getData() is only one contiguous block of getSize()
+   * elements if getStride() == getRows().
    */
   template <class T>
   class Float2D {
+    static_assert(std::is_trivially_copyable_v<T>, "Float2D only supports plain element types");
+
   private:
     int rows_;
     int cols_;
+    int stride_;
 
     T* data_;
 
     bool allocateMemory_;
 
+    AlignedAllocator::Allocation allocation_;
+
+    void allocate(const MemoryLayout& layout) {
+      allocation_ = AlignedAllocator::allocate(sizeof(T) * std::size_t(stride_) * cols_, layout.hugePages, layout.padColumns);
+      data_       = static_cast<T*>(allocation_.data);
+    }
+
+    void release() {
+      if (allocateMemory_) {
+        AlignedAllocator::deallocate(allocation_);
+      }
+      data_           = nullptr;
+      allocateMemory_ = false;
+      allocation_     = {};
+    }
+
+    void copyFrom(const Float2D<T>& other) {
+      if (stride_ == rows_ && other.stride_ == other.rows_) {
+        std::copy_n(other.data_, std::size_t(rows_) * cols_, data_);
+        return;
+      }
+      for (int i = 0; i < cols_; i++) {
+        std::copy_n(other[i], rows_, (*this)[i]);
+      }
+    }
+
   public:
     /**
      * Constructor:
@@ -61,13 +101,22 @@ namespace Tools {
      * @param rows rumber of rows (i.e., elements in vertical directions)
      */
     Float2D(int cols, int rows, bool allocateMemory = true):
+      Float2D(cols, rows, allocateMemory, MemoryLayout::getDefault()) {}
+
+    /**
+     * Constructor:
+     * as above, but with an explicit memory layout instead of MemoryLayout::getDefault().
+     * @param layout padding of the columns and page size of the allocation
+     */
+    Float2D(int cols, int rows, bool allocateMemory, const MemoryLayout& layout):
       rows_(rows),
       cols_(cols),
+      stride_(layout.padColumns ? AlignedAllocator::paddedStride(rows, sizeof(T)) : rows),
       data_(nullptr),
       allocateMemory_(allocateMemory) {
 
       if (allocateMemory_) {
-        data_ = new T[rows * cols];
+        allocate(layout);
       }
     }
 
@@ -79,63 +128,85 @@ namespace Tools {
      * @param cols number of columns (i.e., elements in horizontal direction)
      * @param rows rumber of rows (i.e., elements in vertical directions)
      * @param data pointer to a suitably allocated region of memory to be used for thew array elements
+     * @param stride distance between the starts of two columns in data, rows if not given
      */
-    Float2D(int cols, int rows, T* data):
+    Float2D(int cols, int rows, T* data, int stride = 0):
       rows_(rows),
       cols_(cols),
+      stride_(stride > 0 ? stride : rows),
       data_(data),
       allocateMemory_(false) {}
 
     /**
-     * Constructor:
-     * takes size of the 2D array as parameters and creates a respective Float2D object;
-     * this constructor does not allocate memory for the array, but uses the allocated memory
-     * provided via the respective variable data
-     * @param cols number of columns (i.e., elements in horizontal direction)
-     * @param rows rumber of rows (i.e., elements in vertical directions)
-     * @param data pointer to a suitably allocated region of memory to be used for thew array elements
+     * Copy constructor:
+     * allocates a new array with the same size and column padding and copies the values.
      */
-    Float2D(Float2D<T>& data, bool shallowCopy):
-      rows_(data.rows_),
-      cols_(data.cols_),
-      allocateMemory_(!shallowCopy) {
-
-      if (shallowCopy) {
-        data_           = data.data_;
-        allocateMemory_ = false;
-      } else {
-        data_ = new T[rows_ * cols_];
-        for (int i = 0; i < rows_ * cols_; i++) {
-          data_[i] = data.data_[i];
-        }
-        allocateMemory_ = true;
-      }
+    Float2D(const Float2D<T>& other):
+      rows_(other.rows_),
+      cols_(other.cols_),
+      stride_(other.stride_),
+      data_(nullptr),
+      allocateMemory_(true) {
+
+      allocate(MemoryLayout{other.stride_ != other.rows_, MemoryLayout::getDefault().hugePages});
+      copyFrom(other);
     }
-    Float2D(const Float2D<T>& data, bool shallowCopy):
-      rows_(data.rows_),
-      cols_(data.cols_),
-      allocateMemory_(!shallowCopy) {
-
-      if (shallowCopy) {
-        data_           = data.data_;
-        allocateMemory_ = false;
-      } else {
-        data_ = new T[rows_ * cols_];
-        for (int i = 0; i < rows_ * cols_; i++) {
-          data_[i] = data.data_[i];
-        }
-        allocateMemory_ = true;
+
+    /**
+     * Move constructor:
+     * takes over the memory of other, which is left empty.
+     */
+    Float2D(Float2D<T>&& other) noexcept:
+      rows_(other.rows_),
+      cols_(other.cols_),
+      stride_(other.stride_),
+      data_(other.data_),
+      allocateMemory_(other.allocateMemory_),
+      allocation_(other.allocation_) {
+
+      other.data_           = nullptr;
+      other.allocateMemory_ = false;
+      other.allocation_     = {};
+    }
+
+    ~Float2D() { release(); }
+
+    /**
+     * Copies the values of other. The existing memory is reused if both arrays have the same size,
+     * otherwise this array is replaced by a copy of other.
+     */
+    Float2D<T>& operator=(const Float2D<T>& other) {
+      if (this == &other) {
+        return *this;
+      }
+      if (data_ == nullptr || cols_ != other.cols_ || rows_ != other.rows_) {
+        return *this = Float2D<T>(other);
       }
+      copyFrom(other);
+      return *this;
     }
-    ~Float2D() {
-      if (allocateMemory_) {
-        delete[] data_;
+
+    Float2D<T>& operator=(Float2D<T>&& other) noexcept {
+      if (this == &other) {
+        return *this;
       }
+      release();
+      rows_           = other.rows_;
+      cols_           = other.cols_;
+      stride_         = other.stride_;
+      data_           = other.data_;
+      allocateMemory_ = other.allocateMemory_;
+      allocation_     = other.allocation_;
+
+      other.data_           = nullptr;
+      other.allocateMemory_ = false;
+      other.allocation_     = {};
+      return *this;
     }
 
-    T* operator[](int i) { return (data_ + (rows_ * i)); }
+    T* operator[](int i) { return (data_ + (std::size_t(stride_) * i)); }
 
-    const T* operator[](int i) const { return (data_ + (rows_ * i)); }
+    const T* operator[](int i) const { return (data_ + (std::size_t(stride_) * i)); }
 
     T* getData() { return data_; }
 
@@ -147,9 +218,14 @@ namespace Tools {
 
     int getCols() const { return cols_; }
 
-    Float1D<T> getColProxy(int i) { return Float1D<T>(data_ + (rows_ * i), rows_); }
+    /**
+     * @return distance between the starts of two consecutive columns in elements
+     */
+    int getStride() const { return stride_; }
 
-    Float1D<T> getRowProxy(int j) { return Float1D<T>(data_ + j, cols_, rows_); }
+    Float1D<T> getColProxy(int i) { return Float1D<T>(data_ + (std::size_t(stride_) * i), rows_); }
+
+    Float1D<T> getRowProxy(int j) { return Float1D<T>(data_ + j, cols_, stride_); }
 
     static void toString(const Float2D<T>& toPrint) {
       for (int row = 0; row < toPrint.rows_; row++) {
@@ -161,4 +237,53 @@ namespace Tools {
     }
   };
 
+  /**
+   * Non-owning view of the elements of a Float2D (or of any column-major array with a column stride).
+   * Copying a view never copies elements; the viewed array has to outlive the view.
+   * Float2DView<const T> is the read-only variant and can be created from a const Float2D<T>.
+   */
+  template <class T>
+  class Float2DView {
+  private:
+    using ValueType = std::remove_const_t<T>;
+
+    int rows_;
+    int cols_;
+    int stride_;
+
+    T* data_;
+
+  public:
+    Float2DView():
+      rows_(0),
+      cols_(0),
+      stride_(0),
+      data_(nullptr) {}
+
+    Float2DView(int cols, int rows, int stride, T* data):
+      rows_(rows),
+      cols_(cols),
+      stride_(stride),
+      data_(data) {}
+
+    Float2DView(Float2D<ValueType>& array):
+      Float2DView(array.getCols(), array.getRows(), array.getStride(), array.getData()) {}
+
+    Float2DView(const Float2D<ValueType>& array)
+      requires std::is_const_v<T>
+      : Float2DView(array.getCols(), array.getRows(), array.getStride(), array.getData()) {}
+
+    T* operator[](int i) const { return (data_ + (std::size_t(stride_) * i)); }
+
+    T* getData() const { return data_; }
+
+    int getSize() const { return rows_ * cols_; }
+
+    int getRows() const { return rows_; }
+
+    int getCols() const { return cols_; }
+
+    int getStride() const { return stride_; }
+  };
+
 } // namespace Tools
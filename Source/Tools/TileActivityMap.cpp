@@ -0,0 +1,191 @@
+#include "TileActivityMap.h"
+
+namespace {
+  // Appends the row spans of the tiles ty in [0, tileCount) for which isActive(ty) holds, merging adjacent tiles
+  template <class Predicate>
+  void appendRows(std::vector<Tools::TileActivityMap::Span>& spans, const Tools::TileActivityMap& map, int ny, Predicate isActive) {
+    const std::size_t first = spans.size();
+    for (int ty = 0; ty < map.getTileCountY(); ty++) {
+      if (!isActive(ty)) {
+        continue;
+      }
+      Tools::TileActivityMap::Span rows = map.getRows(ty);
+      if (ty == 0) {
+        rows.begin = 0;
+      }
+      if (ty == map.getTileCountY() - 1) {
+        rows.end = ny + 1;
+      }
+      if (spans.size() > first && spans.back().end + 1 == rows.begin) {
+        spans.back().end = rows.end;
+      } else {
+        spans.push_back(rows);
+      }
+    }
+  }
+} // namespace
+
+void Tools::TileActivityMap::resize(int nx, int ny, int tileSize) {
+  nx_         = nx;
+  ny_         = ny;
+  tileSize_   = tileSize > 0 ? tileSize : std::max(nx, ny);
+  tileCountX_ = (nx + tileSize_ - 1) / tileSize_;
+  tileCountY_ = (ny + tileSize_ - 1) / tileSize_;
+
+  active_.assign(tileCountX_ * tileCountY_, 0);
+  fired_.assign(tileCountX_ * tileCountY_, 0);
+  restWaveSpeedX_.assign(tileCountX_ * tileCountY_, RealType(0.0));
+  restWaveSpeedY_.assign(tileCountX_ * tileCountY_, RealType(0.0));
+  activeTileCount_ = 0;
+}
+
+void Tools::TileActivityMap::setAllActive(int nx, int ny, int tileSize) {
+  resize(nx, ny, tileSize);
+  for (int tx = 0; tx < tileCountX_; tx++) {
+    for (int ty = 0; ty < tileCountY_; ty++) {
+      activate(tx, ty);
+    }
+  }
+  buildRows();
+}
+
+void Tools::TileActivityMap::build(
+  const Float2D<RealType>& h, const Float2D<RealType>& hu, const Float2D<RealType>& hv, const Float2D<RealType>& b, int nx, int ny, int tileSize
+) {
+  resize(nx, ny, tileSize);
+
+  std::vector<int> candidates;
+  for (int tx = 0; tx < tileCountX_; tx++) {
+    for (int ty = 0; ty < tileCountY_; ty++) {
+      if (tx == 0 || ty == 0 || tx == tileCountX_ - 1 || ty == tileCountY_ - 1) {
+        activate(tx, ty);
+      }
+      candidates.push_back(tx * tileCountY_ + ty);
+    }
+  }
+
+  // Every tile can be disturbed by the initial condition, not only the active ones
+  fireDisturbedTiles(candidates, h, hu, hv, b);
+  buildRows();
+}
+
+void Tools::TileActivityMap::activate(int tx, int ty) {
+  char& active = active_[tx * tileCountY_ + ty];
+  if (!active) {
+    active = 1;
+    activeTileCount_++;
+  }
+}
+
+bool Tools::TileActivityMap::isAtRest(
+  const Float2D<RealType>& h, const Float2D<RealType>& hu, const Float2D<RealType>& hv, const Float2D<RealType>& b, int i, int j
+) const {
+  // Dry cells never change
+  if (h[i][j] <= RealType(0.0)) {
+    return true;
+  }
+  if (hu[i][j] != RealType(0.0) || hv[i][j] != RealType(0.0)) {
+    return false;
+  }
+
+  const RealType eta          = h[i][j] + b[i][j];
+  auto           sameElevation = [&](int k, int l) {
+    return k < 1 || k > nx_ || l < 1 || l > ny_ || h[k][l] <= RealType(0.0) || h[k][l] + b[k][l] == eta;
+  };
+  return sameElevation(i - 1, j) && sameElevation(i + 1, j) && sameElevation(i, j - 1) && sameElevation(i, j + 1);
+}
+
+bool Tools::TileActivityMap::update(const Float2D<RealType>& h, const Float2D<RealType>& hu, const Float2D<RealType>& hv, const Float2D<RealType>& b) {
+  if (isAllActive()) {
+    return false;
+  }
+
+  // Tiles that may fire: active, but not fired yet
+  std::vector<int> candidates;
+  for (int tile = 0; tile < tileCountX_ * tileCountY_; tile++) {
+    if (active_[tile] && !fired_[tile]) {
+      candidates.push_back(tile);
+    }
+  }
+
+  const int activeTileCount = activeTileCount_;
+  fireDisturbedTiles(candidates, h, hu, hv, b);
+  if (activeTileCount_ == activeTileCount) {
+    return false;
+  }
+  buildRows();
+  return true;
+}
+
+void Tools::TileActivityMap::fireDisturbedTiles(
+  const std::vector<int>& candidates, const Float2D<RealType>& h, const Float2D<RealType>& hu, const Float2D<RealType>& hv, const Float2D<RealType>& b
+) {
+  std::vector<char> fire(candidates.size(), 0);
+
+#if defined(ENABLE_OPENMP)
+#pragma omp parallel for schedule(dynamic)
+#endif
+  for (std::size_t k = 0; k < candidates.size(); k++) {
+    const Span columns = getColumns(candidates[k] / tileCountY_);
+    const Span rows    = getRows(candidates[k] % tileCountY_);
+    for (int i = columns.begin; i <= columns.end && !fire[k]; i++) {
+      for (int j = rows.begin; j <= rows.end; j++) {
+        if (!isAtRest(h, hu, hv, b, i, j)) {
+          fire[k] = 1;
+          break;
+        }
+      }
+    }
+  }
+
+  for (std::size_t k = 0; k < candidates.size(); k++) {
+    if (!fire[k]) {
+      continue;
+    }
+    const int tx = candidates[k] / tileCountY_;
+    const int ty = candidates[k] % tileCountY_;
+    fired_[candidates[k]] = 1;
+    for (int kx = std::max(tx - 1, 0); kx <= std::min(tx + 1, tileCountX_ - 1); kx++) {
+      for (int ky = std::max(ty - 1, 0); ky <= std::min(ty + 1, tileCountY_ - 1); ky++) {
+        activate(kx, ky);
+      }
+    }
+  }
+}
+
+void Tools::TileActivityMap::buildRows() {
+  cellRows_.clear();
+  borderRows_.clear();
+  yEdgeRows_.clear();
+  cellRowOffsets_.assign(1, 0);
+  borderRowOffsets_.assign(1, 0);
+  yEdgeRowOffsets_.assign(1, 0);
+
+  for (int tx = 0; tx < tileCountX_; tx++) {
+    appendRows(cellRows_, *this, ny_, [&](int ty) { return isActive(tx, ty); });
+    cellRowOffsets_.push_back(int(cellRows_.size()));
+
+    // The x-edges between the last column of tile column tx and the first one of tx + 1
+    appendRows(borderRows_, *this, ny_, [&](int ty) { return isActive(tx, ty) || (tx + 1 < tileCountX_ && isActive(tx + 1, ty)); });
+    borderRowOffsets_.push_back(int(borderRows_.size()));
+
+    // The y-edge j touches the rows j and j + 1
+    for (int k = cellRowOffsets_[tx]; k < cellRowOffsets_[tx + 1]; k++) {
+      yEdgeRows_.push_back({std::max(cellRows_[k].begin - 1, 0), std::min(cellRows_[k].end, ny_)});
+    }
+    yEdgeRowOffsets_.push_back(int(yEdgeRows_.size()));
+  }
+}
+
+RealType Tools::TileActivityMap::getInactiveWaveSpeed(const std::vector<RealType>& restWaveSpeed) const {
+  RealType maxWaveSpeed = RealType(0.0);
+  if (isAllActive()) {
+    return maxWaveSpeed;
+  }
+  for (int tile = 0; tile < tileCountX_ * tileCountY_; tile++) {
+    if (!active_[tile]) {
+      maxWaveSpeed = std::max(maxWaveSpeed, restWaveSpeed[tile]);
+    }
+  }
+  return maxWaveSpeed;
+}
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <algorithm>
+#include <span>
+#include <vector>
+
+#include "RealType.hpp"
+#include "WetMask.h"
+
+namespace Tools {
+
+  /**
+   * @class TileActivityMap
+   * @brief Splits a nx * ny block into square tiles and tracks which of them have to be swept.
+   *
+   * A cell is at rest if it has no momentum and the same surface elevation h + b as all of its wet neighbours, so all
+   * of its edges produce exactly zero net updates (see the lake-at-rest exit of the solvers). A tile is inactive as
+   * long as it and its eight neighbours contain only cells at rest; its cells cannot change then. As soon as an active
+   * tile contains a cell that is not at rest, the tile "fires" and activates its neighbours. Tiles never become
+   * inactive again, and tiles at the boundary of the block are always active because the ghost layer is written
+   * from outside.
+   *
+   * The rows that have to be processed are stored as Tools::WetMask::Span lists per column of tiles, so the sweeps
+   * can intersect them with the wet mask. The first and last tile row also cover the ghost rows 0 and ny + 1, the
+   * first and last tile column cover the ghost columns.
+   *
+   * To keep the time step of a sweep over all tiles, the maximum wave speed of the edges owned by each tile is stored
+   * when the map is built. The state of an inactive tile does not change, so its stored speed stays valid.
+   */
+  class TileActivityMap {
+  public:
+    using Span = WetMask::Span;
+
+    /**
+     * @brief Marks every tile of a nx * ny block as active. A tile size of 0 uses a single tile.
+     */
+    void setAllActive(int nx, int ny, int tileSize = 0);
+
+    /**
+     * @brief Builds the map of a nx * ny block from its current state.
+     *
+     * The tiles at the boundary and all tiles that contain or neighbour a cell that is not at rest are active.
+     */
+    void build(const Float2D<RealType>& h, const Float2D<RealType>& hu, const Float2D<RealType>& hv, const Float2D<RealType>& b, int nx, int ny, int tileSize);
+
+    /**
+     * @brief Activates every tile that contains a cell that is not at rest, together with its neighbours.
+     *
+     * Only active tiles that did not fire yet are checked.
+     *
+     * @return whether a tile was activated
+     */
+    bool update(const Float2D<RealType>& h, const Float2D<RealType>& hu, const Float2D<RealType>& hv, const Float2D<RealType>& b);
+
+    int  getTileSize() const { return tileSize_; }
+    int  getTileCountX() const { return tileCountX_; }
+    int  getTileCountY() const { return tileCountY_; }
+    bool isActive(int tx, int ty) const { return active_[tx * tileCountY_ + ty] != 0; }
+    bool isAllActive() const { return activeTileCount_ == tileCountX_ * tileCountY_; }
+    int  getActiveTileCount() const { return activeTileCount_; }
+
+    /**
+     * @brief Tile column/row of block column/row i, the ghost layer belongs to the tiles at the boundary.
+     */
+    int getTileX(int i) const { return (std::clamp(i, 1, nx_) - 1) / tileSize_; }
+    int getTileY(int j) const { return (std::clamp(j, 1, ny_) - 1) / tileSize_; }
+
+    /**
+     * @brief Range of block columns/rows [begin, end] covered by tile column/row t, without the ghost layer.
+     */
+    Span getColumns(int tx) const { return {tx * tileSize_ + 1, std::min((tx + 1) * tileSize_, nx_)}; }
+    Span getRows(int ty) const { return {ty * tileSize_ + 1, std::min((ty + 1) * tileSize_, ny_)}; }
+
+    /**
+     * @brief Rows of the active cells in column i.
+     */
+    std::span<const Span> getCellRows(int i) const { return column(cellRows_, cellRowOffsets_, getTileX(i)); }
+
+    /**
+     * @brief Rows of the x-edges between column i and i + 1 with an active cell on at least one side.
+     */
+    std::span<const Span> getXEdgeRows(int i) const {
+      const int tx = getTileX(i);
+      return tx == getTileX(i + 1) ? column(cellRows_, cellRowOffsets_, tx) : column(borderRows_, borderRowOffsets_, tx);
+    }
+
+    /**
+     * @brief Rows j of the y-edges between row j and j + 1 of column i with an active cell on at least one side.
+     */
+    std::span<const Span> getYEdgeRows(int i) const { return column(yEdgeRows_, yEdgeRowOffsets_, getTileX(i)); }
+
+    /**
+     * @brief Stores the maximum wave speeds of the x- and y-edges owned by tile (tx, ty).
+     *
+     * Tile (tx, ty) owns the x-edges between column i and i + 1 and the y-edges between row j and j + 1 for i and j
+     * in its columns and rows; the tiles at the boundary also own the edges to the left and bottom ghost layer.
+     */
+    void setRestWaveSpeed(int tx, int ty, RealType speedX, RealType speedY) {
+      restWaveSpeedX_[tx * tileCountY_ + ty] = speedX;
+      restWaveSpeedY_[tx * tileCountY_ + ty] = speedY;
+    }
+
+    /**
+     * @brief Maximum of the stored x-/y-wave speeds of all inactive tiles.
+     */
+    RealType getInactiveWaveSpeedX() const { return getInactiveWaveSpeed(restWaveSpeedX_); }
+    RealType getInactiveWaveSpeedY() const { return getInactiveWaveSpeed(restWaveSpeedY_); }
+
+  private:
+    int nx_              = 0;
+    int ny_              = 0;
+    int tileSize_        = 1;
+    int tileCountX_      = 0;
+    int tileCountY_      = 0;
+    int activeTileCount_ = 0;
+
+    // per tile, column-major like the blocks
+    std::vector<char>     active_;
+    std::vector<char>     fired_;
+    std::vector<RealType> restWaveSpeedX_;
+    std::vector<RealType> restWaveSpeedY_;
+
+    // spans per tile column, the spans of tile column tx are [offsets[tx], offsets[tx + 1])
+    std::vector<Span> cellRows_;
+    std::vector<int>  cellRowOffsets_;
+    std::vector<Span> borderRows_;
+    std::vector<int>  borderRowOffsets_;
+    std::vector<Span> yEdgeRows_;
+    std::vector<int>  yEdgeRowOffsets_;
+
+    void resize(int nx, int ny, int tileSize);
+    void activate(int tx, int ty);
+    bool isAtRest(const Float2D<RealType>& h, const Float2D<RealType>& hu, const Float2D<RealType>& hv, const Float2D<RealType>& b, int i, int j) const;
+    void buildRows();
+    RealType getInactiveWaveSpeed(const std::vector<RealType>& restWaveSpeed) const;
+    void fireDisturbedTiles(
+      const std::vector<int>& candidates, const Float2D<RealType>& h, const Float2D<RealType>& hu, const Float2D<RealType>& hv, const Float2D<RealType>& b
+    );
+
+    static std::span<const Span> column(const std::vector<Span>& spans, const std::vector<int>& offsets, int tx) {
+      return {spans.data() + offsets[tx], spans.data() + offsets[tx + 1]};
+    }
+  };
+
+} // namespace Tools
@@ -50,6 +50,17 @@ void Tools::WarningSystem::setUsed(bool newUsed) {
   this->used = newUsed;
 }
 
+void Tools::WarningSystem::setExpectedArrival(double time) {
+  expectedArrival = time;
+  if(used) {
+    if(std::isinf(time)) {
+      std::cout << "The wave is not expected to reach the destination" << std::endl;
+    } else {
+      std::cout << "The wave is expected to reach the destination after " << time << " seconds" << std::endl;
+    }
+  }
+}
+
 bool Tools::WarningSystem::update(double waterHeight, double time) {
   if(used) {
     if(biggestDifference < std::abs(originalLevel - waterHeight)) {
@@ -57,6 +68,9 @@ bool Tools::WarningSystem::update(double waterHeight, double time) {
       biggestTime = time;
     }
     if(std::abs(originalLevel - waterHeight) >= threshold) {
+      if(!alarmed && expectedArrival >= 0 && !std::isinf(expectedArrival)) {
+        std::cout << "The wave arrived at time " << time << " seconds, expected after " << expectedArrival << " seconds" << std::endl;
+      }
       Tools::Logger::logger.printAlarm(std::abs(originalLevel - waterHeight));
       alarmed = true;
     } else {
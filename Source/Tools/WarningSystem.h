@@ -51,6 +51,7 @@ namespace Tools {
    double threshold;  /**< Threshold value for triggering warnings. */
    bool used;  /**< Flag indicating if the warning system is actively used. */
    bool alarmed; /**< Flag indicating if the warning system has been triggered. */
+   double expectedArrival = -1; /**< Estimated arrival time of the wave, negative if unknown. */
 
  public:
 
@@ -94,6 +95,13 @@ namespace Tools {
     */
    void setUsed(bool newUsed);
 
+   /**
+         * @brief Set the estimated arrival time of the wave at the destination and announce it.
+         *
+         * @param time The estimated arrival time in seconds, infinite if the wave does not reach the destination.
+    */
+   void setExpectedArrival(double time);
+
    /**
          * @brief Update the warning system based on the current water height.
          *
@@ -0,0 +1,82 @@
+#include "WetMask.h"
+
+namespace {
+  // Appends the runs of rows [0, rows) for which isWet(j) holds
+  template <class Predicate>
+  void appendRuns(std::vector<Tools::WetMask::Span>& spans, int rows, Predicate isWet) {
+    int begin = -1;
+    for (int j = 0; j < rows; j++) {
+      if (isWet(j)) {
+        if (begin < 0) {
+          begin = j;
+        }
+      } else if (begin >= 0) {
+        spans.push_back({begin, j - 1});
+        begin = -1;
+      }
+    }
+    if (begin >= 0) {
+      spans.push_back({begin, rows - 1});
+    }
+  }
+} // namespace
+
+void Tools::WetMask::setAllWet(int nx, int ny) {
+  nx_           = nx;
+  ny_           = ny;
+  wetCellCount_ = long(nx) * ny;
+
+  cellSpans_.assign(nx + 2, {0, ny + 1});
+  xEdgeSpans_.assign(nx + 1, {0, ny + 1});
+  yEdgeSpans_.assign(nx + 2, {0, ny});
+  cellOffsets_.resize(nx + 3);
+  xEdgeOffsets_.resize(nx + 2);
+  yEdgeOffsets_.resize(nx + 3);
+  for (int i = 0; i <= nx + 2; i++) {
+    cellOffsets_[i] = i;
+    yEdgeOffsets_[i] = i;
+  }
+  for (int i = 0; i <= nx + 1; i++) {
+    xEdgeOffsets_[i] = i;
+  }
+}
+
+void Tools::WetMask::build(const Float2D<RealType>& h, int nx, int ny) {
+  nx_           = nx;
+  ny_           = ny;
+  wetCellCount_ = 0;
+
+  auto wet = [&](int i, int j) { return i == 0 || i == nx + 1 || j == 0 || j == ny + 1 || h[i][j] > RealType(0.0); };
+
+  cellSpans_.clear();
+  xEdgeSpans_.clear();
+  yEdgeSpans_.clear();
+  cellOffsets_.assign(1, 0);
+  xEdgeOffsets_.assign(1, 0);
+  yEdgeOffsets_.assign(1, 0);
+
+  for (int i = 0; i <= nx + 1; i++) {
+    appendRuns(cellSpans_, ny + 2, [&](int j) { return wet(i, j); });
+    cellOffsets_.push_back(int(cellSpans_.size()));
+
+    appendRuns(yEdgeSpans_, ny + 1, [&](int j) { return wet(i, j) || wet(i, j + 1); });
+    yEdgeOffsets_.push_back(int(yEdgeSpans_.size()));
+
+    if (i <= nx) {
+      appendRuns(xEdgeSpans_, ny + 2, [&](int j) { return wet(i, j) || wet(i + 1, j); });
+      xEdgeOffsets_.push_back(int(xEdgeSpans_.size()));
+    }
+
+    if (i >= 1 && i <= nx) {
+      for (int j = 1; j <= ny; j++) {
+        wetCellCount_ += h[i][j] > RealType(0.0);
+      }
+    }
+  }
+}
+
+bool Tools::WetMask::isWet(int i, int j) const {
+  const auto spans = getCellSpans(i);
+  const auto span  = std::upper_bound(spans.begin(), spans.end(), j, [](int row, const Span& s) { return row < s.begin; });
+  return span != spans.begin() && std::prev(span)->end >= j;
+}
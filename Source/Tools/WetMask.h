@@ -0,0 +1,113 @@
+#pragma once
+
+#include <algorithm>
+#include <span>
+#include <vector>
+
+#include "Float2D.hpp"
+#include "RealType.hpp"
+
+namespace Tools {
+
+  /**
+   * @class WetMask
+   * @brief Run-length encoded per-column lists of the cells and edges that can change during a simulation.
+   *
+   * A cell with h <= 0 is dry. The solvers treat dry cells as reflecting walls and never update them, so a cell
+   * that is dry after the initialisation stays dry for the whole run (land in a GEBCO scenario). An edge between two
+   * dry cells produces neither net updates nor a wave speed and can be skipped. Ghost cells are always considered
+   * wet, as boundary conditions and neighbouring blocks write them.
+   *
+   * For every column three lists of inclusive row intervals are stored:
+   * - the wet cells of column i, for i in [0, nx + 1],
+   * - the x-edges between column i and i + 1 with at least one wet side, for i in [0, nx],
+   * - the y-edges between row j and j + 1 of column i with at least one wet side, for i in [0, nx + 1].
+   */
+  class WetMask {
+  public:
+    /**
+     * @brief Inclusive interval [begin, end] of rows.
+     */
+    struct Span {
+      int begin;
+      int end;
+    };
+
+    /**
+     * @brief Marks every cell of a nx * ny block (plus ghost layer) as wet.
+     */
+    void setAllWet(int nx, int ny);
+
+    /**
+     * @brief Builds the spans from the water height of a nx * ny block (plus ghost layer).
+     */
+    void build(const Float2D<RealType>& h, int nx, int ny);
+
+    std::span<const Span> getCellSpans(int i) const { return column(cellSpans_, cellOffsets_, i); }
+    std::span<const Span> getXEdgeSpans(int i) const { return column(xEdgeSpans_, xEdgeOffsets_, i); }
+    std::span<const Span> getYEdgeSpans(int i) const { return column(yEdgeSpans_, yEdgeOffsets_, i); }
+
+    /**
+     * @brief Whether cell (i, j) is wet, including the ghost layer.
+     */
+    bool isWet(int i, int j) const;
+
+    /**
+     * @brief Number of wet cells inside the computational domain.
+     */
+    long getWetCellCount() const { return wetCellCount_; }
+
+    /**
+     * @brief Calls f(begin, end) for every part of the spans that overlaps the rows [lo, hi].
+     */
+    template <class F>
+    static void forEachSpan(std::span<const Span> spans, int lo, int hi, F&& f) {
+      for (const Span& span : spans) {
+        const int begin = std::max(span.begin, lo);
+        const int end   = std::min(span.end, hi);
+        if (begin <= end) {
+          f(begin, end);
+        }
+      }
+    }
+
+    /**
+     * @brief Calls f(begin, end) for every part of the intersection of two span lists that overlaps the rows [lo, hi].
+     */
+    template <class F>
+    static void forEachSpan(std::span<const Span> first, std::span<const Span> second, int lo, int hi, F&& f) {
+      auto a = first.begin();
+      auto b = second.begin();
+      while (a != first.end() && b != second.end()) {
+        const int begin = std::max({a->begin, b->begin, lo});
+        const int end   = std::min({a->end, b->end, hi});
+        if (begin <= end) {
+          f(begin, end);
+        }
+        if (a->end < b->end) {
+          ++a;
+        } else {
+          ++b;
+        }
+      }
+    }
+
+  private:
+    int  nx_           = 0;
+    int  ny_           = 0;
+    long wetCellCount_ = 0;
+
+    // spans of all columns, the spans of column i are [offsets[i], offsets[i + 1])
+    std::vector<Span> cellSpans_;
+    std::vector<int>  cellOffsets_;
+    std::vector<Span> xEdgeSpans_;
+    std::vector<int>  xEdgeOffsets_;
+    std::vector<Span> yEdgeSpans_;
+    std::vector<int>  yEdgeOffsets_;
+
+    static std::span<const Span> column(const std::vector<Span>& spans, const std::vector<int>& offsets, int i) {
+      return {spans.data() + offsets[i], spans.data() + offsets[i + 1]};
+    }
+  };
+
+} // namespace Tools
@@ -115,7 +115,7 @@ Writers::NetCDFWriter::NetCDFWriter(
   nc_def_var(dataFile_, "boundary", NC_INT, 0, nullptr, &boundaryVar);
   ncPutAttText(boundaryVar, "long_name", "Boundary types");
   ncPutAttText(boundaryVar, "description", "left, right, bottom, top");
-  ncPutAttText(boundaryVar, "values", "1: outflow, 2: wall");
+  ncPutAttText(boundaryVar, "values", "1: outflow, 2: wall, 3: periodic");
 
 
   // Set attributes to match CF-1.5 convention
@@ -201,7 +201,7 @@ Writers::NetCDFWriter::NetCDFWriter(const std::string& fileName, int nx, int ny,
 
 Writers::NetCDFWriter::~NetCDFWriter() { nc_close(dataFile_); }
 
-void Writers::NetCDFWriter::writeVarTimeDependent(const Tools::Float2D<RealType>& matrix, int ncVariable) {
+void Writers::NetCDFWriter::writeVarTimeDependent(Tools::Float2DView<const RealType> matrix, int ncVariable) {
   // Write column wise, necessary to get rid of the boundary
   // Storage in Float2D is column wise
   // Read carefully, the dimensions are confusing
@@ -214,7 +214,7 @@ void Writers::NetCDFWriter::writeVarTimeDependent(const Tools::Float2D<RealType>
   }
 }
 
-void Writers::NetCDFWriter::writeVarTimeIndependent(const Tools::Float2D<RealType>& matrix, int ncVariable) {
+void Writers::NetCDFWriter::writeVarTimeIndependent(Tools::Float2DView<const RealType> matrix, int ncVariable) {
   // Write column wise, necessary to get rid of the boundary
   // Storage in Float2D is column wise
   // Read carefully, the dimensions are confusing
@@ -253,4 +253,94 @@ void Writers::NetCDFWriter::writeTimeStep(const Tools::Float2D<RealType>& h, con
   }
 }
 
+void Writers::NetCDFWriter::writePatch(
+  const std::string&              name,
+  int                             level,
+  const Tools::Float2D<RealType>& h,
+  const Tools::Float2D<RealType>& hu,
+  const Tools::Float2D<RealType>& hv,
+  const Tools::Float2D<RealType>& b,
+  RealType                        originX,
+  RealType                        originY,
+  RealType                        dX,
+  RealType                        dY,
+  double                          time
+) {
+  auto patchGroup = patchGroups_.find(name);
+  if (patchGroup == patchGroups_.end()) {
+    PatchGroup patch{};
+    patch.nX = h.getCols() - 2;
+    patch.nY = h.getRows() - 2;
+    const int status = nc_def_grp(dataFile_, name.c_str(), &patch.group);
+    if (status == NC_ENAMEINUSE) {
+      // A checkpoint restart reopens the file with the group, the time steps are appended like in the root group
+      nc_inq_grp_ncid(dataFile_, name.c_str(), &patch.group);
+      int         l_timeDim;
+      std::size_t timeDim;
+      nc_inq_dimid(patch.group, "time", &l_timeDim);
+      nc_inq_dimlen(patch.group, l_timeDim, &timeDim);
+      patch.timeStep = static_cast<int>(timeDim);
+
+      nc_inq_varid(patch.group, "time", &patch.timeVar);
+      nc_inq_varid(patch.group, "h", &patch.hVar);
+      nc_inq_varid(patch.group, "hu", &patch.huVar);
+      nc_inq_varid(patch.group, "hv", &patch.hvVar);
+    } else {
+      assert(status == NC_NOERR);
+      nc_put_att_int(patch.group, NC_GLOBAL, "level", NC_INT, 1, &level);
+
+      // Same layout as the root group
+      int l_timeDim, l_xDim, l_yDim;
+      nc_def_dim(patch.group, "time", NC_UNLIMITED, &l_timeDim);
+      nc_def_dim(patch.group, "x", patch.nX, &l_xDim);
+      nc_def_dim(patch.group, "y", patch.nY, &l_yDim);
+
+      int l_xVar, l_yVar, l_bVar;
+      nc_def_var(patch.group, "time", NC_FLOAT, 1, &l_timeDim, &patch.timeVar);
+      nc_put_att_text(patch.group, patch.timeVar, "units", strlen("seconds since simulation start"), "seconds since simulation start");
+      nc_def_var(patch.group, "x", NC_FLOAT, 1, &l_xDim, &l_xVar);
+      nc_def_var(patch.group, "y", NC_FLOAT, 1, &l_yDim, &l_yVar);
+
+      int dims[] = {l_timeDim, l_yDim, l_xDim};
+      nc_def_var(patch.group, "h", NC_FLOAT, 3, dims, &patch.hVar);
+      nc_def_var(patch.group, "hu", NC_FLOAT, 3, dims, &patch.huVar);
+      nc_def_var(patch.group, "hv", NC_FLOAT, 3, dims, &patch.hvVar);
+      nc_def_var(patch.group, "b", NC_FLOAT, 2, &dims[1], &l_bVar);
+
+      for (std::size_t i = 0; i < std::size_t(patch.nX); i++) {
+        const float gridPosition = originX + (i + (float).5) * dX;
+        nc_put_var1_float(patch.group, l_xVar, &i, &gridPosition);
+      }
+      for (std::size_t j = 0; j < std::size_t(patch.nY); j++) {
+        const float gridPosition = originY + (j + (float).5) * dY;
+        nc_put_var1_float(patch.group, l_yVar, &j, &gridPosition);
+      }
+
+      std::size_t start[] = {0, 0};
+      std::size_t count[] = {static_cast<std::size_t>(patch.nY), 1};
+      for (int col = 0; col < patch.nX; col++) {
+        start[1] = col;
+        nc_put_vara_double(patch.group, l_bVar, start, count, &b[col + 1][1]);
+      }
+    }
+
+    patchGroup = patchGroups_.emplace(name, patch).first;
+  }
+  PatchGroup& patch = patchGroup->second;
+
+  std::size_t timeStep = patch.timeStep;
+  nc_put_var1_double(patch.group, patch.timeVar, &timeStep, &time);
+
+  // Column wise without the ghost layer, as in writeVarTimeDependent
+  std::size_t start[] = {timeStep, 0, 0};
+  std::size_t count[] = {1, static_cast<std::size_t>(patch.nY), 1};
+  for (int col = 0; col < patch.nX; col++) {
+    start[2] = col;
+    nc_put_vara_double(patch.group, patch.hVar, start, count, &h[col + 1][1]);
+    nc_put_vara_double(patch.group, patch.huVar, start, count, &hu[col + 1][1]);
+    nc_put_vara_double(patch.group, patch.hvVar, start, count, &hv[col + 1][1]);
+  }
+  patch.timeStep++;
+}
+
 #endif
@@ -29,6 +29,9 @@
 
 #pragma once
 
+#include <map>
+#include <string>
+
 #include "Writer.hpp"
 
 namespace Writers {
@@ -46,6 +49,15 @@ namespace Writers {
     /** Flush after every x write operation? */
     unsigned int flush_;
 
+    /** Group of a refined patch, see writePatch. */
+    struct PatchGroup {
+      int group;
+      int timeVar, hVar, huVar, hvVar;
+      int nX, nY;
+      int timeStep;
+    };
+    std::map<std::string, PatchGroup> patchGroups_;
+
     /**
      * Writes time dependent data to a netCDF-file (-> constructor) with respect to the boundary sizes.
      *
@@ -58,7 +70,7 @@ namespace Writers {
      * @param boundarySize size of the boundaries.
      * @param ncVariable time dependent netCDF-variable to which the output is written to.
      */
-    void writeVarTimeDependent(const Tools::Float2D<RealType>& matrix, int ncVariable);
+    void writeVarTimeDependent(Tools::Float2DView<const RealType> matrix, int ncVariable);
 
     /**
      * Write time independent data to a netCDF-file (-> constructor) with respect to the boundary sizes.
@@ -72,7 +84,7 @@ namespace Writers {
      * @param boundarySize size of the boundaries.
      * @param ncVariable time independent netCDF-variable to which the output is written to.
      */
-    void writeVarTimeIndependent(const Tools::Float2D<RealType>& matrix, int ncVariable);
+    void writeVarTimeIndependent(Tools::Float2DView<const RealType> matrix, int ncVariable);
 
     /**
      * This is a small wrapper for `nc_put_att_text` which automatically sets the length.
@@ -121,6 +133,31 @@ namespace Writers {
      * @param time simulation time of the time step.
      */
     void writeTimeStep(const Tools::Float2D<RealType>& h, const Tools::Float2D<RealType>& hu, const Tools::Float2D<RealType>& hv, double time) override;
+
+    /**
+     * Writes a refined patch of an adaptive mesh (see Blocks::AdaptiveMesh) into the netCDF-4 group of the same name.
+     * The group is created on the first call with its own time dimension, grid coordinates and bathymetry, so patches
+     * can appear and disappear between two time steps: a group only contains the time steps at which its patch existed.
+     *
+     * @param name name of the group.
+     * @param level refinement level of the patch, stored as attribute of the group.
+     * @param h, hu, hv, b unknowns and bathymetry of the patch, with a ghost layer of one cell.
+     * @param originX, originY, dX, dY origin and mesh size of the patch.
+     * @param time simulation time of the time step.
+     */
+    void writePatch(
+      const std::string&              name,
+      int                             level,
+      const Tools::Float2D<RealType>& h,
+      const Tools::Float2D<RealType>& hu,
+      const Tools::Float2D<RealType>& hv,
+      const Tools::Float2D<RealType>& b,
+      RealType                        originX,
+      RealType                        originY,
+      RealType                        dX,
+      RealType                        dY,
+      double                          time
+    );
   };
 
 #endif
@@ -61,8 +61,9 @@ namespace Writers {
     const int nX_;
     const int nY_;
 
-    const Tools::Float2D<RealType>& bathymetry_;
-    const BoundarySize              boundarySize_;
+    //! not copied, the bathymetry has to outlive the writer
+    const Tools::Float2DView<const RealType> bathymetry_;
+    const BoundarySize                       boundarySize_;
 
     int timeStep_;
 
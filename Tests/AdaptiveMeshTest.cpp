@@ -0,0 +1,159 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <cmath>
+
+#include "Blocks/AdaptiveMesh.h"
+#include "Scenarios/RadialDamBreakScenario.hpp"
+
+namespace {
+  /**
+   * Sea floor rising from -200 m on the left to a beach on the right, optionally with a hump of water.
+   */
+  class BeachScenario: public Scenarios::Scenario {
+  public:
+    explicit BeachScenario(RealType hump):
+      hump_(hump) {}
+
+    RealType getWaterHeight(RealType x, RealType y) const override {
+      const RealType distance = std::sqrt((x - 2500) * (x - 2500) + (y - 5000) * (y - 5000));
+      return std::max(-getBathymetry(x, y), RealType(0.0)) + (distance < 1000 ? hump_ : RealType(0.0));
+    }
+    RealType getBathymetry(RealType x, [[maybe_unused]] RealType y) const override { return -200 + RealType(0.03) * x; }
+
+    BoundaryType getBoundaryType([[maybe_unused]] BoundaryEdge edge) const override { return BoundaryType::Outflow; }
+    RealType     getBoundaryPos(BoundaryEdge edge) const override {
+      return edge == BoundaryEdge::Left || edge == BoundaryEdge::Bottom ? RealType(0.0) : RealType(10000.0);
+    }
+
+  private:
+    RealType hump_;
+  };
+
+  Blocks::AdaptiveMesh<>::Parameters getParameters() {
+    Blocks::AdaptiveMesh<>::Parameters parameters;
+    parameters.levels             = 3;
+    parameters.patchSize          = 8;
+    parameters.regridInterval     = 2;
+    parameters.bathymetryGradient = 0.01;
+    return parameters;
+  }
+} // namespace
+
+TEST_CASE("Adaptive mesh refinement") {
+  const int      size     = 64;
+  const RealType cellSize = 10000.0 / size;
+
+  SECTION("A single level is the base block") {
+    Scenarios::RadialDamBreakScenario scenario;
+    Blocks::DimensionalSplitting<>    uniform(size, size, 1000.0 / size, 1000.0 / size);
+    Blocks::DimensionalSplitting<>    base(size, size, 1000.0 / size, 1000.0 / size);
+    uniform.initialiseScenario(0, 0, scenario);
+    base.initialiseScenario(0, 0, scenario);
+
+    Blocks::AdaptiveMesh<>::Parameters parameters;
+    parameters.levels = 1;
+    Blocks::AdaptiveMesh<> mesh(base, scenario, 0, 0, 1000.0 / size, 1000.0 / size, parameters);
+
+    for (int step = 0; step < 20; step++) {
+      uniform.setGhostLayer();
+      REQUIRE(mesh.simulateTimeStep() == uniform.simulateTimeStep());
+    }
+    for (int i = 1; i <= size; i++) {
+      for (int j = 1; j <= size; j++) {
+        REQUIRE(base.getWaterHeight()[i][j] == uniform.getWaterHeight()[i][j]);
+      }
+    }
+  }
+
+  SECTION("A lake at rest stays at rest on all levels") {
+    BeachScenario                  scenario(0.0);
+    Blocks::DimensionalSplitting<> base(size, size, cellSize, cellSize);
+    base.initialiseScenario(0, 0, scenario);
+
+    // Refine everything that is wet
+    Blocks::AdaptiveMesh<>::Parameters parameters = getParameters();
+    parameters.waveThreshold                      = -1;
+    Blocks::AdaptiveMesh<> mesh(base, scenario, 0, 0, cellSize, cellSize, parameters);
+    REQUIRE(mesh.getPatchCount(1) > 0);
+    REQUIRE(mesh.getPatchCount(2) > 0);
+
+    // The wave speeds at rest are zero, the time step satisfies the CFL condition of the finest level
+    for (int step = 0; step < 10; step++) {
+      mesh.simulateTimeStep(1.0);
+    }
+
+    std::vector<Blocks::DimensionalSplitting<>*> blocks{&base};
+    for (const auto* patch : mesh.getPatches()) {
+      blocks.push_back(&patch->getBlock());
+    }
+    for (auto* block : blocks) {
+      for (int i = 1; i <= block->getNx(); i++) {
+        for (int j = 1; j <= block->getNy(); j++) {
+          const RealType h = block->getWaterHeight()[i][j];
+          if (h > 0) {
+            REQUIRE_THAT(h + block->getBathymetry()[i][j], Catch::Matchers::WithinAbs(0.0, 1e-10));
+          }
+          REQUIRE_THAT(block->getDischargeHu()[i][j], Catch::Matchers::WithinAbs(0.0, 1e-10));
+          REQUIRE_THAT(block->getDischargeHv()[i][j], Catch::Matchers::WithinAbs(0.0, 1e-10));
+        }
+      }
+    }
+  }
+
+  SECTION("The patches follow the wave") {
+    BeachScenario                  scenario(2.0);
+    Blocks::DimensionalSplitting<> base(size, size, cellSize, cellSize);
+    base.initialiseScenario(0, 0, scenario);
+    Blocks::AdaptiveMesh<>::Parameters parameters = getParameters();
+    parameters.levels                             = 2;
+    Blocks::AdaptiveMesh<> mesh(base, scenario, 0, 0, cellSize, cellSize, parameters);
+
+    // Only the hump is refined at first
+    const int initialPatches = mesh.getPatchCount(1);
+    REQUIRE(initialPatches > 0);
+    for (const auto* patch : mesh.getPatches()) {
+      REQUIRE(patch->getOffsetX() < 5000);
+    }
+
+    // Uniform grids at the resolution of both levels
+    Blocks::DimensionalSplitting<> coarse(size, size, cellSize, cellSize);
+    Blocks::DimensionalSplitting<> fine(2 * size, 2 * size, cellSize / 2, cellSize / 2);
+    coarse.initialiseScenario(0, 0, scenario);
+    fine.initialiseScenario(0, 0, scenario);
+
+    for (int step = 0; step < 120; step++) {
+      mesh.simulateTimeStep(0.5);
+      coarse.setGhostLayer();
+      coarse.simulateTimeStep(0.5);
+      for (int substep = 0; substep < 2; substep++) {
+        fine.setGhostLayer();
+        fine.simulateTimeStep(0.25);
+      }
+    }
+    REQUIRE(mesh.getPatchCount(1) > initialPatches);
+    REQUIRE(mesh.getCellUpdates() < mesh.getUniformCellUpdates());
+
+    // Compared to the averaged fine grid, the refined levels are much closer than the coarse grid
+    RealType meshError   = 0;
+    RealType coarseError = 0;
+    for (int i = 1; i <= size; i++) {
+      for (int j = 1; j <= size; j++) {
+        RealType averaged = 0;
+        for (int fineI = 2 * i - 1; fineI <= 2 * i; fineI++) {
+          for (int fineJ = 2 * j - 1; fineJ <= 2 * j; fineJ++) {
+            averaged += fine.getWaterHeight()[fineI][fineJ] / 4;
+          }
+        }
+        meshError += std::abs(base.getWaterHeight()[i][j] - averaged);
+        coarseError += std::abs(coarse.getWaterHeight()[i][j] - averaged);
+      }
+    }
+    REQUIRE(meshError < coarseError / 2);
+
+    // The fine level limits the time step
+    const RealType dt = mesh.simulateTimeStep();
+    REQUIRE(dt > 0);
+    REQUIRE(dt <= base.getMaxTimeStep());
+  }
+}
@@ -0,0 +1,74 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <cmath>
+
+#include "Tools/ArrivalTimes.h"
+
+TEST_CASE("Fast marching arrival times") {
+  const int      size     = 101;
+  const RealType cellSize = 100.0;
+  const RealType depth    = 100.0;
+  const RealType speed    = std::sqrt(RealType(9.81f) * depth);
+
+  Tools::Float2D<RealType> b(size + 2, size + 2);
+  for (int i = 0; i <= size + 1; i++) {
+    for (int j = 0; j <= size + 1; j++) {
+      b[i][j] = -depth;
+    }
+  }
+
+  SECTION("The times grow with the distance over constant depth") {
+    Tools::ArrivalTimes times;
+    times.compute(b, size, size, cellSize, cellSize, {{51, 51}});
+
+    REQUIRE(times.get(51, 51) == 0);
+    for (int k = 1; k <= 50; k++) {
+      // Along the axes the upwind scheme is exact
+      REQUIRE_THAT(times.get(51 + k, 51), Catch::Matchers::WithinRel(k * cellSize / speed, 1e-12));
+      REQUIRE_THAT(times.get(51, 51 - k), Catch::Matchers::WithinRel(k * cellSize / speed, 1e-12));
+
+      // On the diagonal the first-order scheme overestimates the distance, less the farther from the point source
+      const RealType diagonal = std::sqrt(RealType(2)) * k * cellSize / speed;
+      REQUIRE(times.get(51 + k, 51 + k) >= diagonal * 0.999);
+      REQUIRE(times.get(51 + k, 51 + k) <= diagonal * (k < 5 ? 1.25 : 1.1));
+    }
+    REQUIRE(times.get(101, 101) <= std::sqrt(RealType(2)) * 50 * cellSize / speed * 1.02);
+  }
+
+  SECTION("Shallow water is slower") {
+    for (int i = 52; i <= size; i++) {
+      for (int j = 1; j <= size; j++) {
+        b[i][j] = -depth / 4;
+      }
+    }
+    Tools::ArrivalTimes times;
+    times.compute(b, size, size, cellSize, cellSize, {{51, 51}});
+
+    REQUIRE_THAT(times.get(61, 51), Catch::Matchers::WithinRel(2 * 10 * cellSize / speed, 1e-12));
+    REQUIRE_THAT(times.get(41, 51), Catch::Matchers::WithinRel(10 * cellSize / speed, 1e-12));
+  }
+
+  SECTION("The wave goes around land and does not reach enclosed water") {
+    // A wall in column 61 with a gap at the top, and a lake enclosed by land
+    for (int j = 1; j <= 90; j++) {
+      b[61][j] = 10;
+    }
+    for (int i = 10; i <= 20; i++) {
+      for (int j = 10; j <= 20; j++) {
+        b[i][j] = (i == 10 || i == 20 || j == 10 || j == 20) ? 10 : -depth;
+      }
+    }
+    Tools::ArrivalTimes times;
+    times.compute(b, size, size, cellSize, cellSize, {{51, 51}});
+
+    REQUIRE(std::isinf(times.get(61, 51)));
+    REQUIRE(std::isinf(times.get(15, 15)));
+
+    // The detour over the gap is longer than the straight line
+    const RealType behindWall = times.get(71, 51);
+    REQUIRE(std::isfinite(behindWall));
+    REQUIRE(behindWall > 2 * 20 * cellSize / speed);
+    REQUIRE(times.getMinimum(68, 74, 48, 54) <= behindWall);
+  }
+}
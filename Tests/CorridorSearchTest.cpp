@@ -0,0 +1,55 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "Blocks/ReducedDimSplittingBlock.h"
+
+namespace {
+  /**
+   * Ocean of constant depth with a wall of land in the middle that has a gap at the top.
+   */
+  class WallScenario: public Scenarios::Scenario {
+  public:
+    RealType getWaterHeight(RealType x, RealType y) const override { return std::max(-getBathymetry(x, y), RealType(0.0)); }
+    RealType getBathymetry(RealType x, RealType y) const override { return (x > 4900 && x < 5100 && y < 7000) ? 10 : -100; }
+
+    BoundaryType getBoundaryType([[maybe_unused]] BoundaryEdge edge) const override { return BoundaryType::Outflow; }
+    RealType     getBoundaryPos(BoundaryEdge edge) const override {
+      return edge == BoundaryEdge::Left || edge == BoundaryEdge::Bottom ? RealType(0.0) : RealType(10000.0);
+    }
+  };
+
+  /**
+   * Exposes the search area.
+   */
+  class SearchBlock: public Blocks::ReducedDimSplittingBlock<> {
+  public:
+    using Blocks::ReducedDimSplittingBlock<>::ReducedDimSplittingBlock;
+
+    SweepRanges getSearchArea() const { return getSweepRanges(); }
+  };
+} // namespace
+
+TEST_CASE("Corridor search") {
+  const int                 size = 100;
+  const std::pair<int, int> start{25, 20};
+  const std::pair<int, int> end{75, 20};
+  WallScenario              scenario;
+
+  for (const bool parallel : {false, true}) {
+    SearchBlock block(size, size, 10000.0 / size, 10000.0 / size);
+    block.initialiseScenario(0, 0, scenario);
+    block.setStartCell(start);
+    block.setEndCell(end);
+    block.setParallelSearch(parallel);
+    block.findSearchArea();
+
+    // The way around the wall takes longer than the straight line
+    REQUIRE(block.getDestinationArrivalTime() > 50 * 100.0 / std::sqrt(9.81 * 100.0));
+
+    const auto area = block.getSearchArea();
+    REQUIRE(area.xCells.iBegin <= start.first);
+    REQUIRE(area.xCells.iEnd >= end.first);
+    REQUIRE(area.xCells.jBegin <= start.second);
+    // The corridor goes over the gap in the wall
+    REQUIRE(area.xCells.jEnd >= 70);
+  }
+}
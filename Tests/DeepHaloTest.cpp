@@ -0,0 +1,127 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "Blocks/DimensionalSplitting.h"
+#include "Blocks/WavePropagationBlock.hpp"
+#include "Scenarios/RadialDamBreakScenario.hpp"
+
+namespace {
+  using BlockFactory = std::function<Blocks::Block*(int, int, RealType, RealType)>;
+
+  /**
+   * The lower or upper half of the domain, extended by the cells that overlap with the other half.
+   */
+  struct Half {
+    std::unique_ptr<Blocks::Block>                block;
+    BoundaryEdge                                  edge;
+    int                                           firstRow;
+    std::vector<std::unique_ptr<Blocks::Block1D>> ghostLayers;
+    std::vector<std::unique_ptr<Blocks::Block1D>> copyLayers;
+
+    Half(const BlockFactory& createBlock, BoundaryEdge newEdge, int nx, int ny, RealType dx, RealType dy, int width, Scenarios::Scenario& scenario):
+      block(createBlock(nx, ny / 2 + width - 1, dx, dy)),
+      edge(newEdge),
+      firstRow(edge == BoundaryEdge::Top ? 0 : ny / 2 - (width - 1)) {
+      block->initialiseScenario(0, firstRow * dy, scenario, true);
+      for (const BoundaryEdge other : {BoundaryEdge::Left, BoundaryEdge::Right, BoundaryEdge::Bottom, BoundaryEdge::Top}) {
+        if (other != edge) {
+          block->setBoundaryType(other, scenario.getBoundaryType(other));
+        }
+      }
+      for (int depth = 0; depth < width; depth++) {
+        ghostLayers.emplace_back(block->grabGhostLayer(edge, depth));
+        copyLayers.emplace_back(block->registerCopyLayer(edge, 2 * width - 2 - depth));
+      }
+    }
+
+    //! Receives the halo from the copy layers of the other half, like Blocks::HaloExchange.
+    void receive(const Half& other) {
+      for (size_t depth = 0; depth < ghostLayers.size(); depth++) {
+        Blocks::Block1D&       ghost = *ghostLayers[depth];
+        const Blocks::Block1D& copy  = *other.copyLayers[depth];
+        for (int k = 0; k < ghost.h.getSize(); k++) {
+          ghost.h[k]  = copy.h[k];
+          ghost.hu[k] = copy.hu[k];
+          ghost.hv[k] = copy.hv[k];
+        }
+      }
+    }
+  };
+
+  /**
+   * Runs a block over the whole domain and two halves that exchange a halo of width only every getHaloTimeSteps time
+   * steps, all with the time step of the whole domain. The cells of the halves have to match.
+   */
+  void compare(const BlockFactory& createBlock, int width) {
+    const int                         nx = 40;
+    const int                         ny = 30;
+    const RealType                    dx = 1000.0 / nx;
+    const RealType                    dy = 1000.0 / ny;
+    Scenarios::RadialDamBreakScenario scenario;
+
+    std::unique_ptr<Blocks::Block> reference(createBlock(nx, ny, dx, dy));
+    reference->initialiseScenario(0, 0, scenario);
+    Half lower(createBlock, BoundaryEdge::Top, nx, ny, dx, dy, width, scenario);
+    Half upper(createBlock, BoundaryEdge::Bottom, nx, ny, dx, dy, width, scenario);
+
+    const int interval = lower.block->getHaloTimeSteps(width);
+    for (int step = 0; step < 30; step++) {
+      if (step % interval == 0) {
+        lower.receive(upper);
+        upper.receive(lower);
+      }
+
+      reference->setGhostLayer();
+      reference->computeNumericalFluxes();
+      const RealType dt = reference->getMaxTimeStep();
+      reference->updateUnknowns(dt);
+
+      for (Half* half : {&lower, &upper}) {
+        half->block->setGhostLayer();
+        half->block->computeNumericalFluxes();
+        half->block->updateUnknowns(dt);
+      }
+    }
+
+    for (const Half* half : {&lower, &upper}) {
+      const int first = half->edge == BoundaryEdge::Top ? 1 : width;
+      for (int i = 1; i <= nx; i++) {
+        for (int j = first; j < first + ny / 2; j++) {
+          const int row = half->firstRow + j;
+          REQUIRE(half->block->getWaterHeight()[i][j] == reference->getWaterHeight()[i][row]);
+          REQUIRE(half->block->getDischargeHu()[i][j] == reference->getDischargeHu()[i][row]);
+          REQUIRE(half->block->getDischargeHv()[i][j] == reference->getDischargeHv()[i][row]);
+        }
+      }
+    }
+  }
+} // namespace
+
+TEST_CASE("Halos wider than the ghost layer") {
+  SECTION("Wave propagation block") {
+    const BlockFactory createBlock = [](int nx, int ny, RealType dx, RealType dy) {
+      return new Blocks::WavePropagationBlock(nx, ny, dx, dy);
+    };
+    compare(createBlock, 1);
+    compare(createBlock, 3);
+  }
+
+  SECTION("Dimensional splitting") {
+    const BlockFactory createBlock = [](int nx, int ny, RealType dx, RealType dy) {
+      return new Blocks::DimensionalSplitting<Solvers::RusanovKernel>(nx, ny, dx, dy);
+    };
+    compare(createBlock, 1);
+    compare(createBlock, 3);
+  }
+
+  SECTION("The fused mode needs one more layer") {
+    const BlockFactory createBlock = [](int nx, int ny, RealType dx, RealType dy) {
+      return new Blocks::DimensionalSplitting<Solvers::RusanovKernel>(nx, ny, dx, dy, Blocks::ExecutionMode::Fused);
+    };
+    compare(createBlock, 2);
+    compare(createBlock, 4);
+  }
+}
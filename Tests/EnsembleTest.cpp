@@ -0,0 +1,125 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <cmath>
+
+#include "Blocks/Ensemble.h"
+
+namespace {
+  /**
+   * Ocean of constant depth with an island in the middle and a hump of water at the epicenter.
+   */
+  class IslandScenario: public Scenarios::Scenario {
+  public:
+    IslandScenario(RealType epicenterX, RealType hump):
+      epicenterX_(epicenterX),
+      hump_(hump) {}
+
+    RealType getDisplacement(RealType x, RealType y) const {
+      return std::abs(x - epicenterX_) < 500 && std::abs(y - 5000) < 500 ? hump_ : RealType(0.0);
+    }
+    RealType getWaterHeight(RealType x, RealType y) const override {
+      return getBathymetry(x, y) < 0 ? getDisplacement(x, y) - getBathymetry(x, y) : RealType(0.0);
+    }
+    RealType getBathymetry(RealType x, RealType y) const override {
+      return std::abs(x - 5000) < 1000 && std::abs(y - 5000) < 1000 ? RealType(10.0) : RealType(-100.0);
+    }
+
+    BoundaryType getBoundaryType([[maybe_unused]] BoundaryEdge edge) const override { return BoundaryType::Wall; }
+    RealType     getBoundaryPos(BoundaryEdge edge) const override {
+      return edge == BoundaryEdge::Left || edge == BoundaryEdge::Bottom ? RealType(0.0) : RealType(10000.0);
+    }
+
+  private:
+    RealType epicenterX_;
+    RealType hump_;
+  };
+} // namespace
+
+TEST_CASE("Ensemble over a shared bathymetry") {
+  const int      size     = 100;
+  const RealType cellSize = 10000.0 / size;
+  const RealType humps[]  = {0.0, 1.0, 2.0};
+
+  IslandScenario                               scenario(2000, 0);
+  Blocks::Ensemble<Solvers::FWaveKernel>       ensemble(size, size, cellSize, cellSize, 0, 0, scenario, 3);
+  const std::pair<int, int>                    destination{80, 50};
+  ensemble.setDestination(destination);
+  for (int member = 0; member < 3; member++) {
+    const IslandScenario perturbed(2000, humps[member]);
+    ensemble.initialiseMember(member, [&](RealType x, RealType y) { return perturbed.getDisplacement(x, y); });
+  }
+
+  SECTION("The members share the bathymetry") {
+    for (int member = 1; member < 3; member++) {
+      REQUIRE(ensemble.getMember(member).getBathymetry().getData() == ensemble.getMember(0).getBathymetry().getData());
+      REQUIRE(ensemble.getMember(member).getWaterHeight().getData() != ensemble.getMember(0).getWaterHeight().getData());
+    }
+    REQUIRE(ensemble.getMember(2).getWaterHeight()[20][50] == 102);
+    REQUIRE(ensemble.getMember(2).getWaterHeight()[50][50] == 0);
+  }
+
+  SECTION("A member is the same as a block of its own") {
+    ensemble.setTeams(3);
+    ensemble.simulateUntil(50.0);
+    ensemble.simulateUntil(100.0);
+
+    IslandScenario                 single(2000, humps[2]);
+    Blocks::DimensionalSplitting<> block(size, size, cellSize, cellSize, Blocks::ExecutionMode::Fused);
+    block.initialiseScenario(0, 0, single);
+    RealType time = 0;
+    for (const RealType end : {50.0, 100.0}) {
+      while (time < end) {
+        block.setGhostLayer();
+        block.computeNumericalFluxes();
+        const RealType dt = std::min(block.getMaxTimeStep(), end - time);
+        block.updateUnknowns(dt);
+        time = dt == end - time ? end : time + dt;
+      }
+    }
+
+    auto& member = ensemble.getMember(2);
+    for (int i = 1; i <= size; i++) {
+      for (int j = 1; j <= size; j++) {
+        REQUIRE(member.getWaterHeight()[i][j] == block.getWaterHeight()[i][j]);
+        REQUIRE(member.getDischargeHu()[i][j] == block.getDischargeHu()[i][j]);
+      }
+    }
+  }
+
+  SECTION("The number of teams does not change the result") {
+    Blocks::Ensemble<Solvers::FWaveKernel> serial(size, size, cellSize, cellSize, 0, 0, scenario, 3);
+    serial.setDestination(destination);
+    for (int member = 0; member < 3; member++) {
+      const IslandScenario perturbed(2000, humps[member]);
+      serial.initialiseMember(member, [&](RealType x, RealType y) { return perturbed.getDisplacement(x, y); });
+    }
+    serial.setTeams(1);
+    ensemble.setTeams(3);
+    serial.simulateUntil(100.0);
+    ensemble.simulateUntil(100.0);
+    for (int member = 0; member < 3; member++) {
+      REQUIRE(serial.getMaxElevation(member) == ensemble.getMaxElevation(member));
+      for (int i = 1; i <= size; i++) {
+        for (int j = 1; j <= size; j++) {
+          REQUIRE(serial.getMember(member).getWaterHeight()[i][j] == ensemble.getMember(member).getWaterHeight()[i][j]);
+        }
+      }
+    }
+  }
+
+  SECTION("Larger earthquakes raise the water more at the destination") {
+    ensemble.simulateUntil(150.0);
+
+    // The sea at rest stays at rest, the waves went around the island
+    REQUIRE_THAT(ensemble.getMaxElevation(0), Catch::Matchers::WithinAbs(0.0, 1e-10));
+    REQUIRE(ensemble.getMaxElevation(1) > 1e-3);
+    REQUIRE(ensemble.getMaxElevation(2) > ensemble.getMaxElevation(1));
+
+    const auto statistics = ensemble.getStatistics(ensemble.getMaxElevation(1) / 2);
+    REQUIRE(statistics.max == ensemble.getMaxElevation(2));
+    REQUIRE_THAT(statistics.mean, Catch::Matchers::WithinRel((ensemble.getMaxElevation(1) + ensemble.getMaxElevation(2)) / 3, 1e-6));
+    REQUIRE_THAT(statistics.exceedance, Catch::Matchers::WithinRel(2.0 / 3.0, 1e-6));
+    REQUIRE(ensemble.getCellUpdates() > 0);
+  }
+}
@@ -0,0 +1,105 @@
+#include <catch2/catch_test_macros.hpp>
+#include <Solvers/FWaveKernel.h>
+#include <Solvers/FWaveSolver.h>
+
+TEST_CASE("FWaveKernel matches FWaveSolver") {
+  Solvers::FWaveSolver solver;
+
+  // heights include dry cells on both sides, momenta and bathymetry include steps in both directions
+  const RealType heights[]    = {0, 0.5, 1, 7.5, 100, 3000};
+  const RealType momenta[]    = {-40, -1, 0, 2.5, 300};
+  const RealType bathymetry[] = {-3000, -100, -1, 0, 20};
+
+  for (RealType hLeft : heights) {
+    for (RealType hRight : heights) {
+      for (RealType huLeft : momenta) {
+        for (RealType huRight : momenta) {
+          for (RealType bLeft : bathymetry) {
+            for (RealType bRight : bathymetry) {
+              RealType expected[5];
+              RealType actual[5];
+              solver.computeNetUpdates(
+                hLeft, hRight, huLeft, huRight, bLeft, bRight, expected[0], expected[1], expected[2], expected[3], expected[4]
+              );
+              Solvers::FWaveKernel::computeNetUpdates(
+                hLeft, hRight, huLeft, huRight, bLeft, bRight, actual[0], actual[1], actual[2], actual[3], actual[4]
+              );
+              for (int k = 0; k < 5; k++) {
+                REQUIRE(actual[k] == expected[k]);
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST_CASE("FWaveKernel dry cells") {
+  RealType hUpdateLeft, hUpdateRight, huUpdateLeft, huUpdateRight, maxWaveSpeed;
+
+  SECTION("Both cells dry") {
+    Solvers::FWaveKernel::computeNetUpdates(
+      0, 0, 0, 0, 10, 20, hUpdateLeft, hUpdateRight, huUpdateLeft, huUpdateRight, maxWaveSpeed
+    );
+    REQUIRE(hUpdateLeft == 0);
+    REQUIRE(hUpdateRight == 0);
+    REQUIRE(huUpdateLeft == 0);
+    REQUIRE(huUpdateRight == 0);
+    REQUIRE(maxWaveSpeed == 0);
+  }
+
+  SECTION("Dry cell does not receive updates") {
+    Solvers::FWaveKernel::computeNetUpdates(
+      10, 0, 5, 0, -10, 5, hUpdateLeft, hUpdateRight, huUpdateLeft, huUpdateRight, maxWaveSpeed
+    );
+    REQUIRE(hUpdateRight == 0);
+    REQUIRE(huUpdateRight == 0);
+    REQUIRE(hUpdateLeft != 0);
+    REQUIRE(maxWaveSpeed > 0);
+  }
+}
+
+TEST_CASE("FWaveKernel lake at rest") {
+  RealType hUpdateLeft, hUpdateRight, huUpdateLeft, huUpdateRight, maxWaveSpeed;
+
+  // 0.3 and 0.7 are not exactly representable, the f-wave decomposition alone leaves round-off
+  Solvers::FWaveKernel::computeNetUpdates(
+    100.3, 40.7, 0, 0, -100.3, -40.7, hUpdateLeft, hUpdateRight, huUpdateLeft, huUpdateRight, maxWaveSpeed
+  );
+  REQUIRE(hUpdateLeft == 0);
+  REQUIRE(hUpdateRight == 0);
+  REQUIRE(huUpdateLeft == 0);
+  REQUIRE(huUpdateRight == 0);
+  REQUIRE(maxWaveSpeed > 0);
+}
+
+TEST_CASE("FWaveKernel batch matches scalar kernel") {
+  // a column with dry cells, a bathymetry step and a length that is not a multiple of the vector width
+  const int n = 37;
+  RealType  h[n + 1], hu[n + 1], b[n + 1];
+  for (int k = 0; k <= n; k++) {
+    b[k]  = k < 10 ? RealType(5) : RealType(-100 - 3 * k);
+    h[k]  = k < 10 ? RealType(0) : -b[k] + RealType(k % 3);
+    hu[k] = RealType((k % 7) - 3);
+  }
+
+  RealType hUpdateLeft[n], hUpdateRight[n], huUpdateLeft[n], huUpdateRight[n];
+  const RealType maxWaveSpeed = Solvers::FWaveKernel::computeNetUpdatesBatch(
+    h, h + 1, hu, hu + 1, b, b + 1, hUpdateLeft, hUpdateRight, huUpdateLeft, huUpdateRight, n
+  );
+
+  RealType expectedMaxWaveSpeed = 0;
+  for (int k = 0; k < n; k++) {
+    RealType expected[5];
+    Solvers::FWaveKernel::computeNetUpdates(
+      h[k], h[k + 1], hu[k], hu[k + 1], b[k], b[k + 1], expected[0], expected[1], expected[2], expected[3], expected[4]
+    );
+    REQUIRE(hUpdateLeft[k] == expected[0]);
+    REQUIRE(hUpdateRight[k] == expected[1]);
+    REQUIRE(huUpdateLeft[k] == expected[2]);
+    REQUIRE(huUpdateRight[k] == expected[3]);
+    expectedMaxWaveSpeed = std::max(expectedMaxWaveSpeed, expected[4]);
+  }
+  REQUIRE(maxWaveSpeed == expectedMaxWaveSpeed);
+}
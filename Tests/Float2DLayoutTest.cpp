@@ -0,0 +1,126 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+
+#include "RadialDamBreakBlock.hpp"
+#include "Tools/Float2D.hpp"
+
+TEST_CASE("Float2D memory layout") {
+  SECTION("Padded columns") {
+    const Tools::MemoryLayout padded{true, Tools::HugePages::None};
+    for (int rows : {1, 7, 8, 102, 128, 1026}) {
+      Tools::Float2D<RealType> array(5, rows, true, padded);
+      REQUIRE(array.getStride() >= rows);
+      REQUIRE(array.getStride() * sizeof(RealType) % Tools::AlignedAllocator::Alignment == 0);
+      REQUIRE(array.getStride() * sizeof(RealType) % 1024 != 0);
+      for (int i = 0; i < 5; i++) {
+        REQUIRE(reinterpret_cast<std::uintptr_t>(array[i]) % Tools::AlignedAllocator::Alignment == 0);
+        for (int j = 0; j < rows; j++) {
+          array[i][j] = i * rows + j;
+        }
+      }
+
+      Tools::Float1D<RealType> row = array.getRowProxy(rows - 1);
+      Tools::Float1D<RealType> col = array.getColProxy(3);
+      for (int i = 0; i < 5; i++) {
+        REQUIRE(row[i] == i * rows + rows - 1);
+      }
+      for (int j = 0; j < rows; j++) {
+        REQUIRE(col[j] == 3 * rows + j);
+      }
+
+      Tools::Float2D<RealType> copy(array);
+      for (int i = 0; i < 5; i++) {
+        for (int j = 0; j < rows; j++) {
+          REQUIRE(copy[i][j] == array[i][j]);
+        }
+      }
+    }
+  }
+
+  SECTION("Huge pages") {
+    for (auto hugePages : {Tools::HugePages::Transparent, Tools::HugePages::Explicit}) {
+      Tools::Float2D<RealType> array(512, 514, true, Tools::MemoryLayout{false, hugePages});
+      REQUIRE(array.getStride() == 514);
+      REQUIRE(reinterpret_cast<std::uintptr_t>(array.getData()) % Tools::AlignedAllocator::Alignment == 0);
+      array[511][513] = 1.0;
+      REQUIRE(array[511][513] == 1.0);
+    }
+  }
+
+  SECTION("A padded block computes the same result") {
+    const int size      = 126;
+    auto      reference = Tests::createRadialDamBreakBlock(Blocks::ExecutionMode::Buffered, size);
+    Tests::simulate(*reference, 20);
+
+    const Tools::MemoryLayout defaultLayout = Tools::MemoryLayout::getDefault();
+    Tools::MemoryLayout::getDefault()       = {true, Tools::HugePages::Transparent};
+    auto padded                             = Tests::createRadialDamBreakBlock(Blocks::ExecutionMode::Buffered, size);
+    Tools::MemoryLayout::getDefault()       = defaultLayout;
+
+    REQUIRE(padded->getWaterHeight().getStride() > size + 2);
+    Tests::simulate(*padded, 20);
+
+    REQUIRE(padded->getMaxTimeStep() == reference->getMaxTimeStep());
+    Tests::requireSameState(*padded, *reference);
+  }
+}
+
+TEST_CASE("Float2D ownership") {
+  Tools::Float2D<RealType> array(4, 3);
+  for (int i = 0; i < 4; i++) {
+    for (int j = 0; j < 3; j++) {
+      array[i][j] = 10 * i + j;
+    }
+  }
+
+  SECTION("Copies are deep") {
+    Tools::Float2D<RealType> copy(array);
+    REQUIRE(copy.getData() != array.getData());
+    copy[2][1] = -1;
+    REQUIRE(array[2][1] == 21);
+
+    // same size: the values are copied into the existing memory
+    const RealType* memory = copy.getData();
+    copy                   = array;
+    REQUIRE(copy.getData() == memory);
+    REQUIRE(copy[2][1] == 21);
+
+    // different size: the array is replaced
+    Tools::Float2D<RealType> other(2, 2);
+    other = array;
+    REQUIRE(other.getCols() == 4);
+    REQUIRE(other[3][2] == 32);
+  }
+
+  SECTION("Moves hand the memory over") {
+    const RealType*          memory = array.getData();
+    Tools::Float2D<RealType> moved(std::move(array));
+    REQUIRE(moved.getData() == memory);
+
+    Tools::Float2D<RealType> target(4, 3);
+    target = std::move(moved);
+    REQUIRE(target.getData() == memory);
+    REQUIRE(target[3][2] == 32);
+  }
+
+  SECTION("Views do not copy") {
+    Tools::Float2DView<RealType>       view(array);
+    Tools::Float2DView<const RealType> constView(static_cast<const Tools::Float2D<RealType>&>(array));
+    view[1][1] = -5;
+    REQUIRE(array[1][1] == -5);
+    REQUIRE(constView[1][1] == -5);
+    REQUIRE(constView.getData() == array.getData());
+  }
+
+  SECTION("Setters copy or move into the block") {
+    Blocks::DimensionalSplitting<> block(2, 1, 1, 1);
+    block.setB(array);
+    REQUIRE(block.getBathymetry().getData() != array.getData());
+    REQUIRE(block.getBathymetry()[3][2] == 32);
+
+    const RealType* memory = array.getData();
+    block.setH(std::move(array));
+    REQUIRE(block.getWaterHeight().getData() == memory);
+  }
+}
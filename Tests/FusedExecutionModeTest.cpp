@@ -0,0 +1,45 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#if defined(ENABLE_OPENMP)
+#include <omp.h>
+#endif
+
+#include "RadialDamBreakBlock.hpp"
+
+TEST_CASE("Fused execution mode") {
+  auto buffered = Tests::createRadialDamBreakBlock(Blocks::ExecutionMode::Buffered);
+  auto fused    = Tests::createRadialDamBreakBlock(Blocks::ExecutionMode::Fused);
+
+  SECTION("Same time step as the buffered mode") {
+    buffered->setGhostLayer();
+    fused->setGhostLayer();
+    buffered->computeNumericalFluxes();
+    fused->computeNumericalFluxes();
+    REQUIRE(fused->getMaxTimeStep() == buffered->getMaxTimeStep());
+  }
+
+  SECTION("Close to the buffered mode") {
+    // the fused mode is a true splitting scheme, the buffered mode computes all net updates from the same state
+    Tests::simulate(*buffered, 20);
+    Tests::simulate(*fused, 20);
+    for (int i = 1; i <= fused->getNx(); i++) {
+      for (int j = 1; j <= fused->getNy(); j++) {
+        REQUIRE_THAT(fused->getWaterHeight()[i][j], Catch::Matchers::WithinAbs(buffered->getWaterHeight()[i][j], 0.25));
+      }
+    }
+  }
+
+#if defined(ENABLE_OPENMP)
+  SECTION("Independent of the number of threads") {
+    auto serial = Tests::createRadialDamBreakBlock(Blocks::ExecutionMode::Fused);
+
+    const int threads = omp_get_max_threads();
+    omp_set_num_threads(1);
+    Tests::simulate(*serial, 20);
+    omp_set_num_threads(threads);
+    Tests::simulate(*fused, 20);
+
+    Tests::requireSameState(*fused, *serial);
+  }
+#endif
+}
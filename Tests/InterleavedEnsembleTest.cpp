@@ -0,0 +1,86 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <cmath>
+
+#include "Blocks/InterleavedEnsemble.h"
+
+namespace {
+  /**
+   * Ocean of constant depth with an island in the middle, the boundaries in x are of the given type.
+   */
+  class IslandScenario: public Scenarios::Scenario {
+  public:
+    explicit IslandScenario(BoundaryType boundaryX):
+      boundaryX_(boundaryX) {}
+
+    RealType getWaterHeight(RealType x, RealType y) const override { return std::max(-getBathymetry(x, y), RealType(0.0)); }
+    RealType getBathymetry(RealType x, RealType y) const override {
+      return std::abs(x - 5000) < 1000 && std::abs(y - 5000) < 1000 ? RealType(10.0) : RealType(-100.0) - y / 1000;
+    }
+
+    BoundaryType getBoundaryType(BoundaryEdge edge) const override {
+      return edge == BoundaryEdge::Left || edge == BoundaryEdge::Right ? boundaryX_ : BoundaryType::Wall;
+    }
+    RealType getBoundaryPos(BoundaryEdge edge) const override {
+      return edge == BoundaryEdge::Left || edge == BoundaryEdge::Bottom ? RealType(0.0) : RealType(10000.0);
+    }
+
+  private:
+    BoundaryType boundaryX_;
+  };
+
+  //! A hump of water that grows with the member, the first member is the sea at rest.
+  auto hump(int member) {
+    return [member](RealType x, RealType y) {
+      return std::abs(x - 1500 - 200 * member) < 500 && std::abs(y - 5000) < 500 ? RealType(0.5) * member : RealType(0.0);
+    };
+  }
+} // namespace
+
+TEST_CASE("Ensemble with interleaved members") {
+  const int      size     = 64;
+  const RealType cellSize = 10000.0 / size;
+  // Not a multiple of the vector width
+  const int                 members = 5;
+  const std::pair<int, int> destination{56, 32};
+
+  for (const BoundaryType boundaryX : {BoundaryType::Outflow, BoundaryType::Wall, BoundaryType::Periodic}) {
+    IslandScenario                                    scenario(boundaryX);
+    Blocks::Ensemble<Solvers::FWaveKernel>            independent(size, size, cellSize, cellSize, 0, 0, scenario, members);
+    Blocks::InterleavedEnsemble<Solvers::FWaveKernel> interleaved(size, size, cellSize, cellSize, 0, 0, scenario, members);
+    independent.setDestination(destination);
+    interleaved.setDestination(destination);
+    for (int member = 0; member < members; member++) {
+      independent.initialiseMember(member, hump(member));
+      interleaved.initialiseMember(member, hump(member));
+    }
+
+    // Every member keeps its own time steps, the cell updates add up the same
+    for (const RealType time : {60.0, 120.0, 200.0}) {
+      independent.simulateUntil(time);
+      interleaved.simulateUntil(time);
+      REQUIRE(interleaved.getCellUpdates() == independent.getCellUpdates());
+    }
+
+    for (int member = 0; member < members; member++) {
+      auto&      block = independent.getMember(member);
+      const auto h     = interleaved.getWaterHeight(member);
+      const auto hu    = interleaved.getDischargeHu(member);
+      const auto hv    = interleaved.getDischargeHv(member);
+      for (int i = 1; i <= size; i++) {
+        for (int j = 1; j <= size; j++) {
+          REQUIRE_THAT(h[i][j], Catch::Matchers::WithinAbs(block.getWaterHeight()[i][j], 1e-10));
+          REQUIRE_THAT(hu[i][j], Catch::Matchers::WithinAbs(block.getDischargeHu()[i][j], 1e-8));
+          REQUIRE_THAT(hv[i][j], Catch::Matchers::WithinAbs(block.getDischargeHv()[i][j], 1e-8));
+        }
+      }
+      REQUIRE_THAT(interleaved.getMaxElevation(member), Catch::Matchers::WithinAbs(independent.getMaxElevation(member), 1e-10));
+    }
+
+    // The sea at rest stays at rest, the other members reached the destination
+    REQUIRE_THAT(interleaved.getMaxElevation(0), Catch::Matchers::WithinAbs(0.0, 1e-10));
+    REQUIRE(interleaved.getMaxElevation(members - 1) > 1e-3);
+    REQUIRE(interleaved.getStatistics(0.0).max == interleaved.getMaxElevation(members - 1));
+  }
+}
@@ -0,0 +1,103 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+#include "Blocks/DimensionalSplitting.h"
+#include "RadialDamBreakBlock.hpp"
+
+namespace {
+  /**
+   * Deep ocean in the left half, a shelf of 50 m in the right half and a hump of water in the ocean.
+   */
+  class ShelfScenario: public Scenarios::Scenario {
+  public:
+    RealType getWaterHeight(RealType x, RealType y) const override {
+      const RealType distance = std::sqrt((x - 2500) * (x - 2500) + (y - 5000) * (y - 5000));
+      return -getBathymetry(x, y) + (distance < 1000 ? RealType(1.0) : RealType(0.0));
+    }
+    RealType getBathymetry(RealType x, [[maybe_unused]] RealType y) const override { return x < 5000 ? -4000 : -50; }
+
+    BoundaryType getBoundaryType([[maybe_unused]] BoundaryEdge edge) const override { return BoundaryType::Outflow; }
+    RealType     getBoundaryPos(BoundaryEdge edge) const override {
+      return edge == BoundaryEdge::Left || edge == BoundaryEdge::Bottom ? RealType(0.0) : RealType(10000.0);
+    }
+  };
+
+  RealType totalWaterHeight(Blocks::DimensionalSplitting<>& block, int size) {
+    RealType sum = 0;
+    for (int i = 1; i <= size; i++) {
+      for (int j = 1; j <= size; j++) {
+        sum += block.getWaterHeight()[i][j];
+      }
+    }
+    return sum;
+  }
+
+} // namespace
+
+TEST_CASE("Local time stepping") {
+  SECTION("A single level is global time stepping") {
+    auto buffered = Tests::createRadialDamBreakBlock(Blocks::ExecutionMode::Buffered);
+    auto local    = Tests::createRadialDamBreakBlock(Blocks::ExecutionMode::LocalTimeStepping);
+    local->setTimeStepLevels(1);
+
+    for (int step = 0; step < 20; step++) {
+      buffered->setGhostLayer();
+      local->setGhostLayer();
+      REQUIRE_THAT(local->simulateTimeStep(), Catch::Matchers::WithinRel(buffered->simulateTimeStep(), 1e-12));
+    }
+    for (int i = 1; i <= local->getNx(); i++) {
+      for (int j = 1; j <= local->getNy(); j++) {
+        REQUIRE_THAT(local->getWaterHeight()[i][j], Catch::Matchers::WithinAbs(buffered->getWaterHeight()[i][j], 1e-10));
+        REQUIRE_THAT(local->getDischargeHu()[i][j], Catch::Matchers::WithinAbs(buffered->getDischargeHu()[i][j], 1e-10));
+        REQUIRE_THAT(local->getDischargeHv()[i][j], Catch::Matchers::WithinAbs(buffered->getDischargeHv()[i][j], 1e-10));
+      }
+    }
+    REQUIRE(local->getLocalCellUpdates() == local->getGlobalCellUpdates());
+  }
+
+  SECTION("Shelf") {
+    ShelfScenario  scenario;
+    const int      size     = 100;
+    const RealType cellSize = 10000.0 / size;
+
+    Blocks::DimensionalSplitting<> global(size, size, cellSize, cellSize, Blocks::ExecutionMode::LocalTimeStepping);
+    Blocks::DimensionalSplitting<> local(size, size, cellSize, cellSize, Blocks::ExecutionMode::LocalTimeStepping);
+    global.initialiseScenario(0, 0, scenario);
+    local.initialiseScenario(0, 0, scenario);
+    global.setTimeStepLevels(1);
+    global.setTileSize(10, 10);
+    local.setTileSize(10, 10);
+
+    const RealType initialWater = totalWaterHeight(local, size);
+
+    // Global time stepping with the same global time step, nothing flows out of the boundary yet
+    for (RealType time = 0; time < 3.0;) {
+      local.setGhostLayer();
+      const RealType dt    = local.simulateTimeStep();
+      const int      steps = 1 << *std::max_element(local.getTileLevels().begin(), local.getTileLevels().end());
+      for (int step = 0; step < steps; step++) {
+        global.setGhostLayer();
+        global.simulateTimeStep(dt / steps);
+      }
+      time += dt;
+    }
+
+    // The shelf runs with larger time steps than the ocean
+    const std::vector<int>& levels = local.getTileLevels();
+    REQUIRE(levels.front() == 0);
+    REQUIRE(levels.back() > 0);
+    REQUIRE(local.getLocalCellUpdates() < local.getGlobalCellUpdates());
+
+    // Every edge transfers the same amount to both sides
+    REQUIRE_THAT(totalWaterHeight(local, size), Catch::Matchers::WithinRel(initialWater, 1e-12));
+
+    for (int i = 1; i <= size; i++) {
+      for (int j = 1; j <= size; j++) {
+        REQUIRE_THAT(local.getWaterHeight()[i][j], Catch::Matchers::WithinAbs(global.getWaterHeight()[i][j], 1e-3));
+      }
+    }
+  }
+}
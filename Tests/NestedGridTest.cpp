@@ -0,0 +1,145 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <cmath>
+
+#include "Blocks/NestedGrid.h"
+#include "Blocks/ReducedDimSplittingBlock.h"
+
+namespace {
+  /**
+   * Sea floor rising from -200 m on the left to a beach on the right, optionally with a hump of water.
+   */
+  class BeachScenario: public Scenarios::Scenario {
+  public:
+    explicit BeachScenario(RealType hump):
+      hump_(hump) {}
+
+    RealType getWaterHeight(RealType x, RealType y) const override {
+      const RealType distance = std::sqrt((x - 2500) * (x - 2500) + (y - 5000) * (y - 5000));
+      return std::max(-getBathymetry(x, y), RealType(0.0)) + (distance < 1000 ? hump_ : RealType(0.0));
+    }
+    RealType getBathymetry(RealType x, [[maybe_unused]] RealType y) const override { return -200 + RealType(0.03) * x; }
+
+    BoundaryType getBoundaryType([[maybe_unused]] BoundaryEdge edge) const override { return BoundaryType::Outflow; }
+    RealType     getBoundaryPos(BoundaryEdge edge) const override {
+      return edge == BoundaryEdge::Left || edge == BoundaryEdge::Bottom ? RealType(0.0) : RealType(10000.0);
+    }
+
+  private:
+    RealType hump_;
+  };
+} // namespace
+
+TEST_CASE("One-way nested regions") {
+  const int      size     = 64;
+  const RealType cellSize = 10000.0 / size;
+  // Around the beach, and one region at the top boundary of the domain
+  const std::vector<Blocks::NestedGrid<>::Region> regions{{30, 22, 50, 42}, {40, 56, 56, 64}};
+
+  SECTION("A lake at rest stays at rest in the regions") {
+    BeachScenario                      scenario(0.0);
+    Blocks::ReducedDimSplittingBlock<> coarse(size, size, cellSize, cellSize);
+    coarse.initialiseScenario(0, 0, scenario);
+    Blocks::NestedGrid<> grid(coarse, scenario, 0, 0, cellSize, cellSize, 4, regions, false);
+
+    for (int step = 0; step < 10; step++) {
+      grid.simulateTimeStep(1.0);
+    }
+    grid.synchronise();
+    REQUIRE(grid.getFineTime() == grid.getTime());
+    REQUIRE(grid.getFineCellUpdates() > 0);
+
+    for (const auto* nest : grid.getNests()) {
+      auto& block = nest->getBlock();
+      for (int i = 1; i <= block.getNx(); i++) {
+        for (int j = 1; j <= block.getNy(); j++) {
+          const RealType h = block.getWaterHeight()[i][j];
+          if (h > 0) {
+            REQUIRE_THAT(h + block.getBathymetry()[i][j], Catch::Matchers::WithinAbs(0.0, 1e-10));
+          }
+          REQUIRE_THAT(block.getDischargeHu()[i][j], Catch::Matchers::WithinAbs(0.0, 1e-10));
+          REQUIRE_THAT(block.getDischargeHv()[i][j], Catch::Matchers::WithinAbs(0.0, 1e-10));
+        }
+      }
+    }
+  }
+
+  SECTION("The coarse block is the same with and without regions") {
+    BeachScenario                  scenario(2.0);
+    Blocks::DimensionalSplitting<> alone(size, size, cellSize, cellSize);
+    Blocks::DimensionalSplitting<> coarse(size, size, cellSize, cellSize);
+    alone.initialiseScenario(0, 0, scenario);
+    coarse.initialiseScenario(0, 0, scenario);
+    Blocks::NestedGrid<> grid(coarse, scenario, 0, 0, cellSize, cellSize, 2, regions);
+
+    for (int step = 0; step < 40; step++) {
+      alone.setGhostLayer();
+      REQUIRE(grid.simulateTimeStep() == alone.simulateTimeStep());
+    }
+    for (int i = 1; i <= size; i++) {
+      for (int j = 1; j <= size; j++) {
+        REQUIRE(coarse.getWaterHeight()[i][j] == alone.getWaterHeight()[i][j]);
+      }
+    }
+  }
+
+  SECTION("Both teams compute the same as one after the other") {
+    BeachScenario                  scenario(2.0);
+    Blocks::DimensionalSplitting<> coarseSequential(size, size, cellSize, cellSize);
+    Blocks::DimensionalSplitting<> coarseTeams(size, size, cellSize, cellSize);
+    coarseSequential.initialiseScenario(0, 0, scenario);
+    coarseTeams.initialiseScenario(0, 0, scenario);
+    Blocks::NestedGrid<> sequential(coarseSequential, scenario, 0, 0, cellSize, cellSize, 2, regions);
+    Blocks::NestedGrid<> teams(coarseTeams, scenario, 0, 0, cellSize, cellSize, 2, regions);
+    sequential.setTeamSizes(0, 0);
+    teams.setTeamSizes(2, 2);
+
+    for (int step = 0; step < 40; step++) {
+      REQUIRE(sequential.simulateTimeStep() == teams.simulateTimeStep());
+    }
+    sequential.synchronise();
+    teams.synchronise();
+    for (std::size_t k = 0; k < regions.size(); k++) {
+      auto& expected = sequential.getNests()[k]->getBlock();
+      auto& actual   = teams.getNests()[k]->getBlock();
+      for (int i = 1; i <= expected.getNx(); i++) {
+        for (int j = 1; j <= expected.getNy(); j++) {
+          REQUIRE(actual.getWaterHeight()[i][j] == expected.getWaterHeight()[i][j]);
+        }
+      }
+    }
+  }
+
+  SECTION("The regions are closer to a uniform fine grid than the coarse block") {
+    BeachScenario                  scenario(2.0);
+    Blocks::DimensionalSplitting<> coarse(size, size, cellSize, cellSize);
+    Blocks::DimensionalSplitting<> fine(2 * size, 2 * size, cellSize / 2, cellSize / 2);
+    coarse.initialiseScenario(0, 0, scenario);
+    fine.initialiseScenario(0, 0, scenario);
+    Blocks::NestedGrid<> grid(coarse, scenario, 0, 0, cellSize, cellSize, 2, regions);
+
+    for (int step = 0; step < 120; step++) {
+      grid.simulateTimeStep(0.5);
+      for (int substep = 0; substep < 2; substep++) {
+        fine.setGhostLayer();
+        fine.simulateTimeStep(0.25);
+      }
+    }
+    grid.synchronise();
+
+    const auto* nest        = grid.getNests()[0];
+    const auto& region      = nest->getRegion();
+    auto&       block       = nest->getBlock();
+    RealType    nestError   = 0;
+    RealType    coarseError = 0;
+    for (int i = 1; i <= block.getNx(); i++) {
+      for (int j = 1; j <= block.getNy(); j++) {
+        const RealType expected = fine.getWaterHeight()[2 * (region.firstX - 1) + i][2 * (region.firstY - 1) + j];
+        nestError += std::abs(block.getWaterHeight()[i][j] - expected);
+        coarseError += std::abs(coarse.getWaterHeight()[region.firstX + (i - 1) / 2][region.firstY + (j - 1) / 2] - expected);
+      }
+    }
+    REQUIRE(nestError < coarseError / 2);
+  }
+}
@@ -0,0 +1,150 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <cmath>
+
+#include "Blocks/ReducedDimSplittingBlock.h"
+
+namespace {
+  /**
+   * Ocean of constant depth with a hump of water, periodic in x (and optionally in y).
+   */
+  class RingScenario: public Scenarios::Scenario {
+  public:
+    RingScenario(RealType humpX, RealType humpY, bool periodicY):
+      humpX_(humpX),
+      humpY_(humpY),
+      periodicY_(periodicY) {}
+
+    RealType getWaterHeight(RealType x, RealType y) const override {
+      const RealType distance = std::sqrt((x - humpX_) * (x - humpX_) + (y - humpY_) * (y - humpY_));
+      return 100 + (distance < 500 ? RealType(1.0) : RealType(0.0));
+    }
+    RealType getBathymetry([[maybe_unused]] RealType x, [[maybe_unused]] RealType y) const override { return -100; }
+
+    BoundaryType getBoundaryType(BoundaryEdge edge) const override {
+      return edge == BoundaryEdge::Left || edge == BoundaryEdge::Right || periodicY_ ? BoundaryType::Periodic : BoundaryType::Outflow;
+    }
+    RealType getBoundaryPos(BoundaryEdge edge) const override {
+      return edge == BoundaryEdge::Left || edge == BoundaryEdge::Bottom ? RealType(0.0) : RealType(10000.0);
+    }
+
+  private:
+    RealType humpX_;
+    RealType humpY_;
+    bool     periodicY_;
+  };
+
+  /**
+   * Exposes the search area.
+   */
+  class SearchBlock: public Blocks::ReducedDimSplittingBlock<> {
+  public:
+    using Blocks::ReducedDimSplittingBlock<>::ReducedDimSplittingBlock;
+
+    SweepRanges getSearchArea() const { return getSweepRanges(); }
+  };
+} // namespace
+
+TEST_CASE("Periodic boundaries") {
+  const int      size     = 100;
+  const RealType cellSize = 10000.0 / size;
+
+  SECTION("A wave that crosses the boundary is the same as one that does not") {
+    // The hump starts next to the left boundary, the same hump half a block to the right is a shifted copy of it
+    RingScenario                   nearBoundary(1500, 5000, false);
+    RingScenario                   inside(6500, 5000, false);
+    Blocks::DimensionalSplitting<> shifted(size, size, cellSize, cellSize);
+    Blocks::DimensionalSplitting<> reference(size, size, cellSize, cellSize);
+    shifted.initialiseScenario(0, 0, nearBoundary);
+    reference.initialiseScenario(0, 0, inside);
+
+    for (int step = 0; step < 40; step++) {
+      shifted.setGhostLayer();
+      reference.setGhostLayer();
+      shifted.simulateTimeStep(1.0);
+      reference.simulateTimeStep(1.0);
+    }
+
+    // The wave went through the left boundary
+    REQUIRE(std::abs(shifted.getWaterHeight()[size][50] - 100) > 1e-6);
+    for (int i = 1; i <= size; i++) {
+      for (int j = 1; j <= size; j++) {
+        const int column = (i + size / 2 - 1) % size + 1;
+        REQUIRE_THAT(shifted.getWaterHeight()[i][j], Catch::Matchers::WithinAbs(reference.getWaterHeight()[column][j], 1e-10));
+      }
+    }
+  }
+
+  SECTION("Periodic boundaries on all edges conserve the volume") {
+    RingScenario                   scenario(500, 9500, true);
+    Blocks::DimensionalSplitting<> block(size, size, cellSize, cellSize);
+    block.initialiseScenario(0, 0, scenario);
+
+    const auto volume = [&]() {
+      RealType sum = 0;
+      for (int i = 1; i <= size; i++) {
+        for (int j = 1; j <= size; j++) {
+          sum += block.getWaterHeight()[i][j];
+        }
+      }
+      return sum;
+    };
+    const RealType initialVolume = volume();
+    for (int step = 0; step < 40; step++) {
+      block.setGhostLayer();
+      block.simulateTimeStep(1.0);
+    }
+    REQUIRE_THAT(volume(), Catch::Matchers::WithinRel(initialVolume, 1e-12));
+    // The wave reached the opposite corner over both boundaries
+    REQUIRE(std::abs(block.getWaterHeight()[size][1] - 100) > 1e-6);
+  }
+
+  SECTION("Corner ghost cells come from the opposite corner") {
+    RingScenario                   scenario(0, 0, true);
+    Blocks::DimensionalSplitting<> block(size, size, cellSize, cellSize);
+    block.initialiseScenario(0, 0, scenario);
+    block.setBathymetry([](RealType x, RealType y) { return -100 - x / 1000 - y / 10000; });
+    block.setBoundaryType(BoundaryEdge::Left, BoundaryType::Periodic);
+    block.setGhostLayer();
+
+    const Tools::Float2D<RealType>& b = block.getBathymetry();
+    const Tools::Float2D<RealType>& h = block.getWaterHeight();
+    REQUIRE(b[0][0] == b[size][size]);
+    REQUIRE(b[0][size + 1] == b[size][1]);
+    REQUIRE(b[size + 1][0] == b[1][size]);
+    REQUIRE(b[size + 1][size + 1] == b[1][1]);
+    // The hump only covers the lower left corner
+    REQUIRE(h[size + 1][size + 1] == 101);
+    REQUIRE(h[0][0] == h[size][size]);
+  }
+
+  SECTION("The corridor goes around the boundary") {
+    RingScenario scenario(1000, 5000, false);
+    SearchBlock  block(size, size, cellSize, cellSize);
+    block.initialiseScenario(0, 0, scenario);
+    block.setStartCell({10, 50});
+    block.setEndCell({90, 50});
+    block.findSearchArea();
+
+    // 20 columns around the boundary instead of 80 through the block
+    REQUIRE(block.getDestinationArrivalTime() < 20 * cellSize / std::sqrt(9.81 * 100.0));
+
+    // The data stays where it is, the hump is still at the start cell
+    REQUIRE(block.getWaterHeight()[10][50] == 101);
+
+    // Every column is swept, but only the rows of the corridor
+    const auto area = block.getSearchArea();
+    REQUIRE(area.xEdges.iBegin == 0);
+    REQUIRE(area.xEdges.iEnd == size);
+    REQUIRE(area.yCells.iEnd == size);
+    REQUIRE(area.xCells.jBegin > 1);
+    REQUIRE(area.xCells.jEnd < size);
+
+    for (int step = 0; step < 20; step++) {
+      block.setGhostLayer();
+      block.simulateTimeStep(1.0);
+    }
+    REQUIRE(std::abs(block.getWaterHeight()[size][50] - 100) > 1e-6);
+  }
+}
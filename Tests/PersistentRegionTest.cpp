@@ -0,0 +1,20 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "RadialDamBreakBlock.hpp"
+
+TEST_CASE("Time step in one parallel region") {
+  for (auto executionMode :
+       {Blocks::ExecutionMode::Buffered, Blocks::ExecutionMode::Fused, Blocks::ExecutionMode::Tiled, Blocks::ExecutionMode::TaskGraph}) {
+    auto separate = Tests::createRadialDamBreakBlock(executionMode);
+    auto combined = Tests::createRadialDamBreakBlock(executionMode);
+
+    for (int step = 0; step < 20; step++) {
+      Tests::simulate(*separate, 1);
+
+      combined->setGhostLayer();
+      REQUIRE(combined->simulateTimeStep() == separate->getMaxTimeStep());
+    }
+
+    Tests::requireSameState(*combined, *separate);
+  }
+}
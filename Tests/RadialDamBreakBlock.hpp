@@ -0,0 +1,53 @@
+#pragma once
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <memory>
+
+#include "Blocks/DimensionalSplitting.h"
+#include "Scenarios/RadialDamBreakScenario.hpp"
+
+/**
+ * Setup shared by the execution mode tests: each mode runs a radial dam break and is compared against another mode.
+ */
+namespace Tests {
+
+  /**
+   * @brief Returns a size * size block of the radial dam break scenario in the given execution mode.
+   */
+  inline std::unique_ptr<Blocks::DimensionalSplitting<>> createRadialDamBreakBlock(
+    Blocks::ExecutionMode executionMode = Blocks::ExecutionMode::Buffered, int size = 100
+  ) {
+    Scenarios::RadialDamBreakScenario scenario;
+    const RealType                    cellSize = 1000.0 / size;
+
+    auto block = std::make_unique<Blocks::DimensionalSplitting<>>(size, size, cellSize, cellSize, executionMode);
+    block->initialiseScenario(0, 0, scenario);
+    return block;
+  }
+
+  /**
+   * @brief Runs steps time steps with the CFL time step, with separate computeNumericalFluxes and updateUnknowns calls.
+   */
+  inline void simulate(Blocks::DimensionalSplitting<>& block, int steps) {
+    for (int step = 0; step < steps; step++) {
+      block.setGhostLayer();
+      block.computeNumericalFluxes();
+      block.updateUnknowns(block.getMaxTimeStep());
+    }
+  }
+
+  /**
+   * @brief Requires bitwise the same water height and discharges as reference in every cell.
+   */
+  inline void requireSameState(Blocks::DimensionalSplitting<>& block, Blocks::DimensionalSplitting<>& reference) {
+    for (int i = 1; i <= block.getNx(); i++) {
+      for (int j = 1; j <= block.getNy(); j++) {
+        REQUIRE(block.getWaterHeight()[i][j] == reference.getWaterHeight()[i][j]);
+        REQUIRE(block.getDischargeHu()[i][j] == reference.getDischargeHu()[i][j]);
+        REQUIRE(block.getDischargeHv()[i][j] == reference.getDischargeHv()[i][j]);
+      }
+    }
+  }
+
+} // namespace Tests
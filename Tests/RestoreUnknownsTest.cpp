@@ -0,0 +1,62 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <functional>
+#include <memory>
+
+#include "Blocks/DimensionalSplitting.h"
+#include "Blocks/WavePropagationBlock.hpp"
+#include "Scenarios/RadialDamBreakScenario.hpp"
+
+namespace {
+  /**
+   * Takes a time step that is too long, restores the unknowns and repeats it with the allowed time step, like the
+   * predictive time step of the MPI runner. The result has to match a block that took the allowed time step directly.
+   */
+  void compare(const std::function<Blocks::Block*()>& createBlock) {
+    Scenarios::RadialDamBreakScenario scenario;
+    std::unique_ptr<Blocks::Block>    reference(createBlock());
+    std::unique_ptr<Blocks::Block>    repeated(createBlock());
+    reference->initialiseScenario(0, 0, scenario);
+    repeated->initialiseScenario(0, 0, scenario);
+
+    for (int step = 0; step < 10; step++) {
+      reference->setGhostLayer();
+      reference->computeNumericalFluxes();
+      const RealType dt = reference->getMaxTimeStep();
+      reference->updateUnknowns(dt);
+
+      repeated->setGhostLayer();
+      repeated->computeNumericalFluxes();
+      repeated->saveUnknowns();
+      repeated->updateUnknowns(3 * dt);
+      repeated->restoreUnknowns();
+      repeated->computeNumericalFluxes();
+      REQUIRE(repeated->getMaxTimeStep() == dt);
+      repeated->updateUnknowns(dt);
+    }
+
+    for (int i = 0; i <= reference->getNx() + 1; i++) {
+      for (int j = 0; j <= reference->getNy() + 1; j++) {
+        REQUIRE(repeated->getWaterHeight()[i][j] == reference->getWaterHeight()[i][j]);
+        REQUIRE(repeated->getDischargeHu()[i][j] == reference->getDischargeHu()[i][j]);
+        REQUIRE(repeated->getDischargeHv()[i][j] == reference->getDischargeHv()[i][j]);
+      }
+    }
+  }
+} // namespace
+
+TEST_CASE("Repeating a time step after restoring the unknowns") {
+  const int      nx = 40;
+  const int      ny = 30;
+  const RealType dx = 1000.0 / nx;
+  const RealType dy = 1000.0 / ny;
+
+  SECTION("Wave propagation block") {
+    compare([&]() { return new Blocks::WavePropagationBlock(nx, ny, dx, dy); });
+  }
+
+  SECTION("Dimensional splitting") {
+    compare([&]() { return new Blocks::DimensionalSplitting<Solvers::RusanovKernel>(nx, ny, dx, dy); });
+    compare([&]() { return new Blocks::DimensionalSplitting<Solvers::FWaveKernel>(nx, ny, dx, dy, Blocks::ExecutionMode::Fused); });
+  }
+}
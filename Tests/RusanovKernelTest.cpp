@@ -0,0 +1,39 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <Solvers/RusanovKernel.h>
+
+TEST_CASE("RusanovKernel") {
+  RealType hUpdateLeft, hUpdateRight, huUpdateLeft, huUpdateRight, maxWaveSpeed;
+
+  SECTION("Lake at rest over a bathymetry step stays at rest") {
+    Solvers::RusanovKernel::computeNetUpdates(
+      100, 40, 0, 0, -100, -40, hUpdateLeft, hUpdateRight, huUpdateLeft, huUpdateRight, maxWaveSpeed
+    );
+    REQUIRE_THAT(hUpdateLeft, Catch::Matchers::WithinAbs(0, 1e-10));
+    REQUIRE_THAT(hUpdateRight, Catch::Matchers::WithinAbs(0, 1e-10));
+    REQUIRE_THAT(huUpdateLeft, Catch::Matchers::WithinAbs(0, 1e-10));
+    REQUIRE_THAT(huUpdateRight, Catch::Matchers::WithinAbs(0, 1e-10));
+    REQUIRE_THAT(maxWaveSpeed, Catch::Matchers::WithinRel(std::sqrt(9.81 * 100), 1e-12));
+  }
+
+  SECTION("Net updates sum up to the flux jump") {
+    const RealType hL = 10, hR = 8, huL = 3, huR = -2;
+    Solvers::RusanovKernel::computeNetUpdates(hL, hR, huL, huR, 0, 0, hUpdateLeft, hUpdateRight, huUpdateLeft, huUpdateRight, maxWaveSpeed);
+    const RealType fluxL = huL * huL / hL + 0.5 * 9.81 * hL * hL;
+    const RealType fluxR = huR * huR / hR + 0.5 * 9.81 * hR * hR;
+    REQUIRE_THAT(hUpdateLeft + hUpdateRight, Catch::Matchers::WithinAbs(huR - huL, 1e-10));
+    REQUIRE_THAT(huUpdateLeft + huUpdateRight, Catch::Matchers::WithinAbs(fluxR - fluxL, 1e-10));
+  }
+
+  SECTION("Dry cells") {
+    Solvers::RusanovKernel::computeNetUpdates(0, 0, 0, 0, 10, 20, hUpdateLeft, hUpdateRight, huUpdateLeft, huUpdateRight, maxWaveSpeed);
+    REQUIRE(hUpdateLeft == 0);
+    REQUIRE(hUpdateRight == 0);
+    REQUIRE(maxWaveSpeed == 0);
+
+    Solvers::RusanovKernel::computeNetUpdates(10, 0, 5, 0, -10, 5, hUpdateLeft, hUpdateRight, huUpdateLeft, huUpdateRight, maxWaveSpeed);
+    REQUIRE(hUpdateRight == 0);
+    REQUIRE(huUpdateRight == 0);
+    REQUIRE(hUpdateLeft != 0);
+  }
+}
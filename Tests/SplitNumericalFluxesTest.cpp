@@ -0,0 +1,97 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <functional>
+#include <memory>
+
+#include "Blocks/DimensionalSplitting.h"
+#include "Blocks/WavePropagationBlock.hpp"
+#include "Scenarios/RadialDamBreakScenario.hpp"
+
+namespace {
+  /**
+   * A block whose ghost layers are written from outside after the initialisation, like the blocks of the MPI runner.
+   */
+  struct ConnectedBlock {
+    std::unique_ptr<Blocks::Block>   block;
+    std::unique_ptr<Blocks::Block1D> ghostLayers[4];
+    std::unique_ptr<Blocks::Block1D> copyLayers[4];
+
+    ConnectedBlock(Blocks::Block* newBlock, Scenarios::Scenario& scenario):
+      block(newBlock) {
+      block->initialiseScenario(0, 0, scenario);
+      for (const BoundaryEdge edge : {BoundaryEdge::Left, BoundaryEdge::Right, BoundaryEdge::Bottom, BoundaryEdge::Top}) {
+        ghostLayers[edge].reset(block->grabGhostLayer(edge));
+        copyLayers[edge].reset(block->registerCopyLayer(edge));
+      }
+    }
+
+    //! Fills the ghost layers with a meter more water than the copy layers, or 10 km of water that any read shows in the time step.
+    void fillGhostLayers(bool poison) {
+      for (int edge = 0; edge < 4; edge++) {
+        Blocks::Block1D&       ghost = *ghostLayers[edge];
+        const Blocks::Block1D& copy  = *copyLayers[edge];
+        for (int k = 0; k < ghost.h.getSize(); k++) {
+          ghost.h[k]  = poison ? RealType(10000.0) : copy.h[k] + 1;
+          ghost.hu[k] = poison ? RealType(0.0) : copy.hu[k];
+          ghost.hv[k] = poison ? RealType(0.0) : copy.hv[k];
+        }
+      }
+    }
+  };
+
+  /**
+   * Runs two blocks side by side, one with computeNumericalFluxes and one with the interior and boundary phase.
+   * The ghost layers of the second block are poisoned during the interior phase.
+   */
+  void compare(const std::function<Blocks::Block*()>& createBlock) {
+    Scenarios::RadialDamBreakScenario scenario;
+
+    ConnectedBlock                    reference(createBlock(), scenario);
+    ConnectedBlock                    split(createBlock(), scenario);
+
+    for (int step = 0; step < 20; step++) {
+      reference.fillGhostLayers(false);
+      reference.block->computeNumericalFluxes();
+
+      split.fillGhostLayers(true);
+      split.block->computeNumericalFluxesInterior();
+      split.fillGhostLayers(false);
+      split.block->computeNumericalFluxesBoundary();
+
+      REQUIRE(split.block->getMaxTimeStep() == reference.block->getMaxTimeStep());
+      reference.block->updateUnknowns(reference.block->getMaxTimeStep());
+      split.block->updateUnknowns(split.block->getMaxTimeStep());
+    }
+
+    const int nx = reference.block->getNx();
+    const int ny = reference.block->getNy();
+    for (int i = 1; i <= nx; i++) {
+      for (int j = 1; j <= ny; j++) {
+        REQUIRE(split.block->getWaterHeight()[i][j] == reference.block->getWaterHeight()[i][j]);
+        REQUIRE(split.block->getDischargeHu()[i][j] == reference.block->getDischargeHu()[i][j]);
+        REQUIRE(split.block->getDischargeHv()[i][j] == reference.block->getDischargeHv()[i][j]);
+      }
+    }
+  }
+} // namespace
+
+TEST_CASE("Interior and boundary phase of the numerical fluxes") {
+  const int      nx = 50;
+  const int      ny = 40;
+  const RealType dx = 1000.0 / nx;
+  const RealType dy = 1000.0 / ny;
+
+  SECTION("Wave propagation block") {
+    compare([&]() { return new Blocks::WavePropagationBlock(nx, ny, dx, dy); });
+  }
+
+  SECTION("Buffered dimensional splitting") {
+    compare([&]() { return new Blocks::DimensionalSplitting<Solvers::FWaveKernel>(nx, ny, dx, dy, Blocks::ExecutionMode::Buffered); });
+    compare([&]() { return new Blocks::DimensionalSplitting<Solvers::RusanovKernel>(nx, ny, dx, dy, Blocks::ExecutionMode::Buffered); });
+  }
+
+  SECTION("The other modes compute all edges in the boundary phase") {
+    compare([&]() { return new Blocks::DimensionalSplitting<>(nx, ny, dx, dy, Blocks::ExecutionMode::Fused); });
+    compare([&]() { return new Blocks::DimensionalSplitting<>(nx, ny, dx, dy, Blocks::ExecutionMode::Tiled); });
+  }
+}
@@ -0,0 +1,44 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "RadialDamBreakBlock.hpp"
+
+TEST_CASE("Task graph execution mode") {
+  auto buffered = Tests::createRadialDamBreakBlock(Blocks::ExecutionMode::Buffered);
+
+  SECTION("Same result as the buffered mode with the CFL time step") {
+    Tests::simulate(*buffered, 20);
+
+    // tile sizes that do not divide the block size and tiles larger than the block
+    for (auto [columns, rows] : {std::pair{1, 1}, {7, 13}, {16, 64}, {200, 30}}) {
+      auto taskGraph = Tests::createRadialDamBreakBlock(Blocks::ExecutionMode::TaskGraph);
+      taskGraph->setTileSize(columns, rows);
+      for (int step = 0; step < 20; step++) {
+        taskGraph->setGhostLayer();
+        taskGraph->simulateTimeStep();
+      }
+
+      REQUIRE(taskGraph->getMaxTimeStep() == buffered->getMaxTimeStep());
+      Tests::requireSameState(*taskGraph, *buffered);
+    }
+  }
+
+  SECTION("Same result as the buffered mode with a fixed time step") {
+    const RealType dt = 0.1;
+    for (int step = 0; step < 20; step++) {
+      buffered->setGhostLayer();
+      buffered->simulateTimeStep(dt);
+    }
+
+    for (auto [columns, rows] : {std::pair{1, 1}, {7, 13}, {16, 64}}) {
+      auto taskGraph = Tests::createRadialDamBreakBlock(Blocks::ExecutionMode::TaskGraph);
+      taskGraph->setTileSize(columns, rows);
+      for (int step = 0; step < 20; step++) {
+        taskGraph->setGhostLayer();
+        taskGraph->simulateTimeStep(dt);
+      }
+
+      REQUIRE(taskGraph->getMaxTimeStep() == buffered->getMaxTimeStep());
+      Tests::requireSameState(*taskGraph, *buffered);
+    }
+  }
+}
@@ -0,0 +1,66 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "Blocks/DimensionalSplitting.h"
+
+namespace {
+  // Lake at rest over a sloping sea floor with a small hump of water near the bottom left corner
+  class LocalHumpScenario: public Scenarios::Scenario {
+  public:
+    RealType getWaterHeight(RealType x, RealType y) const override {
+      const RealType hump = std::sqrt((x - 200) * (x - 200) + (y - 200) * (y - 200)) < 50 ? 2.0 : 0.0;
+      return -getBathymetry(x, y) + hump;
+    }
+    RealType     getBathymetry(RealType x, RealType y) const override { return -100.0 + 0.05 * x + 0.02 * y; }
+    BoundaryType getBoundaryType([[maybe_unused]] BoundaryEdge edge) const override { return BoundaryType::Outflow; }
+  };
+
+  void simulate(Blocks::DimensionalSplitting<>& block, int steps) {
+    for (int step = 0; step < steps; step++) {
+      block.setGhostLayer();
+      block.computeNumericalFluxes();
+      block.updateUnknowns(block.getMaxTimeStep());
+    }
+  }
+} // namespace
+
+TEST_CASE("TileActivityMap") {
+  LocalHumpScenario scenario;
+  const int         size     = 200;
+  const RealType    cellSize = 1000.0 / size;
+
+  for (auto executionMode : {Blocks::ExecutionMode::Buffered, Blocks::ExecutionMode::Fused}) {
+    Blocks::DimensionalSplitting<> tiled(size, size, cellSize, cellSize, executionMode);
+    Blocks::DimensionalSplitting<> dense(size, size, cellSize, cellSize, executionMode);
+    tiled.initialiseScenario(0, 0, scenario);
+    dense.initialiseScenario(0, 0, scenario);
+    tiled.setActiveTileSize(16);
+
+    tiled.setGhostLayer();
+    tiled.computeNumericalFluxes();
+    const int initialActiveTiles = tiled.getActivityMap().getActiveTileCount();
+    const int tileCount          = tiled.getActivityMap().getTileCountX() * tiled.getActivityMap().getTileCountY();
+    REQUIRE(initialActiveTiles < tileCount);
+    tiled.updateUnknowns(tiled.getMaxTimeStep());
+
+    dense.setGhostLayer();
+    dense.computeNumericalFluxes();
+    REQUIRE(tiled.getMaxTimeStep() == dense.getMaxTimeStep());
+    dense.updateUnknowns(dense.getMaxTimeStep());
+
+    simulate(tiled, 40);
+    simulate(dense, 40);
+
+    // the wave spreads, but has not reached the far corner yet
+    REQUIRE(tiled.getActivityMap().getActiveTileCount() > initialActiveTiles);
+    REQUIRE_FALSE(tiled.getActivityMap().isAllActive());
+
+    REQUIRE(tiled.getMaxTimeStep() == dense.getMaxTimeStep());
+    for (int i = 1; i <= size; i++) {
+      for (int j = 1; j <= size; j++) {
+        REQUIRE(tiled.getWaterHeight()[i][j] == dense.getWaterHeight()[i][j]);
+        REQUIRE(tiled.getDischargeHu()[i][j] == dense.getDischargeHu()[i][j]);
+        REQUIRE(tiled.getDischargeHv()[i][j] == dense.getDischargeHv()[i][j]);
+      }
+    }
+  }
+}
@@ -0,0 +1,31 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "RadialDamBreakBlock.hpp"
+
+TEST_CASE("Tiled execution mode") {
+  auto buffered = Tests::createRadialDamBreakBlock(Blocks::ExecutionMode::Buffered);
+  Tests::simulate(*buffered, 20);
+
+  SECTION("Same result as the buffered mode") {
+    // tile sizes that do not divide the block size and tiles larger than the block
+    for (auto [columns, rows] : {std::pair{1, 1}, {7, 13}, {16, 64}, {100, 100}, {200, 30}}) {
+      auto tiled = Tests::createRadialDamBreakBlock(Blocks::ExecutionMode::Tiled);
+      tiled->setTileSize(columns, rows);
+      Tests::simulate(*tiled, 20);
+
+      REQUIRE(tiled->getMaxTimeStep() == buffered->getMaxTimeStep());
+      Tests::requireSameState(*tiled, *buffered);
+    }
+  }
+
+  SECTION("Autotuning does not change the result") {
+    auto tiled = Tests::createRadialDamBreakBlock(Blocks::ExecutionMode::Tiled);
+    tiled->setGhostLayer();
+    tiled->autotuneTileSize();
+    REQUIRE(tiled->getTileColumns() <= tiled->getNx());
+    REQUIRE(tiled->getTileRows() <= tiled->getNy());
+
+    Tests::simulate(*tiled, 20);
+    Tests::requireSameState(*tiled, *buffered);
+  }
+}
@@ -0,0 +1,117 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "Blocks/DimensionalSplitting.h"
+#include "Tools/WetMask.h"
+
+namespace {
+  // Radial dam break around a square dry island
+  class IslandScenario: public Scenarios::Scenario {
+  public:
+    RealType getWaterHeight(RealType x, RealType y) const override {
+      if (isIsland(x, y)) {
+        return 0.0;
+      }
+      return std::sqrt((x - 250) * (x - 250) + (y - 250) * (y - 250)) < 100 ? 15.0 : 10.0;
+    }
+    RealType getBathymetry(RealType x, RealType y) const override { return isIsland(x, y) ? 5.0 : -10.0; }
+    BoundaryType getBoundaryType([[maybe_unused]] BoundaryEdge edge) const override { return BoundaryType::Outflow; }
+
+  private:
+    static bool isIsland(RealType x, RealType y) { return x > 500 && x < 700 && y > 400 && y < 600; }
+  };
+
+  // Block that ignores the water height and updates every cell and edge
+  class DenseBlock: public Blocks::DimensionalSplitting<> {
+  public:
+    using DimensionalSplitting::DimensionalSplitting;
+
+  protected:
+    void synchWaterHeightAfterWrite() override { wetMask_.setAllWet(nx_, ny_); }
+  };
+
+  void simulate(Blocks::Block& block, int steps) {
+    for (int step = 0; step < steps; step++) {
+      block.setGhostLayer();
+      block.computeNumericalFluxes();
+      block.updateUnknowns(block.getMaxTimeStep());
+    }
+  }
+} // namespace
+
+TEST_CASE("WetMask spans") {
+  // 4 x 3 block, the cells (2, 2) and (3, 1), (3, 2), (3, 3) are dry
+  Tools::Float2D<RealType> h(6, 5);
+  for (int i = 0; i < 6; i++) {
+    for (int j = 0; j < 5; j++) {
+      h[i][j] = 1.0;
+    }
+  }
+  h[2][2] = 0.0;
+  h[3][1] = h[3][2] = h[3][3] = 0.0;
+
+  Tools::WetMask mask;
+  mask.build(h, 4, 3);
+  REQUIRE(mask.getWetCellCount() == 8);
+
+  auto cells2 = mask.getCellSpans(2);
+  REQUIRE(cells2.size() == 2);
+  REQUIRE(cells2[0].begin == 0);
+  REQUIRE(cells2[0].end == 1);
+  REQUIRE(cells2[1].begin == 3);
+  REQUIRE(cells2[1].end == 4);
+
+  // only the ghost cells of column 3 are wet
+  auto cells3 = mask.getCellSpans(3);
+  REQUIRE(cells3.size() == 2);
+  REQUIRE(cells3[0].end == 0);
+  REQUIRE(cells3[1].begin == 4);
+
+  // the x-edge between (2, 2) and (3, 2) is dry on both sides
+  auto xEdges2 = mask.getXEdgeSpans(2);
+  REQUIRE(xEdges2.size() == 2);
+  REQUIRE(xEdges2[0].end == 1);
+  REQUIRE(xEdges2[1].begin == 3);
+
+  // column 3 has wet y-edges only next to the ghost cells
+  auto yEdges3 = mask.getYEdgeSpans(3);
+  REQUIRE(yEdges3.size() == 2);
+  REQUIRE(yEdges3[0].begin == 0);
+  REQUIRE(yEdges3[0].end == 0);
+  REQUIRE(yEdges3[1].begin == 3);
+  REQUIRE(yEdges3[1].end == 3);
+
+  REQUIRE(mask.isWet(2, 1));
+  REQUIRE_FALSE(mask.isWet(2, 2));
+  REQUIRE(mask.isWet(3, 0));
+  REQUIRE_FALSE(mask.isWet(3, 3));
+
+  int visited = 0;
+  Tools::WetMask::forEachSpan(mask.getCellSpans(2), 1, 3, [&](int begin, int end) { visited += end - begin + 1; });
+  REQUIRE(visited == 2);
+}
+
+TEST_CASE("WetMask does not change the result") {
+  IslandScenario scenario;
+  const int      size     = 100;
+  const RealType cellSize = 1000.0 / size;
+
+  for (auto executionMode : {Blocks::ExecutionMode::Buffered, Blocks::ExecutionMode::Fused}) {
+    Blocks::DimensionalSplitting<> masked(size, size, cellSize, cellSize, executionMode);
+    DenseBlock                     dense(size, size, cellSize, cellSize, executionMode);
+    masked.initialiseScenario(0, 0, scenario);
+    dense.initialiseScenario(0, 0, scenario);
+    REQUIRE(masked.getWetMask().getWetCellCount() < long(size) * size);
+
+    simulate(masked, 30);
+    simulate(dense, 30);
+
+    REQUIRE(masked.getMaxTimeStep() == dense.getMaxTimeStep());
+    for (int i = 1; i <= size; i++) {
+      for (int j = 1; j <= size; j++) {
+        REQUIRE(masked.getWaterHeight()[i][j] == dense.getWaterHeight()[i][j]);
+        REQUIRE(masked.getDischargeHu()[i][j] == dense.getDischargeHu()[i][j]);
+        REQUIRE(masked.getDischargeHv()[i][j] == dense.getDischargeHv()[i][j]);
+      }
+    }
+  }
+}